@@ -0,0 +1,258 @@
+/*
+ * actor-pool: A pool of actors which can be recycled instead of being
+ *             destroyed and created again
+ * 
+ * Copyright 2012-2017 Stephan Haller <nomad@froevel.de>
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ * 
+ * 
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <libxfdashboard/actor-pool.h>
+
+#include <glib/gi18n-lib.h>
+
+#include <libxfdashboard/stylable.h>
+#include <libxfdashboard/compat.h>
+#include <libxfdashboard/debug.h>
+
+
+/* Define this class in GObject system */
+G_DEFINE_TYPE(XfdashboardActorPool,
+				xfdashboard_actor_pool,
+				G_TYPE_OBJECT)
+
+/* Private structure - access only by public API if needed */
+#define XFDASHBOARD_ACTOR_POOL_GET_PRIVATE(obj) \
+	(G_TYPE_INSTANCE_GET_PRIVATE((obj), XFDASHBOARD_TYPE_ACTOR_POOL, XfdashboardActorPoolPrivate))
+
+struct _XfdashboardActorPoolPrivate
+{
+	/* Instance related */
+	GHashTable						*pool;
+};
+
+/* IMPLEMENTATION: Private variables and methods */
+#define XFDASHBOARD_ACTOR_POOL_KEY_DATA		"xfdashboard-actor-pool-key"
+#define XFDASHBOARD_ACTOR_POOL_MAX_ACTORS	256		/* Maximum number of actors kept for each key */
+
+static GQuark	_xfdashboard_actor_pool_key_quark=0;
+
+/* Build key for actor type and style class */
+static gchar* _xfdashboard_actor_pool_build_key(GType inType, const gchar *inStyleClass)
+{
+	return(g_strdup_printf("%s/%s", g_type_name(inType), inStyleClass ? inStyleClass : ""));
+}
+
+/* Destroy all actors in a queue of pool and free queue */
+static void _xfdashboard_actor_pool_free_queue(gpointer inData)
+{
+	GQueue							*queue;
+	ClutterActor					*actor;
+
+	g_return_if_fail(inData);
+
+	queue=(GQueue*)inData;
+
+	while((actor=CLUTTER_ACTOR(g_queue_pop_head(queue))))
+	{
+		clutter_actor_destroy(actor);
+		g_object_unref(actor);
+	}
+
+	g_queue_free(queue);
+}
+
+/* IMPLEMENTATION: GObject */
+
+/* Dispose this object */
+static void _xfdashboard_actor_pool_dispose(GObject *inObject)
+{
+	XfdashboardActorPool			*self=XFDASHBOARD_ACTOR_POOL(inObject);
+	XfdashboardActorPoolPrivate		*priv=self->priv;
+
+	/* Release allocated resources */
+	if(priv->pool)
+	{
+		g_hash_table_destroy(priv->pool);
+		priv->pool=NULL;
+	}
+
+	/* Call parent's class dispose method */
+	G_OBJECT_CLASS(xfdashboard_actor_pool_parent_class)->dispose(inObject);
+}
+
+/* Class initialization
+ * Override functions in parent classes and define properties
+ * and signals
+ */
+static void xfdashboard_actor_pool_class_init(XfdashboardActorPoolClass *klass)
+{
+	GObjectClass		*gobjectClass=G_OBJECT_CLASS(klass);
+
+	/* Override functions */
+	gobjectClass->dispose=_xfdashboard_actor_pool_dispose;
+
+	/* Set up private structure */
+	g_type_class_add_private(klass, sizeof(XfdashboardActorPoolPrivate));
+
+	/* Set up quark for key stored at registered actors */
+	_xfdashboard_actor_pool_key_quark=g_quark_from_static_string(XFDASHBOARD_ACTOR_POOL_KEY_DATA);
+}
+
+/* Object initialization
+ * Create private structure and set up default values
+ */
+static void xfdashboard_actor_pool_init(XfdashboardActorPool *self)
+{
+	XfdashboardActorPoolPrivate		*priv;
+
+	priv=self->priv=XFDASHBOARD_ACTOR_POOL_GET_PRIVATE(self);
+
+	/* Set default values */
+	priv->pool=g_hash_table_new_full(g_str_hash,
+										g_str_equal,
+										g_free,
+										_xfdashboard_actor_pool_free_queue);
+}
+
+/* IMPLEMENTATION: Public API */
+
+/* Create new instance */
+XfdashboardActorPool* xfdashboard_actor_pool_new(void)
+{
+	return(XFDASHBOARD_ACTOR_POOL(g_object_new(XFDASHBOARD_TYPE_ACTOR_POOL, NULL)));
+}
+
+/* Mark a newly created actor as recyclable. The style class is used together
+ * with the type of actor to look up recycled actors, so actors set up
+ * differently by the caller will not be mixed.
+ */
+void xfdashboard_actor_pool_register(XfdashboardActorPool *self,
+										ClutterActor *inActor,
+										const gchar *inStyleClass)
+{
+	g_return_if_fail(XFDASHBOARD_IS_ACTOR_POOL(self));
+	g_return_if_fail(CLUTTER_IS_ACTOR(inActor));
+
+	g_object_set_qdata_full(G_OBJECT(inActor),
+							_xfdashboard_actor_pool_key_quark,
+							_xfdashboard_actor_pool_build_key(G_OBJECT_TYPE(inActor), inStyleClass),
+							g_free);
+}
+
+/* Get a recycled actor of requested type and style class. The actor returned
+ * is floating like a newly created one and must be rebound by the caller,
+ * e.g. by setting the object it represents. Returns NULL if no recycled actor
+ * is available and the caller has to create (and register) a new one.
+ */
+ClutterActor* xfdashboard_actor_pool_acquire(XfdashboardActorPool *self,
+												GType inType,
+												const gchar *inStyleClass)
+{
+	XfdashboardActorPoolPrivate		*priv;
+	gchar							*key;
+	GQueue							*queue;
+	ClutterActor					*actor;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_ACTOR_POOL(self), NULL);
+	g_return_val_if_fail(g_type_is_a(inType, CLUTTER_TYPE_ACTOR), NULL);
+
+	priv=self->priv;
+	actor=NULL;
+
+	/* Take first actor from queue of requested key */
+	key=_xfdashboard_actor_pool_build_key(inType, inStyleClass);
+	queue=(GQueue*)g_hash_table_lookup(priv->pool, key);
+	if(queue) actor=CLUTTER_ACTOR(g_queue_pop_head(queue));
+	g_free(key);
+
+	if(!actor) return(NULL);
+
+	/* Our reference becomes the floating one which the new parent will sink */
+	g_object_force_floating(G_OBJECT(actor));
+
+	XFDASHBOARD_DEBUG(self, ACTOR,
+						"Recycled actor %s@%p with %u actors left in pool",
+						G_OBJECT_TYPE_NAME(actor),
+						actor,
+						g_queue_get_length(queue));
+
+	return(actor);
+}
+
+/* Put a registered actor into pool for later reuse. The actor is removed from
+ * its parent and its pseudo-classes are reset. The caller must reset any other
+ * state it has set up at actor itself. Returns FALSE if actor was not
+ * registered or pool is full, so caller should destroy actor as usual.
+ */
+gboolean xfdashboard_actor_pool_release(XfdashboardActorPool *self,
+										ClutterActor *inActor)
+{
+	XfdashboardActorPoolPrivate		*priv;
+	const gchar						*key;
+	GQueue							*queue;
+	ClutterActor					*parent;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_ACTOR_POOL(self), FALSE);
+	g_return_val_if_fail(CLUTTER_IS_ACTOR(inActor), FALSE);
+
+	priv=self->priv;
+
+	/* Check if actor can be recycled */
+	key=(const gchar*)g_object_get_qdata(G_OBJECT(inActor), _xfdashboard_actor_pool_key_quark);
+	if(!key) return(FALSE);
+
+	/* Get queue for key of actor or create it */
+	queue=(GQueue*)g_hash_table_lookup(priv->pool, key);
+	if(!queue)
+	{
+		queue=g_queue_new();
+		g_hash_table_insert(priv->pool, g_strdup(key), queue);
+	}
+
+	if(g_queue_get_length(queue)>=XFDASHBOARD_ACTOR_POOL_MAX_ACTORS) return(FALSE);
+
+	/* Take reference on actor and remove it from its parent */
+	g_object_ref(inActor);
+
+	parent=clutter_actor_get_parent(inActor);
+	if(parent) clutter_actor_remove_child(parent, inActor);
+
+	/* Reset state of actor */
+	if(XFDASHBOARD_IS_STYLABLE(inActor))
+	{
+		xfdashboard_stylable_set_pseudo_classes(XFDASHBOARD_STYLABLE(inActor), NULL);
+	}
+
+	/* Add actor to pool */
+	g_queue_push_tail(queue, inActor);
+
+	return(TRUE);
+}
+
+/* Destroy all actors in pool */
+void xfdashboard_actor_pool_clear(XfdashboardActorPool *self)
+{
+	g_return_if_fail(XFDASHBOARD_IS_ACTOR_POOL(self));
+
+	g_hash_table_remove_all(self->priv->pool);
+}
@@ -0,0 +1,86 @@
+/*
+ * actor-pool: A pool of actors which can be recycled instead of being
+ *             destroyed and created again
+ * 
+ * Copyright 2012-2017 Stephan Haller <nomad@froevel.de>
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ * 
+ * 
+ */
+
+#ifndef __LIBXFDASHBOARD_ACTOR_POOL__
+#define __LIBXFDASHBOARD_ACTOR_POOL__
+
+#if !defined(__LIBXFDASHBOARD_H_INSIDE__) && !defined(LIBXFDASHBOARD_COMPILATION)
+#error "Only <libxfdashboard/libxfdashboard.h> can be included directly."
+#endif
+
+#include <clutter/clutter.h>
+
+G_BEGIN_DECLS
+
+#define XFDASHBOARD_TYPE_ACTOR_POOL				(xfdashboard_actor_pool_get_type())
+#define XFDASHBOARD_ACTOR_POOL(obj)				(G_TYPE_CHECK_INSTANCE_CAST((obj), XFDASHBOARD_TYPE_ACTOR_POOL, XfdashboardActorPool))
+#define XFDASHBOARD_IS_ACTOR_POOL(obj)			(G_TYPE_CHECK_INSTANCE_TYPE((obj), XFDASHBOARD_TYPE_ACTOR_POOL))
+#define XFDASHBOARD_ACTOR_POOL_CLASS(klass)		(G_TYPE_CHECK_CLASS_CAST((klass), XFDASHBOARD_TYPE_ACTOR_POOL, XfdashboardActorPoolClass))
+#define XFDASHBOARD_IS_ACTOR_POOL_CLASS(klass)	(G_TYPE_CHECK_CLASS_TYPE((klass), XFDASHBOARD_TYPE_ACTOR_POOL))
+#define XFDASHBOARD_ACTOR_POOL_GET_CLASS(obj)	(G_TYPE_INSTANCE_GET_CLASS((obj), XFDASHBOARD_TYPE_ACTOR_POOL, XfdashboardActorPoolClass))
+
+typedef struct _XfdashboardActorPool			XfdashboardActorPool;
+typedef struct _XfdashboardActorPoolClass		XfdashboardActorPoolClass;
+typedef struct _XfdashboardActorPoolPrivate		XfdashboardActorPoolPrivate;
+
+struct _XfdashboardActorPool
+{
+	/*< private >*/
+	/* Parent instance */
+	GObject							parent_instance;
+
+	/* Private structure */
+	XfdashboardActorPoolPrivate		*priv;
+};
+
+struct _XfdashboardActorPoolClass
+{
+	/*< private >*/
+	/* Parent class */
+	GObjectClass					parent_class;
+
+	/*< public >*/
+	/* Virtual functions */
+};
+
+/* Public API */
+GType xfdashboard_actor_pool_get_type(void) G_GNUC_CONST;
+
+XfdashboardActorPool* xfdashboard_actor_pool_new(void);
+
+void xfdashboard_actor_pool_register(XfdashboardActorPool *self,
+										ClutterActor *inActor,
+										const gchar *inStyleClass);
+
+ClutterActor* xfdashboard_actor_pool_acquire(XfdashboardActorPool *self,
+												GType inType,
+												const gchar *inStyleClass);
+gboolean xfdashboard_actor_pool_release(XfdashboardActorPool *self,
+										ClutterActor *inActor);
+
+void xfdashboard_actor_pool_clear(XfdashboardActorPool *self);
+
+G_END_DECLS
+
+#endif	/* __LIBXFDASHBOARD_ACTOR_POOL__ */
@@ -56,6 +56,8 @@ struct _XfdashboardActorPrivate
 
 	gchar			*styleClasses;
 	gchar			*stylePseudoClasses;
+	GQuark			*styleClassQuarks;
+	GQuark			*stylePseudoClassQuarks;
 
 	/* Instance related */
 	GHashTable		*lastThemeStyleSet;
@@ -81,7 +83,11 @@ enum
 static GParamSpec* XfdashboardActorProperties[PROP_LAST]={ 0, };
 
 /* IMPLEMENTATION: Private variables and methods */
+#define XFDASHBOARD_ACTOR_STYLE_INVALIDATION_MAX_PASSES		4
+
 static GParamSpecPool		*_xfdashboard_actor_stylable_properties_pool=NULL;
+static GHashTable			*_xfdashboard_actor_style_invalidation_queue=NULL;
+static guint				_xfdashboard_actor_style_invalidation_repaint_id=0;
 
 #define XFDASHBOARD_ACTOR_PARAM_SPEC_REF		(_xfdashboard_actor_param_spec_ref_quark())
 
@@ -91,34 +97,140 @@ static GQuark _xfdashboard_actor_param_spec_ref_quark(void)
 	return(g_quark_from_static_string("xfdashboard-actor-param-spec-ref-quark"));
 }
 
-/* Invalidate all stylable children recursively beginning at given actor */
-static void _xfdashboard_actor_invalidate_recursive(ClutterActor *inActor)
+/* Resolve styles of all actors in queue of style invalidation. It is called
+ * once before the next frame is laid out and painted so all invalidations
+ * happened until then are handled in one pass and each actor is restyled
+ * at most once.
+ */
+static gboolean _xfdashboard_actor_on_style_invalidation_repaint(gpointer inUserData)
 {
-	ClutterActor			*child;
-	ClutterActorIter		actorIter;
+	GHashTable				*queue;
+	GHashTableIter			iter;
+	ClutterActor			*actor;
+	gint					passes;
+
+	/* Resolve styles of all queued actors. Restyling actors may invalidate
+	 * other actors which are queued again so repeat until queue is empty
+	 * but stop after some passes to prevent endless loops. The remaining
+	 * actors will then be handled at next frame.
+	 */
+	_xfdashboard_actor_style_invalidation_repaint_id=0;
+
+	for(passes=0;
+		passes<XFDASHBOARD_ACTOR_STYLE_INVALIDATION_MAX_PASSES && _xfdashboard_actor_style_invalidation_queue;
+		passes++)
+	{
+		/* Take queue so actors invalidated while restyling are queued in new one */
+		queue=_xfdashboard_actor_style_invalidation_queue;
+		_xfdashboard_actor_style_invalidation_queue=NULL;
+
+		XFDASHBOARD_DEBUG(NULL, STYLE,
+							"Resolving styles of %u invalidated actors in pass %d",
+							g_hash_table_size(queue),
+							passes+1);
+
+		g_hash_table_iter_init(&iter, queue);
+		while(g_hash_table_iter_next(&iter, (gpointer*)&actor, NULL))
+		{
+			xfdashboard_stylable_invalidate(XFDASHBOARD_STYLABLE(actor));
+		}
+
+		/* Release queue which also releases the references taken on actors */
+		g_hash_table_unref(queue);
+	}
+
+	/* Remove this repaint function. If any actor is still in queue a new
+	 * repaint function was already added.
+	 */
+	return(G_SOURCE_REMOVE);
+}
 
+/* Mark stylable actor dirty by adding it to queue of style invalidation */
+static void _xfdashboard_actor_queue_style_invalidation(ClutterActor *inActor)
+{
 	g_return_if_fail(CLUTTER_IS_ACTOR(inActor));
 
-	/* If actor is stylable invalidate it to get its style recomputed */
-	if(XFDASHBOARD_IS_STYLABLE(inActor))
+	/* Only stylable actors can be restyled */
+	if(!XFDASHBOARD_IS_STYLABLE(inActor)) return;
+
+	/* Create queue if needed and add actor if it is not queued already */
+	if(!_xfdashboard_actor_style_invalidation_queue)
 	{
-		xfdashboard_stylable_invalidate(XFDASHBOARD_STYLABLE(inActor));
+		_xfdashboard_actor_style_invalidation_queue=g_hash_table_new_full(g_direct_hash,
+																			g_direct_equal,
+																			g_object_unref,
+																			NULL);
 	}
 
-	/* Recompute styles for all children recursively */
+	if(!g_hash_table_contains(_xfdashboard_actor_style_invalidation_queue, inActor))
+	{
+		g_hash_table_add(_xfdashboard_actor_style_invalidation_queue, g_object_ref(inActor));
+	}
+
+	/* Resolve styles before next frame is laid out and painted */
+	if(!_xfdashboard_actor_style_invalidation_repaint_id)
+	{
+		_xfdashboard_actor_style_invalidation_repaint_id=
+			clutter_threads_add_repaint_func_full(CLUTTER_REPAINT_FLAGS_QUEUE_REDRAW_ON_ADD | CLUTTER_REPAINT_FLAGS_PRE_PAINT,
+													_xfdashboard_actor_on_style_invalidation_repaint,
+													NULL,
+													NULL);
+	}
+}
+
+/* Mark all stylable descendants dirty whose style may depend on their
+ * ancestors recursively beginning at children of given actor.
+ */
+static void _xfdashboard_actor_queue_style_invalidation_descendants(ClutterActor *inActor,
+																	XfdashboardThemeCSS *inThemeCSS)
+{
+	ClutterActor			*child;
+	ClutterActorIter		actorIter;
+
+	g_return_if_fail(CLUTTER_IS_ACTOR(inActor));
+
 	clutter_actor_iter_init(&actorIter, inActor);
 	while(clutter_actor_iter_next(&actorIter, &child))
 	{
-		/* Call ourselve recursive with child as top-level actor.
-		 * We return immediately if it has no children but invalidate child
-		 * before. If it has children it will first invalidated and will be
-		 * iterated over its children then. In both cases the child will
-		 * be invalidated.
+		/* Mark child dirty if any selector which could match it depends
+		 * on its ancestors. If theme CSS is not available assume it does.
 		 */
-		_xfdashboard_actor_invalidate_recursive(child);
+		if(XFDASHBOARD_IS_STYLABLE(child) &&
+			(!inThemeCSS ||
+				xfdashboard_theme_css_has_ancestor_selectors(inThemeCSS, XFDASHBOARD_STYLABLE(child))))
+		{
+			_xfdashboard_actor_queue_style_invalidation(child);
+		}
+
+		/* Check descendants of child even if child itself was not marked
+		 * dirty as they may depend on their ancestors.
+		 */
+		_xfdashboard_actor_queue_style_invalidation_descendants(child, inThemeCSS);
 	}
 }
 
+/* Invalidate style of given actor and of all its stylable descendants which
+ * may be affected. The styles are not resolved immediately but before next
+ * frame is laid out and painted.
+ */
+static void _xfdashboard_actor_invalidate_recursive(ClutterActor *inActor)
+{
+	XfdashboardTheme		*theme;
+	XfdashboardThemeCSS		*themeCSS;
+
+	g_return_if_fail(CLUTTER_IS_ACTOR(inActor));
+
+	/* Mark actor itself dirty */
+	_xfdashboard_actor_queue_style_invalidation(inActor);
+
+	/* Mark descendants dirty which may be affected */
+	themeCSS=NULL;
+	theme=xfdashboard_application_get_theme(NULL);
+	if(theme) themeCSS=xfdashboard_theme_get_css(theme);
+
+	_xfdashboard_actor_queue_style_invalidation_descendants(inActor, themeCSS);
+}
+
 /* Get parameter specification of stylable properties and add them to hashtable.
  * If requested do it recursively over all parent classes.
  */
@@ -149,18 +261,6 @@ static void _xfdashboard_actor_hashtable_get_all_stylable_param_specs(GHashTable
 	if(inRecursive && parentClass) _xfdashboard_actor_hashtable_get_all_stylable_param_specs(ioHashtable, parentClass, inRecursive);
 }
 
-/* Remove entries from hashtable whose key is a duplicate
- * in other hashtable (given in user data)
- */
-static gboolean _xfdashboard_actor_hashtable_is_duplicate_key(gpointer inKey,
-																gpointer inValue,
-																gpointer inUserData)
-{
-	GHashTable			*otherHashtable=(GHashTable*)inUserData;
-
-	return(g_hash_table_lookup_extended(otherHashtable, inKey, NULL, NULL));
-}
-
 /* Actor was mapped or unmapped */
 static void _xfdashboard_actor_on_mapped_changed(GObject *inObject,
 													GParamSpec *inSpec,
@@ -403,6 +503,9 @@ static void _xfdashboard_actor_stylable_set_classes(XfdashboardStylable *inStyla
 
 		if(inStyleClasses) priv->styleClasses=g_strdup(inStyleClasses);
 
+		if(priv->styleClassQuarks) g_free(priv->styleClassQuarks);
+		priv->styleClassQuarks=xfdashboard_stylable_build_quark_list(priv->styleClasses, '.', NULL);
+
 		/* Invalidate style to get it restyled and redrawn. Also invalidate
 		 * children as they might reference the old, invalid classes or
 		 * the new, valid ones.
@@ -448,6 +551,9 @@ static void _xfdashboard_actor_stylable_set_pseudo_classes(XfdashboardStylable *
 
 		if(inStylePseudoClasses) priv->stylePseudoClasses=g_strdup(inStylePseudoClasses);
 
+		if(priv->stylePseudoClassQuarks) g_free(priv->stylePseudoClassQuarks);
+		priv->stylePseudoClassQuarks=xfdashboard_stylable_build_quark_list(priv->stylePseudoClasses, ':', NULL);
+
 		/* Invalidate style to get it restyled and redrawn. Also invalidate
 		 * children as they might reference the old, invalid pseudo-classes
 		 * or the new, valid ones.
@@ -459,6 +565,21 @@ static void _xfdashboard_actor_stylable_set_pseudo_classes(XfdashboardStylable *
 	}
 }
 
+/* Get style classes and pseudo-classes of actor as quark sets */
+static const GQuark* _xfdashboard_actor_stylable_get_class_quarks(XfdashboardStylable *inStylable)
+{
+	g_return_val_if_fail(XFDASHBOARD_IS_ACTOR(inStylable), NULL);
+
+	return(XFDASHBOARD_ACTOR(inStylable)->priv->styleClassQuarks);
+}
+
+static const GQuark* _xfdashboard_actor_stylable_get_pseudo_class_quarks(XfdashboardStylable *inStylable)
+{
+	g_return_val_if_fail(XFDASHBOARD_IS_ACTOR(inStylable), NULL);
+
+	return(XFDASHBOARD_ACTOR(inStylable)->priv->stylePseudoClassQuarks);
+}
+
 /* Invalidate style to recompute styles */
 static void _xfdashboard_actor_stylable_invalidate(XfdashboardStylable *inStylable)
 {
@@ -540,6 +661,19 @@ static void _xfdashboard_actor_stylable_invalidate(XfdashboardStylable *inStylab
 	/* Get style information from theme */
 	themeStyleSet=xfdashboard_theme_css_get_properties(themeCSS, XFDASHBOARD_STYLABLE(self));
 
+	/* Style information from theme are shared between all stylables with the
+	 * same signature. If we got the same style information as the last time
+	 * nothing has changed and there is nothing to do unless revalidation
+	 * was forced.
+	 */
+	if(themeStyleSet==priv->lastThemeStyleSet &&
+		!priv->forceStyleRevalidation)
+	{
+		g_hash_table_unref(themeStyleSet);
+		g_hash_table_destroy(possibleStyleSet);
+		return;
+	}
+
 #ifdef DEBUG
 	if(doDebug)
 	{
@@ -630,24 +764,25 @@ static void _xfdashboard_actor_stylable_invalidate(XfdashboardStylable *inStylab
 		g_value_unset(&cssValue);
 	}
 
-	/* Now remove all duplicate keys in set of properties changed we set the last
-	 * time. The remaining keys determine the properties which were set the last
-	 * time but not this time and should be restored to their default values.
+	/* Now look up all keys in set of properties changed we set the last time
+	 * which are not set this time. These properties should be restored to
+	 * their default values.
 	 */
 	if(priv->lastThemeStyleSet)
 	{
-		/* Remove duplicate keys from set of last changed properties */
-		g_hash_table_foreach_remove(priv->lastThemeStyleSet, (GHRFunc)_xfdashboard_actor_hashtable_is_duplicate_key, themeStyleSet);
-
-		/* Iterate through remaining key and restore corresponding object properties
-		 * to their default values.
+		/* Iterate through keys of last changed properties and restore
+		 * corresponding object properties not set this time to their
+		 * default values.
 		 */
 		g_hash_table_iter_init(&hashIter, priv->lastThemeStyleSet);
-		while(g_hash_table_iter_next(&hashIter, (gpointer*)&styleName, (gpointer*)&paramSpec))
+		while(g_hash_table_iter_next(&hashIter, (gpointer*)&styleName, NULL))
 		{
 			GValue				propertyValue=G_VALUE_INIT;
 			GParamSpec			*realParamSpec;
 
+			/* Skip keys which were set this time */
+			if(g_hash_table_contains(themeStyleSet, styleName)) continue;
+
 			/* Check if key is a valid object property name */
 			if(!g_hash_table_lookup_extended(possibleStyleSet, styleName, NULL, (gpointer*)&paramSpec)) continue;
 
@@ -683,10 +818,10 @@ static void _xfdashboard_actor_stylable_invalidate(XfdashboardStylable *inStylab
 			g_value_unset(&propertyValue);
 		}
 
-		/* Release resources of set of last changed properties as we do not need
-		 * it anymore.
+		/* Release set of last changed properties as we do not need it anymore.
+		 * It is shared so it must not be destroyed but only be unreferenced.
 		 */
-		g_hash_table_destroy(priv->lastThemeStyleSet);
+		g_hash_table_unref(priv->lastThemeStyleSet);
 		priv->lastThemeStyleSet=NULL;
 	}
 
@@ -723,6 +858,8 @@ static void _xfdashboard_actor_stylable_iface_init(XfdashboardStylableInterface
 	iface->get_pseudo_classes=_xfdashboard_actor_stylable_get_pseudo_classes;
 	iface->set_pseudo_classes=_xfdashboard_actor_stylable_set_pseudo_classes;
 	iface->invalidate=_xfdashboard_actor_stylable_invalidate;
+	iface->get_class_quarks=_xfdashboard_actor_stylable_get_class_quarks;
+	iface->get_pseudo_class_quarks=_xfdashboard_actor_stylable_get_pseudo_class_quarks;
 }
 
 /* IMPLEMENTATION: ClutterActor */
@@ -895,9 +1032,21 @@ static void _xfdashboard_actor_dispose(GObject *inObject)
 		priv->stylePseudoClasses=NULL;
 	}
 
+	if(priv->styleClassQuarks)
+	{
+		g_free(priv->styleClassQuarks);
+		priv->styleClassQuarks=NULL;
+	}
+
+	if(priv->stylePseudoClassQuarks)
+	{
+		g_free(priv->stylePseudoClassQuarks);
+		priv->stylePseudoClassQuarks=NULL;
+	}
+
 	if(priv->lastThemeStyleSet)
 	{
-		g_hash_table_destroy(priv->lastThemeStyleSet);
+		g_hash_table_unref(priv->lastThemeStyleSet);
 		priv->lastThemeStyleSet=NULL;
 	}
 
@@ -1047,6 +1196,8 @@ void xfdashboard_actor_init(XfdashboardActor *self)
 	priv->effects=NULL;
 	priv->styleClasses=NULL;
 	priv->stylePseudoClasses=NULL;
+	priv->styleClassQuarks=NULL;
+	priv->stylePseudoClassQuarks=NULL;
 	priv->lastThemeStyleSet=NULL;
 	priv->isFirstParent=TRUE;
 
@@ -30,6 +30,7 @@
 
 #include <libxfdashboard/application-database.h>
 #include <libxfdashboard/desktop-app-info.h>
+#include <libxfdashboard/marshal.h>
 #include <libxfdashboard/compat.h>
 #include <libxfdashboard/debug.h>
 
@@ -56,6 +57,18 @@ struct _XfdashboardApplicationDatabasePrivate
 
 	GHashTable			*applications;
 	GList				*appDirMonitors;
+
+	GHashTable			*snapshotDirectories;
+
+	gboolean			snapshotNeedsSave;
+
+	GThreadPool			*parsePool;
+	gint				parseCancelled;
+	GAsyncQueue			*parsedJobs;
+	gint				parsedJobsScheduled;
+	guint				parseJobsTotal;
+	guint				parseJobsDone;
+	GList				*scanDirectories;
 };
 
 /* Properties */
@@ -78,12 +91,18 @@ enum
 	SIGNAL_APPLICATION_ADDED,
 	SIGNAL_APPLICATION_REMOVED,
 
+	SIGNAL_APPLICATION_DATABASE_LOADED,
+
 	SIGNAL_LAST
 };
 
 static guint XfdashboardApplicationDatabaseSignals[SIGNAL_LAST]={ 0, };
 
 /* IMPLEMENTATION: Private variables and methods */
+#define XFDASHBOARD_APPLICATION_DATABASE_SNAPSHOT_FILE		"applications.cache"
+#define XFDASHBOARD_APPLICATION_DATABASE_SNAPSHOT_MAGIC		0x58444241	/* "XDBA" in native byte order */
+#define XFDASHBOARD_APPLICATION_DATABASE_SNAPSHOT_VERSION	1
+#define XFDASHBOARD_APPLICATION_DATABASE_SNAPSHOT_FORMAT	"(uusa(ssxasasasav))"
 
 /* Single instance of application database */
 static XfdashboardApplicationDatabase*		_xfdashboard_application_database=NULL;
@@ -96,8 +115,32 @@ struct _XfdashboardApplicationDatabaseFileMonitorData
 	guint				changedID;
 };
 
+typedef struct _XfdashboardApplicationDatabaseScanDirectory		XfdashboardApplicationDatabaseScanDirectory;
+struct _XfdashboardApplicationDatabaseScanDirectory
+{
+	gchar				*path;
+	gchar				*topLevelPath;
+	gint64				modified;
+	gboolean			hasModified;
+
+	GVariantBuilder		*subdirs;
+	GVariantBuilder		*invalids;
+	GVariantBuilder		*shadowed;
+	GVariantBuilder		*apps;
+};
+
+typedef struct _XfdashboardApplicationDatabaseParseJob			XfdashboardApplicationDatabaseParseJob;
+struct _XfdashboardApplicationDatabaseParseJob
+{
+	XfdashboardApplicationDatabaseScanDirectory	*directory;
+	gchar				*desktopID;
+	gchar				*path;
+	GVariant			*result;
+};
+
 /* Forward declarations */
 static gboolean _xfdashboard_application_database_load_application_menu(XfdashboardApplicationDatabase *self, GError **outError);
+static void _xfdashboard_application_database_snapshot_invalidate(XfdashboardApplicationDatabase *self, GFile *inPath);
 
 /* Callback function for hash table iterator to add each value to a list of type GList */
 static void _xfdashboard_application_database_add_hashtable_item_to_list(gpointer inKey,
@@ -270,6 +313,9 @@ static void _xfdashboard_application_database_on_file_monitor_changed(Xfdashboar
 		return;
 	}
 
+	/* Content of monitored directory has changed so its snapshot is outdated */
+	_xfdashboard_application_database_snapshot_invalidate(self, monitorData->path);
+
 	/* Get file path */
 	filePath=g_file_get_path(inFile);
 
@@ -690,261 +736,321 @@ static void _xfdashboard_application_database_on_file_monitor_changed(Xfdashboar
 	if(filePath) g_free(filePath);
 }
 
-/* Load installed and user-overidden application desktop files */
-static gboolean _xfdashboard_application_database_load_applications_recursive(XfdashboardApplicationDatabase *self,
-																				GFile *inTopLevelPath,
-																				GFile *inCurrentPath,
-																				GHashTable **ioDesktopAppInfos,
-																				GList **ioFileMonitors,
-																				GError **outError)
+/* Get path to snapshot file of application database.
+ * Caller must free returned path with g_free if not needed anymore.
+ */
+static gchar* _xfdashboard_application_database_snapshot_get_path(void)
 {
-	XfdashboardApplicationDatabasePrivate			*priv G_GNUC_UNUSED;
-	gchar											*topLevelPath;
-	gchar											*path;
-	GFileEnumerator									*enumerator;
-	GFileInfo										*info;
-	XfdashboardApplicationDatabaseFileMonitorData	*monitorData;
-	GError											*error;
-
-	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self), FALSE);
-	g_return_val_if_fail(G_IS_FILE(inTopLevelPath), FALSE);
-	g_return_val_if_fail(G_IS_FILE(inCurrentPath), FALSE);
-	g_return_val_if_fail(ioDesktopAppInfos && *ioDesktopAppInfos, FALSE);
-	g_return_val_if_fail(ioFileMonitors, FALSE);
+	return(g_build_filename(g_get_user_cache_dir(), "xfdashboard", XFDASHBOARD_APPLICATION_DATABASE_SNAPSHOT_FILE, NULL));
+}
 
-	priv=self->priv;
-	error=NULL;
+/* Get manifest of snapshot which covers everything the parsed desktop files
+ * depend on besides their content, i.e. the version of this library, the
+ * languages used to translate names and the desktop environment used to
+ * determine the visibility of applications.
+ * Caller must free returned string with g_free if not needed anymore.
+ */
+static gchar* _xfdashboard_application_database_snapshot_get_manifest(void)
+{
+	gchar									*languages;
+	gchar									*manifest;
 
-	/* Get path of current path to scan for desktop files */
-	path=g_file_get_path(inCurrentPath);
-	topLevelPath=g_file_get_path(inTopLevelPath);
+	languages=g_strjoinv(":", (gchar**)g_get_language_names());
+	manifest=g_strdup_printf("%s\n%s\n%s",
+								PACKAGE_VERSION,
+								languages,
+								garcon_get_environment() ? garcon_get_environment() : "");
+	g_free(languages);
 
-	XFDASHBOARD_DEBUG(self, APPLICATIONS,
-						"Scanning directory '%s' for search path '%s'",
-						path,
-						topLevelPath);
+	return(manifest);
+}
 
-	/* Create enumerator for current path to iterate through path and
-	 * searching for desktop files.
-	 */
-	enumerator=g_file_enumerate_children(inCurrentPath,
-											G_FILE_ATTRIBUTE_STANDARD_TYPE "," G_FILE_ATTRIBUTE_STANDARD_NAME,
-											G_FILE_QUERY_INFO_NONE,
-											NULL,
-											&error);
-	if(!enumerator)
-	{
-		/* Propagate error */
-		g_propagate_error(outError, error);
+/* Get modification time (in microseconds) of a directory */
+static gboolean _xfdashboard_application_database_snapshot_get_modified(GFile *inPath, gint64 *outModified)
+{
+	GFileInfo								*info;
 
-		/* Release allocated resources */
-		if(path) g_free(path);
-		if(topLevelPath) g_free(topLevelPath);
+	g_return_val_if_fail(G_IS_FILE(inPath), FALSE);
+	g_return_val_if_fail(outModified, FALSE);
 
-		return(FALSE);
-	}
+	info=g_file_query_info(inPath,
+							G_FILE_ATTRIBUTE_TIME_MODIFIED ","
+							G_FILE_ATTRIBUTE_TIME_MODIFIED_USEC,
+							G_FILE_QUERY_INFO_NONE,
+							NULL,
+							NULL);
+	if(!info) return(FALSE);
 
-	/* Iterate through files in current path recursively and for each
-	 * desktop file found create a desktop app info object but only
-	 * if it is the first occurence of that desktop ID in hash table.
-	 */
-	while((info=g_file_enumerator_next_file(enumerator, NULL, &error)))
-	{
-		/* If current file is a directory call this function recursively
-		 * with absolute path to directory.
-		 */
-		if(g_file_info_get_file_type(info)==G_FILE_TYPE_DIRECTORY)
-		{
-			GFile							*childPath;
-			gboolean						childSuccess;
+	*outModified=(gint64)g_file_info_get_attribute_uint64(info, G_FILE_ATTRIBUTE_TIME_MODIFIED)*G_USEC_PER_SEC;
+	*outModified+=g_file_info_get_attribute_uint32(info, G_FILE_ATTRIBUTE_TIME_MODIFIED_USEC);
 
-			XFDASHBOARD_DEBUG(self, APPLICATIONS,
-								"Suspend scanning directory '%s' at search path '%s' for sub-directory '%s'",
-								path,
-								topLevelPath,
-								g_file_info_get_name(info));
+	g_object_unref(info);
 
-			childPath=g_file_resolve_relative_path(inCurrentPath,
-													g_file_info_get_name(info));
-			if(!childPath)
-			{
-				XFDASHBOARD_DEBUG(self, APPLICATIONS,
-									"Unable to build path to search for desktop files for path='%s' and file='%s'",
-									path,
-									g_file_info_get_name(info));
+	return(TRUE);
+}
 
-				/* Set error */
-				g_set_error(outError,
-								G_IO_ERROR,
-								G_IO_ERROR_FAILED,
-								_("Unable to build path to '%s%s%s' to search for desktop files"),
-								path,
-								G_DIR_SEPARATOR_S,
-								g_file_info_get_name(info));
+/* Load snapshot of application database taken at the last time the desktop
+ * files were scanned. The snapshot file is mapped into memory and a hash table
+ * mapping the path of each scanned directory to the snapshot of this directory
+ * is returned. If no valid snapshot exists NULL is returned.
+ */
+static GHashTable* _xfdashboard_application_database_snapshot_load(XfdashboardApplicationDatabase *self)
+{
+	gchar									*snapshotFile;
+	GMappedFile								*mappedFile;
+	GVariant								*snapshot;
+	guint32									magic;
+	guint32									version;
+	const gchar								*snapshotManifest;
+	gchar									*manifest;
+	GVariant								*directories;
+	GVariant								*directory;
+	GVariantIter							iter;
+	const gchar								*directoryPath;
+	GHashTable								*snapshotDirectories;
+	GError									*error;
 
-				/* Release allocated resources */
-				if(path) g_free(path);
-				if(topLevelPath) g_free(topLevelPath);
-				if(enumerator) g_object_unref(enumerator);
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self), NULL);
 
-				return(FALSE);
-			}
+	snapshotDirectories=NULL;
+	error=NULL;
 
-			childSuccess=_xfdashboard_application_database_load_applications_recursive(self,
-																						inTopLevelPath,
-																						childPath,
-																						ioDesktopAppInfos,
-																						ioFileMonitors,
-																						&error);
-			if(!childSuccess)
-			{
-				XFDASHBOARD_DEBUG(self, APPLICATIONS,
-									"Unable to iterate desktop files at %s%s%s",
-									path,
-									G_DIR_SEPARATOR_S,
-									g_file_info_get_name(info));
+	/* Map snapshot file into memory */
+	snapshotFile=_xfdashboard_application_database_snapshot_get_path();
+	mappedFile=g_mapped_file_new(snapshotFile, FALSE, &error);
+	if(!mappedFile)
+	{
+		XFDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Could not map snapshot of application database %s: %s",
+							snapshotFile,
+							error ? error->message : "Unknown error");
 
-				/* Propagate error */
-				g_propagate_error(outError, error);
+		/* Release allocated resources */
+		if(error) g_error_free(error);
+		g_free(snapshotFile);
 
-				/* Release allocated resources */
-				if(childPath) g_object_unref(childPath);
-				if(path) g_free(path);
-				if(topLevelPath) g_free(topLevelPath);
-				if(enumerator) g_object_unref(enumerator);
+		return(NULL);
+	}
 
-				return(FALSE);
-			}
+	/* The mapped file is owned by the variant from now on and the data is not
+	 * trusted so any corruption results in default values but never in reading
+	 * beyond mapped memory.
+	 */
+	snapshot=g_variant_new_from_data(G_VARIANT_TYPE(XFDASHBOARD_APPLICATION_DATABASE_SNAPSHOT_FORMAT),
+										g_mapped_file_get_contents(mappedFile),
+										g_mapped_file_get_length(mappedFile),
+										FALSE,
+										(GDestroyNotify)g_mapped_file_unref,
+										mappedFile);
+	g_variant_ref_sink(snapshot);
+
+	g_variant_get(snapshot,
+					"(uu&s@a(ssxasasasav))",
+					&magic,
+					&version,
+					&snapshotManifest,
+					&directories);
+
+	/* Check that snapshot was created by this version in the same environment */
+	manifest=_xfdashboard_application_database_snapshot_get_manifest();
+	if(magic==XFDASHBOARD_APPLICATION_DATABASE_SNAPSHOT_MAGIC &&
+		version==XFDASHBOARD_APPLICATION_DATABASE_SNAPSHOT_VERSION &&
+		g_strcmp0(snapshotManifest, manifest)==0)
+	{
+		snapshotDirectories=g_hash_table_new_full(g_str_hash,
+													g_str_equal,
+													g_free,
+													(GDestroyNotify)g_variant_unref);
 
-			/* Release allocated resources */
-			if(childPath) g_object_unref(childPath);
+		g_variant_iter_init(&iter, directories);
+		while((directory=g_variant_iter_next_value(&iter)))
+		{
+			g_variant_get_child(directory, 0, "&s", &directoryPath);
+			g_hash_table_insert(snapshotDirectories, g_strdup(directoryPath), directory);
+		}
 
+		XFDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Loaded snapshot of application database %s with %u directories",
+							snapshotFile,
+							g_hash_table_size(snapshotDirectories));
+	}
+		else
+		{
 			XFDASHBOARD_DEBUG(self, APPLICATIONS,
-								"Resume scanning directory '%s' at search path '%s'",
-								path,
-								topLevelPath);
+								"Ignoring outdated snapshot of application database %s",
+								snapshotFile);
 		}
 
-		/* If current file is a regular file and if it is a desktop file
-		 * then create desktop app info object if it is the first occurence
-		 * of this desktop ID in hash table.
-		 */
-		if(g_file_info_get_file_type(info)==G_FILE_TYPE_REGULAR &&
-			g_str_has_suffix(g_file_info_get_name(info), ".desktop"))
-		{
-			const gchar								*childName;
-			GFile									*childFile;
-			gchar									*desktopID;
+	/* Release allocated resources */
+	g_free(manifest);
+	g_variant_unref(directories);
+	g_variant_unref(snapshot);
+	g_free(snapshotFile);
 
-			/* Get file of current enumerated file */
-			childName=g_file_info_get_name(info);
-			childFile=g_file_get_child(g_file_enumerator_get_container(enumerator), childName);
+	return(snapshotDirectories);
+}
 
-			/* Determine desktop ID for file */
-			desktopID=g_file_get_relative_path(inTopLevelPath, childFile);
-			if(desktopID)
-			{
-				gchar								*iter;
+/* Check if all directories were restored from snapshot and none has vanished */
+static gboolean _xfdashboard_application_database_snapshot_is_unchanged(GHashTable *inSnapshot,
+																			GHashTable *inSnapshotDirectories)
+{
+	GHashTableIter							iter;
+	const gchar								*path;
+	GVariant								*directory;
 
-				iter=desktopID;
-				while(*iter)
-				{
-					/* Replace directory sepearator with dash if needed */
-					if(*iter==G_DIR_SEPARATOR) *iter='-';
+	g_return_val_if_fail(inSnapshotDirectories, FALSE);
 
-					/* Continue with next character in desktop ID */
-					iter++;
-				}
-			}
-				else
-				{
-					g_warning(_("Could not determine desktop ID for '%s'"),
-								g_file_info_get_name(info));
-				}
+	if(!inSnapshot ||
+		g_hash_table_size(inSnapshot)!=g_hash_table_size(inSnapshotDirectories))
+	{
+		return(FALSE);
+	}
 
-			/* If no desktop app info with determined desktop ID exists
-			 * then create it now.
-			 */
-			if(desktopID &&
-				!g_hash_table_lookup_extended(*ioDesktopAppInfos,
-												desktopID,
-												NULL,
-												NULL))
-			{
-				XfdashboardDesktopAppInfo			*appInfo;
+	/* Restored directories share the variant of snapshot loaded */
+	g_hash_table_iter_init(&iter, inSnapshotDirectories);
+	while(g_hash_table_iter_next(&iter, (gpointer*)&path, (gpointer*)&directory))
+	{
+		if(g_hash_table_lookup(inSnapshot, path)!=directory) return(FALSE);
+	}
 
-				appInfo=XFDASHBOARD_DESKTOP_APP_INFO(g_object_new(XFDASHBOARD_TYPE_DESKTOP_APP_INFO,
-																	"desktop-id", desktopID,
-																	"file", childFile,
-																	NULL));
-				if(xfdashboard_desktop_app_info_is_valid(appInfo))
-				{
-					g_hash_table_insert(*ioDesktopAppInfos, g_strdup(desktopID), g_object_ref(appInfo));
+	return(TRUE);
+}
 
-					XFDASHBOARD_DEBUG(self, APPLICATIONS,
-										"Found desktop file '%s%s%s' with desktop ID '%s' at search path '%s'",
-										path,
-										G_DIR_SEPARATOR_S,
-										childName,
-										desktopID,
-										topLevelPath);
-				}
-					else
-					{
-						/* Although desktop file for desktop ID is invalid, add
-						 * it to the database to prevent that a valid desktop file
-						 * for the same desktop ID will be found at path of lower
-						 * prioritory which will then be store in the database as
-						 * no entry exists. The first entry found - valid or invalid -
-						 * has the highest priority. Later the caller has to ensure
-						 * that all invalid desktop IDs in the database will be removed.
-						 */
-						g_hash_table_insert(*ioDesktopAppInfos, g_strdup(desktopID), g_object_ref(appInfo));
+/* Write snapshot of all scanned directories of application database */
+static void _xfdashboard_application_database_snapshot_save(XfdashboardApplicationDatabase *self)
+{
+	XfdashboardApplicationDatabasePrivate	*priv;
+	GVariantBuilder							directoriesBuilder;
+	GHashTableIter							iter;
+	GVariant								*directory;
+	gchar									*manifest;
+	GVariant								*snapshot;
+	gchar									*snapshotFile;
+	gchar									*snapshotPath;
+	GError									*error;
 
-						XFDASHBOARD_DEBUG(self, APPLICATIONS,
-											"Adding and mark invalid desktop file '%s%s%s' with desktop ID '%s' at search path '%s'",
-											path,
-											G_DIR_SEPARATOR_S,
-											childName,
-											desktopID,
-											topLevelPath);
-					}
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
 
-				g_object_unref(appInfo);
-			}
+	priv=self->priv;
+	error=NULL;
 
-			/* Release allocated resources */
-			if(desktopID) g_free(desktopID);
-			if(childFile) g_object_unref(childFile);
-		}
+	if(!priv->snapshotDirectories) return;
 
-		g_object_unref(info);
+	/* Build snapshot */
+	g_variant_builder_init(&directoriesBuilder, G_VARIANT_TYPE("a(ssxasasasav)"));
+
+	g_hash_table_iter_init(&iter, priv->snapshotDirectories);
+	while(g_hash_table_iter_next(&iter, NULL, (gpointer*)&directory))
+	{
+		g_variant_builder_add_value(&directoriesBuilder, directory);
 	}
 
-	if(error)
+	manifest=_xfdashboard_application_database_snapshot_get_manifest();
+	snapshot=g_variant_new(XFDASHBOARD_APPLICATION_DATABASE_SNAPSHOT_FORMAT,
+							XFDASHBOARD_APPLICATION_DATABASE_SNAPSHOT_MAGIC,
+							XFDASHBOARD_APPLICATION_DATABASE_SNAPSHOT_VERSION,
+							manifest,
+							&directoriesBuilder);
+	g_variant_ref_sink(snapshot);
+	g_free(manifest);
+
+	/* Write snapshot */
+	snapshotFile=_xfdashboard_application_database_snapshot_get_path();
+	snapshotPath=g_path_get_dirname(snapshotFile);
+
+	if(g_mkdir_with_parents(snapshotPath, 0700)<0 ||
+		!g_file_set_contents(snapshotFile,
+								g_variant_get_data(snapshot),
+								g_variant_get_size(snapshot),
+								&error))
 	{
-		/* Propagate error */
-		g_propagate_error(outError, error);
+		g_warning(_("Could not write snapshot of application database %s: %s"),
+					snapshotFile,
+					error ? error->message : _("Unknown error"));
+	}
+		else
+		{
+			XFDASHBOARD_DEBUG(self, APPLICATIONS,
+								"Wrote snapshot of application database %s with %u directories",
+								snapshotFile,
+								g_hash_table_size(priv->snapshotDirectories));
+		}
 
-		/* Release allocated resources */
-		if(path) g_free(path);
-		if(topLevelPath) g_free(topLevelPath);
-		if(enumerator) g_object_unref(enumerator);
+	/* Release allocated resources */
+	if(error) g_error_free(error);
+	g_free(snapshotPath);
+	g_free(snapshotFile);
+	g_variant_unref(snapshot);
+}
 
-		return(FALSE);
+/* Remove a directory from snapshot, e.g. because content of directory has
+ * changed, so it will be scanned again the next time the application
+ * database is loaded.
+ */
+static void _xfdashboard_application_database_snapshot_invalidate(XfdashboardApplicationDatabase *self,
+																	GFile *inPath)
+{
+	XfdashboardApplicationDatabasePrivate			*priv;
+	gchar											*path;
+	GList											*iter;
+	XfdashboardApplicationDatabaseScanDirectory		*directory;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(G_IS_FILE(inPath));
+
+	priv=self->priv;
+
+	path=g_file_get_path(inPath);
+	if(!path) return;
+
+	/* Do not take a snapshot of directory if its desktop files are still parsed */
+	for(iter=priv->scanDirectories; iter; iter=g_list_next(iter))
+	{
+		directory=(XfdashboardApplicationDatabaseScanDirectory*)iter->data;
+		if(g_strcmp0(directory->path, path)==0) directory->hasModified=FALSE;
 	}
 
-	/* Iterating through given path was successful so create file monitor
-	 * for this path.
+	/* Only write snapshot if directory was part of it. So snapshot is written
+	 * at most once for each directory no matter how many changes happen.
 	 */
-	monitorData=_xfdashboard_application_database_monitor_data_new(inCurrentPath);
-	if(!monitorData)
+	if(priv->snapshotDirectories &&
+		g_hash_table_remove(priv->snapshotDirectories, path))
 	{
 		XFDASHBOARD_DEBUG(self, APPLICATIONS,
-							"Failed to create data object for file monitor for path '%s'",
+							"Removed changed directory '%s' from snapshot of application database",
 							path);
 
-		/* Set error */
+		_xfdashboard_application_database_snapshot_save(self);
+	}
+	g_free(path);
+}
+
+/* Create file monitor for a scanned directory and add it to list of file monitors */
+static gboolean _xfdashboard_application_database_add_file_monitor(XfdashboardApplicationDatabase *self,
+																	GFile *inPath,
+																	GList **ioFileMonitors,
+																	GError **outError)
+{
+	XfdashboardApplicationDatabaseFileMonitorData	*monitorData;
+	gchar											*path;
+	GError											*error;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self), FALSE);
+	g_return_val_if_fail(G_IS_FILE(inPath), FALSE);
+	g_return_val_if_fail(ioFileMonitors, FALSE);
+
+	error=NULL;
+
+	path=g_file_get_path(inPath);
+
+	monitorData=_xfdashboard_application_database_monitor_data_new(inPath);
+	if(!monitorData)
+	{
+		XFDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Failed to create data object for file monitor for path '%s'",
+							path);
+
+		/* Set error */
 		g_set_error(outError,
 						G_IO_ERROR,
 						G_IO_ERROR_FAILED,
@@ -953,13 +1059,11 @@ static gboolean _xfdashboard_application_database_load_applications_recursive(Xf
 
 		/* Release allocated resources */
 		if(path) g_free(path);
-		if(topLevelPath) g_free(topLevelPath);
-		if(enumerator) g_object_unref(enumerator);
 
 		return(FALSE);
 	}
 
-	monitorData->monitor=g_file_monitor(inCurrentPath, G_FILE_MONITOR_NONE, NULL, &error);
+	monitorData->monitor=g_file_monitor(inPath, G_FILE_MONITOR_NONE, NULL, &error);
 	if(!monitorData->monitor && error)
 	{
 #if defined(__unix__)
@@ -980,10 +1084,7 @@ static gboolean _xfdashboard_application_database_load_applications_recursive(Xf
 
 		/* Release allocated resources */
 		if(monitorData) _xfdashboard_application_database_monitor_data_free(monitorData);
-
 		if(path) g_free(path);
-		if(topLevelPath) g_free(topLevelPath);
-		if(enumerator) g_object_unref(enumerator);
 
 		return(FALSE);
 #endif
@@ -1008,6 +1109,782 @@ static gboolean _xfdashboard_application_database_load_applications_recursive(Xf
 								path);
 		}
 
+	/* Release allocated resources */
+	if(path) g_free(path);
+
+	return(TRUE);
+}
+
+/* Create a new data structure for a directory scanned for desktop files */
+static XfdashboardApplicationDatabaseScanDirectory* _xfdashboard_application_database_scan_directory_new(const gchar *inPath,
+																											const gchar *inTopLevelPath,
+																											gint64 inModified,
+																											gboolean inHasModified)
+{
+	XfdashboardApplicationDatabaseScanDirectory		*directory;
+
+	g_return_val_if_fail(inPath && *inPath, NULL);
+	g_return_val_if_fail(inTopLevelPath && *inTopLevelPath, NULL);
+
+	directory=g_new0(XfdashboardApplicationDatabaseScanDirectory, 1);
+	directory->path=g_strdup(inPath);
+	directory->topLevelPath=g_strdup(inTopLevelPath);
+	directory->modified=inModified;
+	directory->hasModified=inHasModified;
+	directory->subdirs=g_variant_builder_new(G_VARIANT_TYPE("as"));
+	directory->invalids=g_variant_builder_new(G_VARIANT_TYPE("as"));
+	directory->shadowed=g_variant_builder_new(G_VARIANT_TYPE("as"));
+	directory->apps=g_variant_builder_new(G_VARIANT_TYPE("av"));
+
+	return(directory);
+}
+
+/* Free a data structure of a scanned directory */
+static void _xfdashboard_application_database_scan_directory_free(XfdashboardApplicationDatabaseScanDirectory *inData)
+{
+	g_return_if_fail(inData);
+
+	/* Release each data in scanned directory structure */
+	if(inData->path) g_free(inData->path);
+	if(inData->topLevelPath) g_free(inData->topLevelPath);
+	if(inData->subdirs) g_variant_builder_unref(inData->subdirs);
+	if(inData->invalids) g_variant_builder_unref(inData->invalids);
+	if(inData->shadowed) g_variant_builder_unref(inData->shadowed);
+	if(inData->apps) g_variant_builder_unref(inData->apps);
+
+	/* Release allocated memory */
+	g_free(inData);
+}
+
+/* Free a data structure of a desktop file to parse */
+static void _xfdashboard_application_database_parse_job_free(XfdashboardApplicationDatabaseParseJob *inData)
+{
+	g_return_if_fail(inData);
+
+	/* Release each data in parse job structure but not the scanned directory
+	 * it belongs to as it is shared by all desktop files in that directory.
+	 */
+	if(inData->desktopID) g_free(inData->desktopID);
+	if(inData->path) g_free(inData->path);
+	if(inData->result) g_variant_unref(inData->result);
+
+	/* Release allocated memory */
+	g_free(inData);
+}
+
+/* Take snapshot of all scanned directories as all their desktop files are
+ * parsed now and write snapshot if anything has changed.
+ */
+static void _xfdashboard_application_database_finish_parsing(XfdashboardApplicationDatabase *self)
+{
+	XfdashboardApplicationDatabasePrivate			*priv;
+	GList											*iter;
+	XfdashboardApplicationDatabaseScanDirectory		*directory;
+	GVariant										*snapshotDirectory;
+	gboolean										needsSave;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
+
+	priv=self->priv;
+
+	/* Thread pool is not needed anymore */
+	if(priv->parsePool)
+	{
+		g_thread_pool_free(priv->parsePool, FALSE, TRUE);
+		priv->parsePool=NULL;
+	}
+
+	/* Take snapshot of each scanned directory if its modification time is known
+	 * and it was not modified while its desktop files were parsed.
+	 */
+	needsSave=priv->snapshotNeedsSave;
+	for(iter=priv->scanDirectories; iter; iter=g_list_next(iter))
+	{
+		directory=(XfdashboardApplicationDatabaseScanDirectory*)iter->data;
+		if(!directory->hasModified || !priv->snapshotDirectories) continue;
+
+		snapshotDirectory=g_variant_new("(ssxasasasav)",
+											directory->path,
+											directory->topLevelPath,
+											directory->modified,
+											directory->subdirs,
+											directory->invalids,
+											directory->shadowed,
+											directory->apps);
+		g_hash_table_insert(priv->snapshotDirectories, g_strdup(directory->path), g_variant_ref_sink(snapshotDirectory));
+		needsSave=TRUE;
+	}
+
+	if(priv->scanDirectories)
+	{
+		g_list_free_full(priv->scanDirectories, (GDestroyNotify)_xfdashboard_application_database_scan_directory_free);
+		priv->scanDirectories=NULL;
+	}
+
+	if(needsSave) _xfdashboard_application_database_snapshot_save(self);
+	priv->snapshotNeedsSave=FALSE;
+
+	XFDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Finished parsing %u desktop files - application database contains %u applications",
+						priv->parseJobsTotal,
+						priv->applications ? g_hash_table_size(priv->applications) : 0);
+
+	/* Emit signal that all desktop files were parsed and added to database */
+	g_signal_emit(self, XfdashboardApplicationDatabaseSignals[SIGNAL_APPLICATION_DATABASE_LOADED], 0, priv->parseJobsDone, priv->parseJobsTotal);
+}
+
+/* Stop parsing desktop files, e.g. because database is reloaded or disposed */
+static void _xfdashboard_application_database_cancel_parsing(XfdashboardApplicationDatabase *self)
+{
+	XfdashboardApplicationDatabasePrivate			*priv;
+	XfdashboardApplicationDatabaseParseJob			*job;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
+
+	priv=self->priv;
+
+	/* Let worker threads skip all remaining desktop files and wait for them.
+	 * Each job is pushed to queue of parsed jobs anyway so it can be freed here.
+	 */
+	if(priv->parsePool)
+	{
+		g_atomic_int_set(&priv->parseCancelled, TRUE);
+		g_thread_pool_free(priv->parsePool, FALSE, TRUE);
+		priv->parsePool=NULL;
+		g_atomic_int_set(&priv->parseCancelled, FALSE);
+	}
+
+	if(priv->parsedJobs)
+	{
+		while((job=g_async_queue_try_pop(priv->parsedJobs)))
+		{
+			_xfdashboard_application_database_parse_job_free(job);
+		}
+	}
+
+	if(priv->scanDirectories)
+	{
+		g_list_free_full(priv->scanDirectories, (GDestroyNotify)_xfdashboard_application_database_scan_directory_free);
+		priv->scanDirectories=NULL;
+	}
+
+	priv->parseJobsTotal=0;
+	priv->parseJobsDone=0;
+	priv->snapshotNeedsSave=FALSE;
+}
+
+/* Add parsed desktop file to database. Must be called at main thread. */
+static void _xfdashboard_application_database_merge_parse_job(XfdashboardApplicationDatabase *self,
+																XfdashboardApplicationDatabaseParseJob *inJob)
+{
+	XfdashboardApplicationDatabasePrivate			*priv;
+	GAppInfo										*appInfo;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self));
+	g_return_if_fail(inJob);
+
+	priv=self->priv;
+
+	/* Remember invalid desktop file for snapshot */
+	if(!inJob->result)
+	{
+		g_variant_builder_add(inJob->directory->invalids, "s", inJob->desktopID);
+		return;
+	}
+
+	g_variant_builder_add(inJob->directory->apps, "v", inJob->result);
+
+	/* Do not replace desktop app info for same desktop ID which was added
+	 * by file monitors in the meantime.
+	 */
+	if(!priv->applications ||
+		g_hash_table_lookup_extended(priv->applications, inJob->desktopID, NULL, NULL))
+	{
+		XFDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Ignoring parsed desktop file '%s' for already known desktop ID '%s'",
+							inJob->path,
+							inJob->desktopID);
+		return;
+	}
+
+	/* Create desktop app info from parsed desktop file and add it to database */
+	appInfo=xfdashboard_desktop_app_info_new_from_variant(inJob->result);
+	if(!appInfo) return;
+
+	g_hash_table_insert(priv->applications, g_strdup(inJob->desktopID), appInfo);
+
+	XFDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Adding parsed desktop file '%s' with desktop ID '%s'",
+						inJob->path,
+						inJob->desktopID);
+
+	/* Emit signal that an application has been added to hash table */
+	g_signal_emit(self, XfdashboardApplicationDatabaseSignals[SIGNAL_APPLICATION_ADDED], 0, appInfo);
+}
+
+/* Add all desktop files parsed so far to database at main loop */
+static gboolean _xfdashboard_application_database_on_merge_parsed_jobs(gpointer inUserData)
+{
+	XfdashboardApplicationDatabase					*self;
+	XfdashboardApplicationDatabasePrivate			*priv;
+	XfdashboardApplicationDatabaseParseJob			*job;
+	guint											count;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(inUserData), G_SOURCE_REMOVE);
+
+	self=XFDASHBOARD_APPLICATION_DATABASE(inUserData);
+	priv=self->priv;
+
+	/* Reset flag before queue is emptied so worker threads schedule this
+	 * function again for any job pushed from now on.
+	 */
+	g_atomic_int_set(&priv->parsedJobsScheduled, FALSE);
+
+	count=0;
+	while((job=g_async_queue_try_pop(priv->parsedJobs)))
+	{
+		_xfdashboard_application_database_merge_parse_job(self, job);
+		_xfdashboard_application_database_parse_job_free(job);
+
+		priv->parseJobsDone++;
+		count++;
+	}
+
+	/* Tell about progress or finish if all desktop files were parsed */
+	if(count>0)
+	{
+		if(priv->parseJobsDone>=priv->parseJobsTotal)
+		{
+			_xfdashboard_application_database_finish_parsing(self);
+		}
+			else
+			{
+				g_signal_emit(self, XfdashboardApplicationDatabaseSignals[SIGNAL_APPLICATION_DATABASE_LOADED], 0, priv->parseJobsDone, priv->parseJobsTotal);
+			}
+	}
+
+	return(G_SOURCE_REMOVE);
+}
+
+/* Parse a desktop file queued for parsing. This function is called at a worker
+ * thread of thread pool, so it must neither create any object nor touch the
+ * database. It only produces the plain data which is added to database at
+ * main loop.
+ */
+static void _xfdashboard_application_database_parse_job_run(gpointer inData, gpointer inUserData)
+{
+	XfdashboardApplicationDatabase					*self;
+	XfdashboardApplicationDatabasePrivate			*priv;
+	XfdashboardApplicationDatabaseParseJob			*job;
+	GError											*error;
+
+	self=XFDASHBOARD_APPLICATION_DATABASE(inUserData);
+	priv=self->priv;
+	job=(XfdashboardApplicationDatabaseParseJob*)inData;
+	error=NULL;
+
+	/* Parse desktop file if parsing was not cancelled */
+	if(!g_atomic_int_get(&priv->parseCancelled))
+	{
+		job->result=xfdashboard_desktop_app_info_parse_file(job->desktopID, job->path, &error);
+		if(job->result)
+		{
+			g_variant_ref_sink(job->result);
+		}
+			else
+			{
+				XFDASHBOARD_DEBUG(self, APPLICATIONS,
+									"Marking desktop file '%s' with desktop ID '%s' invalid: %s",
+									job->path,
+									job->desktopID,
+									error ? error->message : "Unknown error");
+				if(error) g_error_free(error);
+			}
+	}
+
+	/* Hand over job to main loop */
+	g_async_queue_push(priv->parsedJobs, job);
+	if(g_atomic_int_compare_and_exchange(&priv->parsedJobsScheduled, FALSE, TRUE))
+	{
+		g_idle_add_full(G_PRIORITY_DEFAULT_IDLE,
+						_xfdashboard_application_database_on_merge_parsed_jobs,
+						g_object_ref(self),
+						g_object_unref);
+	}
+}
+
+/* Restore desktop app infos of a directory from its snapshot. The snapshot
+ * can only be used if directory was not modified since snapshot was taken and
+ * if all desktop IDs which were shadowed by desktop files of higher priority
+ * at that time are still shadowed. Otherwise FALSE is returned and the
+ * directory has to be scanned.
+ */
+static gboolean _xfdashboard_application_database_restore_directory(XfdashboardApplicationDatabase *self,
+																		GFile *inTopLevelPath,
+																		gint64 inModified,
+																		GVariant *inSnapshotDirectory,
+																		GHashTable **ioDesktopAppInfos)
+{
+	const gchar										*path;
+	const gchar										*snapshotTopLevelPath;
+	gint64											snapshotModified;
+	GVariant										*invalids;
+	GVariant										*shadowed;
+	GVariant										*apps;
+	GVariantIter									iter;
+	const gchar										*desktopID;
+	GVariant										*appVariant;
+	GAppInfo										*appInfo;
+	gchar											*topLevelPath;
+	gboolean										isValid;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self), FALSE);
+	g_return_val_if_fail(G_IS_FILE(inTopLevelPath), FALSE);
+	g_return_val_if_fail(inSnapshotDirectory, FALSE);
+	g_return_val_if_fail(ioDesktopAppInfos && *ioDesktopAppInfos, FALSE);
+
+	g_variant_get(inSnapshotDirectory,
+					"(&s&sxas@as@as@av)",
+					&path,
+					&snapshotTopLevelPath,
+					&snapshotModified,
+					NULL,
+					&invalids,
+					&shadowed,
+					&apps);
+
+	/* Check that directory was not modified and belongs to same search path */
+	topLevelPath=g_file_get_path(inTopLevelPath);
+	isValid=(snapshotModified==inModified &&
+				g_strcmp0(snapshotTopLevelPath, topLevelPath)==0);
+	g_free(topLevelPath);
+
+	/* Check that all shadowed desktop IDs are still shadowed as they were
+	 * never parsed and are not contained in snapshot.
+	 */
+	g_variant_iter_init(&iter, shadowed);
+	while(isValid &&
+			g_variant_iter_next(&iter, "&s", &desktopID))
+	{
+		if(!g_hash_table_lookup_extended(*ioDesktopAppInfos, desktopID, NULL, NULL))
+		{
+			XFDASHBOARD_DEBUG(self, APPLICATIONS,
+								"Cannot use snapshot of directory '%s' because desktop ID '%s' is not shadowed anymore",
+								path,
+								desktopID);
+			isValid=FALSE;
+		}
+	}
+
+	/* Add desktop app infos from snapshot if it is the first occurence
+	 * of their desktop IDs in hash table.
+	 */
+	if(isValid)
+	{
+		g_variant_iter_init(&iter, apps);
+		while((appVariant=g_variant_iter_next_value(&iter)))
+		{
+			GVariant								*appData;
+
+			appData=g_variant_get_variant(appVariant);
+			appInfo=xfdashboard_desktop_app_info_new_from_variant(appData);
+			if(appInfo)
+			{
+				desktopID=g_app_info_get_id(appInfo);
+				if(desktopID &&
+					!g_hash_table_lookup_extended(*ioDesktopAppInfos, desktopID, NULL, NULL))
+				{
+					g_hash_table_insert(*ioDesktopAppInfos, g_strdup(desktopID), g_object_ref(appInfo));
+
+					XFDASHBOARD_DEBUG(self, APPLICATIONS,
+										"Restored desktop ID '%s' from snapshot of directory '%s'",
+										desktopID,
+										path);
+				}
+
+				g_object_unref(appInfo);
+			}
+
+			g_variant_unref(appData);
+			g_variant_unref(appVariant);
+		}
+
+		/* Add invalid desktop IDs as invalid desktop app infos to database to
+		 * keep the priority as done when scanning directory.
+		 */
+		g_variant_iter_init(&iter, invalids);
+		while(g_variant_iter_next(&iter, "&s", &desktopID))
+		{
+			if(!g_hash_table_lookup_extended(*ioDesktopAppInfos, desktopID, NULL, NULL))
+			{
+				g_hash_table_insert(*ioDesktopAppInfos,
+									g_strdup(desktopID),
+									g_object_new(XFDASHBOARD_TYPE_DESKTOP_APP_INFO,
+													"desktop-id", desktopID,
+													NULL));
+			}
+		}
+	}
+
+	/* Release allocated resources */
+	g_variant_unref(invalids);
+	g_variant_unref(shadowed);
+	g_variant_unref(apps);
+
+	return(isValid);
+}
+
+/* Load installed and user-overidden application desktop files */
+static gboolean _xfdashboard_application_database_load_applications_recursive(XfdashboardApplicationDatabase *self,
+																				GFile *inTopLevelPath,
+																				GFile *inCurrentPath,
+																				GHashTable **ioDesktopAppInfos,
+																				GList **ioFileMonitors,
+																				GHashTable *inSnapshot,
+																				GHashTable *ioSnapshotDirectories,
+																				GList **ioScanDirectories,
+																				GList **ioParseJobs,
+																				GError **outError)
+{
+	XfdashboardApplicationDatabasePrivate			*priv G_GNUC_UNUSED;
+	gchar											*topLevelPath;
+	gchar											*path;
+	gint64											modified;
+	gboolean										hasModified;
+	GVariant										*snapshotDirectory;
+	XfdashboardApplicationDatabaseScanDirectory		*directory;
+	GFileEnumerator									*enumerator;
+	GFileInfo										*info;
+	GError											*error;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_DATABASE(self), FALSE);
+	g_return_val_if_fail(G_IS_FILE(inTopLevelPath), FALSE);
+	g_return_val_if_fail(G_IS_FILE(inCurrentPath), FALSE);
+	g_return_val_if_fail(ioDesktopAppInfos && *ioDesktopAppInfos, FALSE);
+	g_return_val_if_fail(ioFileMonitors, FALSE);
+	g_return_val_if_fail(ioSnapshotDirectories, FALSE);
+	g_return_val_if_fail(ioScanDirectories, FALSE);
+	g_return_val_if_fail(ioParseJobs, FALSE);
+
+	priv=self->priv;
+	error=NULL;
+
+	/* Get path of current path to scan for desktop files */
+	path=g_file_get_path(inCurrentPath);
+	topLevelPath=g_file_get_path(inTopLevelPath);
+
+	/* Get modification time of current path before it is scanned. If it is
+	 * modified while scanning, the modification time will not match the next
+	 * time and the directory will be scanned again.
+	 */
+	hasModified=_xfdashboard_application_database_snapshot_get_modified(inCurrentPath, &modified);
+
+	/* Restore desktop app infos from snapshot if current path was not modified
+	 * since snapshot was taken. Then continue with its sub-directories as they
+	 * could have been modified independently.
+	 */
+	snapshotDirectory=NULL;
+	if(hasModified && inSnapshot && path) snapshotDirectory=g_hash_table_lookup(inSnapshot, path);
+
+	if(snapshotDirectory &&
+		_xfdashboard_application_database_restore_directory(self, inTopLevelPath, modified, snapshotDirectory, ioDesktopAppInfos))
+	{
+		GVariant									*subdirs;
+		GVariantIter								subdirsIter;
+		const gchar									*subdirName;
+		gboolean									success;
+
+		XFDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Restored directory '%s' for search path '%s' from snapshot",
+							path,
+							topLevelPath);
+
+		success=TRUE;
+
+		subdirs=g_variant_get_child_value(snapshotDirectory, 3);
+		g_variant_iter_init(&subdirsIter, subdirs);
+		while(success &&
+				g_variant_iter_next(&subdirsIter, "&s", &subdirName))
+		{
+			GFile									*childPath;
+
+			childPath=g_file_get_child(inCurrentPath, subdirName);
+			success=_xfdashboard_application_database_load_applications_recursive(self,
+																					inTopLevelPath,
+																					childPath,
+																					ioDesktopAppInfos,
+																					ioFileMonitors,
+																					inSnapshot,
+																					ioSnapshotDirectories,
+																					ioScanDirectories,
+																					ioParseJobs,
+																					&error);
+			g_object_unref(childPath);
+		}
+		g_variant_unref(subdirs);
+
+		/* Set up file monitor for current path and keep its snapshot */
+		if(success)
+		{
+			success=_xfdashboard_application_database_add_file_monitor(self, inCurrentPath, ioFileMonitors, &error);
+		}
+
+		if(success)
+		{
+			g_hash_table_insert(ioSnapshotDirectories, g_strdup(path), g_variant_ref(snapshotDirectory));
+		}
+			else
+			{
+				/* Propagate error */
+				g_propagate_error(outError, error);
+			}
+
+		/* Release allocated resources */
+		if(path) g_free(path);
+		if(topLevelPath) g_free(topLevelPath);
+
+		return(success);
+	}
+
+	XFDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Scanning directory '%s' for search path '%s'",
+						path,
+						topLevelPath);
+
+	/* Create enumerator for current path to iterate through path and
+	 * searching for desktop files.
+	 */
+	enumerator=g_file_enumerate_children(inCurrentPath,
+											G_FILE_ATTRIBUTE_STANDARD_TYPE "," G_FILE_ATTRIBUTE_STANDARD_NAME,
+											G_FILE_QUERY_INFO_NONE,
+											NULL,
+											&error);
+	if(!enumerator)
+	{
+		/* Propagate error */
+		g_propagate_error(outError, error);
+
+		/* Release allocated resources */
+		if(path) g_free(path);
+		if(topLevelPath) g_free(topLevelPath);
+
+		return(FALSE);
+	}
+
+	/* Collect everything needed to take a snapshot of current path. The
+	 * snapshot is taken when all desktop files found were parsed. The caller
+	 * takes care to release it.
+	 */
+	directory=_xfdashboard_application_database_scan_directory_new(path, topLevelPath, hasModified ? modified : 0, hasModified);
+	*ioScanDirectories=g_list_prepend(*ioScanDirectories, directory);
+
+	/* Iterate through files in current path recursively and for each
+	 * desktop file found queue it for parsing but only if it is the first
+	 * occurence of that desktop ID in hash table.
+	 */
+	while((info=g_file_enumerator_next_file(enumerator, NULL, &error)))
+	{
+		/* If current file is a directory call this function recursively
+		 * with absolute path to directory.
+		 */
+		if(g_file_info_get_file_type(info)==G_FILE_TYPE_DIRECTORY)
+		{
+			GFile							*childPath;
+			gboolean						childSuccess;
+
+			XFDASHBOARD_DEBUG(self, APPLICATIONS,
+								"Suspend scanning directory '%s' at search path '%s' for sub-directory '%s'",
+								path,
+								topLevelPath,
+								g_file_info_get_name(info));
+
+			childPath=g_file_resolve_relative_path(inCurrentPath,
+													g_file_info_get_name(info));
+			if(!childPath)
+			{
+				XFDASHBOARD_DEBUG(self, APPLICATIONS,
+									"Unable to build path to search for desktop files for path='%s' and file='%s'",
+									path,
+									g_file_info_get_name(info));
+
+				/* Set error */
+				g_set_error(outError,
+								G_IO_ERROR,
+								G_IO_ERROR_FAILED,
+								_("Unable to build path to '%s%s%s' to search for desktop files"),
+								path,
+								G_DIR_SEPARATOR_S,
+								g_file_info_get_name(info));
+
+				/* Release allocated resources */
+				if(path) g_free(path);
+				if(topLevelPath) g_free(topLevelPath);
+				if(enumerator) g_object_unref(enumerator);
+
+				return(FALSE);
+			}
+
+			childSuccess=_xfdashboard_application_database_load_applications_recursive(self,
+																						inTopLevelPath,
+																						childPath,
+																						ioDesktopAppInfos,
+																						ioFileMonitors,
+																						inSnapshot,
+																						ioSnapshotDirectories,
+																						ioScanDirectories,
+																						ioParseJobs,
+																						&error);
+			if(!childSuccess)
+			{
+				XFDASHBOARD_DEBUG(self, APPLICATIONS,
+									"Unable to iterate desktop files at %s%s%s",
+									path,
+									G_DIR_SEPARATOR_S,
+									g_file_info_get_name(info));
+
+				/* Propagate error */
+				g_propagate_error(outError, error);
+
+				/* Release allocated resources */
+				if(childPath) g_object_unref(childPath);
+				if(path) g_free(path);
+				if(topLevelPath) g_free(topLevelPath);
+				if(enumerator) g_object_unref(enumerator);
+
+				return(FALSE);
+			}
+
+			/* Remember sub-directory for snapshot */
+			g_variant_builder_add(directory->subdirs, "s", g_file_info_get_name(info));
+
+			/* Release allocated resources */
+			if(childPath) g_object_unref(childPath);
+
+			XFDASHBOARD_DEBUG(self, APPLICATIONS,
+								"Resume scanning directory '%s' at search path '%s'",
+								path,
+								topLevelPath);
+		}
+
+		/* If current file is a regular file and if it is a desktop file
+		 * then queue it for parsing if it is the first occurence of this
+		 * desktop ID in hash table.
+		 */
+		if(g_file_info_get_file_type(info)==G_FILE_TYPE_REGULAR &&
+			g_str_has_suffix(g_file_info_get_name(info), ".desktop"))
+		{
+			const gchar								*childName;
+			GFile									*childFile;
+			gchar									*desktopID;
+
+			/* Get file of current enumerated file */
+			childName=g_file_info_get_name(info);
+			childFile=g_file_get_child(g_file_enumerator_get_container(enumerator), childName);
+
+			/* Determine desktop ID for file */
+			desktopID=g_file_get_relative_path(inTopLevelPath, childFile);
+			if(desktopID)
+			{
+				gchar								*iter;
+
+				iter=desktopID;
+				while(*iter)
+				{
+					/* Replace directory sepearator with dash if needed */
+					if(*iter==G_DIR_SEPARATOR) *iter='-';
+
+					/* Continue with next character in desktop ID */
+					iter++;
+				}
+			}
+				else
+				{
+					g_warning(_("Could not determine desktop ID for '%s'"),
+								g_file_info_get_name(info));
+				}
+
+			/* If no desktop app info with determined desktop ID exists
+			 * then queue desktop file for parsing. Until it is parsed the
+			 * desktop ID is reserved by an invalid desktop app info to
+			 * prevent that a desktop file for the same desktop ID will be
+			 * found at path of lower priority. The first entry found - valid
+			 * or invalid - has the highest priority. Later the caller has to
+			 * ensure that all invalid desktop IDs in the database will be
+			 * removed.
+			 */
+			if(desktopID &&
+				!g_hash_table_lookup_extended(*ioDesktopAppInfos,
+												desktopID,
+												NULL,
+												NULL))
+			{
+				XfdashboardApplicationDatabaseParseJob	*job;
+
+				g_hash_table_insert(*ioDesktopAppInfos,
+									g_strdup(desktopID),
+									g_object_new(XFDASHBOARD_TYPE_DESKTOP_APP_INFO,
+													"desktop-id", desktopID,
+													NULL));
+
+				job=g_new0(XfdashboardApplicationDatabaseParseJob, 1);
+				job->directory=directory;
+				job->desktopID=g_strdup(desktopID);
+				job->path=g_file_get_path(childFile);
+				*ioParseJobs=g_list_prepend(*ioParseJobs, job);
+
+				XFDASHBOARD_DEBUG(self, APPLICATIONS,
+									"Queued desktop file '%s%s%s' with desktop ID '%s' at search path '%s' for parsing",
+									path,
+									G_DIR_SEPARATOR_S,
+									childName,
+									desktopID,
+									topLevelPath);
+			}
+				/* Desktop ID is shadowed by a desktop file of higher priority
+				 * so it is not parsed. Remember it for snapshot.
+				 */
+				else if(desktopID)
+				{
+					g_variant_builder_add(directory->shadowed, "s", desktopID);
+				}
+
+			/* Release allocated resources */
+			if(desktopID) g_free(desktopID);
+			if(childFile) g_object_unref(childFile);
+		}
+
+		g_object_unref(info);
+	}
+
+	if(error)
+	{
+		/* Propagate error */
+		g_propagate_error(outError, error);
+
+		/* Release allocated resources */
+		if(path) g_free(path);
+		if(topLevelPath) g_free(topLevelPath);
+		if(enumerator) g_object_unref(enumerator);
+
+		return(FALSE);
+	}
+
+	/* Iterating through given path was successful so create file monitor
+	 * for this path.
+	 */
+	if(!_xfdashboard_application_database_add_file_monitor(self, inCurrentPath, ioFileMonitors, &error))
+	{
+		/* Propagate error */
+		g_propagate_error(outError, error);
+
+		/* Release allocated resources */
+		if(path) g_free(path);
+		if(topLevelPath) g_free(topLevelPath);
+		if(enumerator) g_object_unref(enumerator);
+
+		return(FALSE);
+	}
+
 	XFDASHBOARD_DEBUG(self, APPLICATIONS,
 						"Finished scanning directory '%s' for search path '%s'",
 						path,
@@ -1027,6 +1904,10 @@ static gboolean _xfdashboard_application_database_load_applications(XfdashboardA
 	XfdashboardApplicationDatabasePrivate			*priv;
 	GHashTable										*apps;
 	GList											*fileMonitors;
+	GHashTable										*snapshot;
+	GHashTable										*snapshotDirectories;
+	GList											*scanDirectories;
+	GList											*parseJobs;
 	GError											*error;
 	GList											*iter;
 	XfdashboardApplicationDatabaseFileMonitorData	*monitorData;
@@ -1036,11 +1917,27 @@ static gboolean _xfdashboard_application_database_load_applications(XfdashboardA
 
 	priv=self->priv;
 	error=NULL;
+	scanDirectories=NULL;
+	parseJobs=NULL;
+
+	/* Stop parsing desktop files of a previous load */
+	_xfdashboard_application_database_cancel_parsing(self);
+
+	/* Load snapshot taken at the last time the desktop files were scanned
+	 * to restore all directories not modified since then without parsing
+	 * their desktop files again.
+	 */
+	snapshot=_xfdashboard_application_database_snapshot_load(self);
+	snapshotDirectories=g_hash_table_new_full(g_str_hash,
+												g_str_equal,
+												g_free,
+												(GDestroyNotify)g_variant_unref);
 
 	/* Iterate through enumerated files at each path in list of search paths
 	 * and add only the first occurence of each desktop ID. Also set up
 	 * file monitors to get notified if a desktop file changes, was removed
-	 * or a new one added.
+	 * or a new one added. Desktop files which could not be restored from
+	 * snapshot are only collected here and parsed afterwards.
 	 */
 	fileMonitors=NULL;
 	apps=g_hash_table_new_full(g_str_hash,
@@ -1065,7 +1962,7 @@ static gboolean _xfdashboard_application_database_load_applications(XfdashboardA
 		 * will fail also. But not all search path must exist so check.
 		 */
 		if(g_file_query_file_type(directory, G_FILE_QUERY_INFO_NONE, NULL)==G_FILE_TYPE_DIRECTORY &&
-			!_xfdashboard_application_database_load_applications_recursive(self, directory, directory, &apps, &fileMonitors, &error))
+			!_xfdashboard_application_database_load_applications_recursive(self, directory, directory, &apps, &fileMonitors, snapshot, snapshotDirectories, &scanDirectories, &parseJobs, &error))
 		{
 			/* Propagate error */
 			g_propagate_error(outError, error);
@@ -1074,6 +1971,10 @@ static gboolean _xfdashboard_application_database_load_applications(XfdashboardA
 			if(fileMonitors) g_list_free_full(fileMonitors, g_object_unref);
 			if(apps) g_hash_table_unref(apps);
 			if(directory) g_object_unref(directory);
+			if(snapshot) g_hash_table_unref(snapshot);
+			g_hash_table_unref(snapshotDirectories);
+			g_list_free_full(parseJobs, (GDestroyNotify)_xfdashboard_application_database_parse_job_free);
+			g_list_free_full(scanDirectories, (GDestroyNotify)_xfdashboard_application_database_scan_directory_free);
 
 			return(FALSE);
 		}
@@ -1081,7 +1982,9 @@ static gboolean _xfdashboard_application_database_load_applications(XfdashboardA
 		if(directory) g_object_unref(directory);
 	}
 
-	/* Remove invalid desktop IDs from database */
+	/* Remove invalid desktop IDs from database. This also removes the desktop
+	 * IDs reserved for desktop files to parse.
+	 */
 	if(apps)
 	{
 		GHashTableIter								appsIter;
@@ -1105,8 +2008,24 @@ static gboolean _xfdashboard_application_database_load_applications(XfdashboardA
 	}
 
 	XFDASHBOARD_DEBUG(self, APPLICATIONS,
-						"Loaded %u applications desktop files",
-						g_hash_table_size(apps));
+						"Loaded %u applications desktop files and queued %u desktop files for parsing",
+						g_hash_table_size(apps),
+						g_list_length(parseJobs));
+
+	/* Keep snapshot of all directories restored. The scanned directories are
+	 * added when all their desktop files were parsed and the snapshot will be
+	 * written then if any directory had to be scanned or has vanished.
+	 */
+	if(priv->snapshotDirectories)
+	{
+		g_hash_table_unref(priv->snapshotDirectories);
+		priv->snapshotDirectories=NULL;
+	}
+
+	priv->snapshotDirectories=snapshotDirectories;
+	priv->snapshotNeedsSave=!_xfdashboard_application_database_snapshot_is_unchanged(snapshot, snapshotDirectories);
+
+	if(snapshot) g_hash_table_unref(snapshot);
 
 	/* Release old list of installed applications and set new one */
 	if(priv->applications)
@@ -1143,6 +2062,39 @@ static gboolean _xfdashboard_application_database_load_applications(XfdashboardA
 		}
 	}
 
+	/* Parse queued desktop files at worker threads. The desktop app infos are
+	 * created and added to database at main loop when their desktop files
+	 * were parsed.
+	 */
+	priv->scanDirectories=scanDirectories;
+	priv->parseJobsTotal=g_list_length(parseJobs);
+	priv->parseJobsDone=0;
+
+	if(parseJobs)
+	{
+		priv->parsePool=g_thread_pool_new(_xfdashboard_application_database_parse_job_run,
+											self,
+											MAX(1, (gint)g_get_num_processors()),
+											FALSE,
+											NULL);
+
+		parseJobs=g_list_reverse(parseJobs);
+		for(iter=parseJobs; iter; iter=g_list_next(iter))
+		{
+			g_thread_pool_push(priv->parsePool, iter->data, NULL);
+		}
+		g_list_free(parseJobs);
+
+		XFDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Parsing %u desktop files with %d threads",
+							priv->parseJobsTotal,
+							g_thread_pool_get_max_threads(priv->parsePool));
+	}
+		else
+		{
+			_xfdashboard_application_database_finish_parsing(self);
+		}
+
 	/* Desktop files were loaded successfully */
 	return(TRUE);
 }
@@ -1211,6 +2163,9 @@ static void _xfdashboard_application_database_clean(XfdashboardApplicationDataba
 
 	priv=self->priv;
 
+	/* Stop parsing desktop files */
+	_xfdashboard_application_database_cancel_parsing(self);
+
 	/* Release allocated resources */
 	if(priv->appDirMonitors)
 	{
@@ -1242,6 +2197,12 @@ static void _xfdashboard_application_database_clean(XfdashboardApplicationDataba
 		priv->applications=NULL;
 	}
 
+	if(priv->snapshotDirectories)
+	{
+		g_hash_table_unref(priv->snapshotDirectories);
+		priv->snapshotDirectories=NULL;
+	}
+
 	/* Now as all allocated resources are released, this database is not loaded anymore */
 	priv->isLoaded=FALSE;
 
@@ -1305,6 +2266,12 @@ static void _xfdashboard_application_database_dispose(GObject *inObject)
 		priv->searchPaths=NULL;
 	}
 
+	if(priv->parsedJobs)
+	{
+		g_async_queue_unref(priv->parsedJobs);
+		priv->parsedJobs=NULL;
+	}
+
 	/* Call parent's class dispose method */
 	G_OBJECT_CLASS(xfdashboard_application_database_parent_class)->dispose(inObject);
 }
@@ -1403,6 +2370,19 @@ static void xfdashboard_application_database_class_init(XfdashboardApplicationDa
 						G_TYPE_NONE,
 						1,
 						G_TYPE_APP_INFO);
+
+	XfdashboardApplicationDatabaseSignals[SIGNAL_APPLICATION_DATABASE_LOADED]=
+		g_signal_new("application-database-loaded",
+						G_TYPE_FROM_CLASS(klass),
+						G_SIGNAL_RUN_LAST | G_SIGNAL_NO_HOOKS,
+						G_STRUCT_OFFSET(XfdashboardApplicationDatabaseClass, application_database_loaded),
+						NULL,
+						NULL,
+						_xfdashboard_marshal_VOID__UINT_UINT,
+						G_TYPE_NONE,
+						2,
+						G_TYPE_UINT,
+						G_TYPE_UINT);
 }
 
 /* Object initialization
@@ -1423,6 +2403,15 @@ static void xfdashboard_application_database_init(XfdashboardApplicationDatabase
 	priv->appsMenuReloadRequiredID=0;
 	priv->applications=NULL;
 	priv->appDirMonitors=NULL;
+	priv->snapshotDirectories=NULL;
+	priv->snapshotNeedsSave=FALSE;
+	priv->parsePool=NULL;
+	priv->parseCancelled=FALSE;
+	priv->parsedJobs=g_async_queue_new();
+	priv->parsedJobsScheduled=FALSE;
+	priv->parseJobsTotal=0;
+	priv->parseJobsDone=0;
+	priv->scanDirectories=NULL;
 
 	/* Set up search paths but eliminate duplicates */
 	path=g_build_filename(g_get_user_data_dir(), "applications", NULL);
@@ -66,6 +66,7 @@ struct _XfdashboardApplicationDatabaseClass
 
 	void (*application_added)(XfdashboardApplicationDatabase *self, GAppInfo *inAppInfo);
 	void (*application_removed)(XfdashboardApplicationDatabase *self, GAppInfo *inAppInfo);
+	void (*application_database_loaded)(XfdashboardApplicationDatabase *self, guint inParsed, guint inTotal);
 };
 
 /* Public API */
@@ -27,6 +27,7 @@
 
 #include <glib/gi18n-lib.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <libxfdashboard/application-tracker.h>
 
@@ -53,6 +54,10 @@ struct _XfdashboardApplicationTrackerPrivate
 
 	XfdashboardApplicationDatabase	*appDatabase;
 	XfdashboardWindowTracker		*windowTracker;
+
+	GHashTable						*processCache;
+	GHashTable						*windowNamesCache;
+	GHashTable						*desktopIDSuffixIndex;
 };
 
 /* Signals */
@@ -430,6 +435,256 @@ static GHashTable* _xfdashboard_application_tracker_get_environment_from_pid(gin
 }
 #endif
 
+#if defined(__linux__)
+/* Get path to executable of process with requested PID when running at Linux
+ * by reading symbolic link in proc filesystem.
+ */
+static gchar* _xfdashboard_application_tracker_get_executable_from_pid(gint inPID)
+{
+	gchar			*procExeFile;
+	gchar			*executable;
+
+	g_return_val_if_fail(inPID>0, NULL);
+
+	procExeFile=g_strdup_printf("/proc/%d/exe", inPID);
+	executable=g_file_read_link(procExeFile, NULL);
+	if(procExeFile) g_free(procExeFile);
+
+	return(executable);
+}
+
+/* Get start time of process with requested PID when running at Linux by
+ * reading field 22 of stat file in proc filesystem. Together with the PID it
+ * identifies a process even if its PID was reused by another process.
+ */
+static guint64 _xfdashboard_application_tracker_get_start_time_from_pid(gint inPID)
+{
+	gchar			*procStatFile;
+	gchar			*contents;
+	gchar			*fields;
+	gchar			**tokens;
+	guint64			startTime;
+
+	g_return_val_if_fail(inPID>0, 0);
+
+	startTime=0;
+
+	procStatFile=g_strdup_printf("/proc/%d/stat", inPID);
+	if(g_file_get_contents(procStatFile, &contents, NULL, NULL))
+	{
+		/* The process name in field 2 may contain spaces and parentheses,
+		 * so start splitting fields after its closing parenthesis at field 3.
+		 */
+		fields=strrchr(contents, ')');
+		if(fields)
+		{
+			tokens=g_strsplit(g_strchug(fields+1), " ", 21);
+			if(g_strv_length(tokens)>=20) startTime=g_ascii_strtoull(tokens[19], NULL, 10);
+			g_strfreev(tokens);
+		}
+		g_free(contents);
+	}
+	if(procStatFile) g_free(procStatFile);
+
+	return(startTime);
+}
+#else
+/* Fallback funtion to get path to executable of process with requested PID
+ * when running at an unsupported system. It just simply returns NULL.
+ */
+static gchar* _xfdashboard_application_tracker_get_executable_from_pid(gint inPID)
+{
+	return(NULL);
+}
+
+/* Fallback funtion to get start time of process with requested PID when
+ * running at an unsupported system. It just simply returns zero.
+ */
+static guint64 _xfdashboard_application_tracker_get_start_time_from_pid(gint inPID)
+{
+	return(0);
+}
+#endif
+
+/* Clear caches of resolved windows and index of desktop IDs as the
+ * application database has changed.
+ */
+static void _xfdashboard_application_tracker_invalidate_caches(XfdashboardApplicationTracker *self)
+{
+	XfdashboardApplicationTrackerPrivate	*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_TRACKER(self));
+
+	priv=self->priv;
+
+	if(priv->processCache) g_hash_table_remove_all(priv->processCache);
+	if(priv->windowNamesCache) g_hash_table_remove_all(priv->windowNamesCache);
+
+	if(priv->desktopIDSuffixIndex)
+	{
+		g_hash_table_destroy(priv->desktopIDSuffixIndex);
+		priv->desktopIDSuffixIndex=NULL;
+	}
+
+	XFDASHBOARD_DEBUG(self, APPLICATIONS, "Invalidated caches of resolved windows as application database has changed");
+}
+
+/* Look up key in cache of resolved windows. Returns TRUE if key was found and
+ * sets application info for cached desktop ID, which may be NULL if window
+ * could not be resolved before, at output variable.
+ * Callee is responsible to free application info with g_object_unref().
+ */
+static gboolean _xfdashboard_application_tracker_cache_lookup(XfdashboardApplicationTracker *self,
+																GHashTable *inCache,
+																const gchar *inKey,
+																GAppInfo **outAppInfo)
+{
+	XfdashboardApplicationTrackerPrivate	*priv;
+	const gchar								*desktopID;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_TRACKER(self), FALSE);
+	g_return_val_if_fail(inCache, FALSE);
+	g_return_val_if_fail(inKey, FALSE);
+	g_return_val_if_fail(outAppInfo && *outAppInfo==NULL, FALSE);
+
+	priv=self->priv;
+
+	/* Check if key is cached */
+	if(!g_hash_table_lookup_extended(inCache, inKey, NULL, (gpointer*)&desktopID)) return(FALSE);
+
+	/* Look up application info for cached desktop ID */
+	if(desktopID) *outAppInfo=xfdashboard_application_database_lookup_desktop_id(priv->appDatabase, desktopID);
+
+	return(TRUE);
+}
+
+/* Store desktop ID of application info, which may be NULL if window could
+ * not be resolved, in cache of resolved windows.
+ */
+static void _xfdashboard_application_tracker_cache_store(XfdashboardApplicationTracker *self,
+															GHashTable *inCache,
+															const gchar *inKey,
+															GAppInfo *inAppInfo)
+{
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_TRACKER(self));
+	g_return_if_fail(inCache);
+	g_return_if_fail(inKey);
+	g_return_if_fail(!inAppInfo || G_IS_APP_INFO(inAppInfo));
+
+	g_hash_table_insert(inCache,
+						g_strdup(inKey),
+						inAppInfo ? g_strdup(g_app_info_get_id(inAppInfo)) : NULL);
+}
+
+/* Remove resolved process of window from cache if it was the last window of
+ * this process, so the cache only keeps processes having windows.
+ */
+static void _xfdashboard_application_tracker_cache_remove_process(XfdashboardApplicationTracker *self,
+																	XfdashboardWindowTrackerWindow *inWindow)
+{
+	XfdashboardApplicationTrackerPrivate	*priv;
+	gint									windowPID;
+	GList									*iter;
+	XfdashboardWindowTrackerWindow			*window;
+	gchar									*prefix;
+	GHashTableIter							cacheIter;
+	const gchar								*key;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_TRACKER(self));
+	g_return_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_WINDOW(inWindow));
+
+	priv=self->priv;
+
+	if(!priv->processCache) return;
+
+	windowPID=xfdashboard_window_tracker_window_get_pid(inWindow);
+	if(windowPID<=0) return;
+
+	/* Check if process has any other window */
+	for(iter=xfdashboard_window_tracker_get_windows(priv->windowTracker); iter; iter=g_list_next(iter))
+	{
+		window=XFDASHBOARD_WINDOW_TRACKER_WINDOW(iter->data);
+		if(window!=inWindow &&
+			xfdashboard_window_tracker_window_get_pid(window)==windowPID)
+		{
+			return;
+		}
+	}
+
+	/* Remove all cached entries of this PID */
+	prefix=g_strdup_printf("%d\n", windowPID);
+
+	g_hash_table_iter_init(&cacheIter, priv->processCache);
+	while(g_hash_table_iter_next(&cacheIter, (gpointer*)&key, NULL))
+	{
+		if(g_str_has_prefix(key, prefix)) g_hash_table_iter_remove(&cacheIter);
+	}
+
+	g_free(prefix);
+}
+
+/* Get desktop ID of application which is located in a subdirectory. Then the
+ * desktop ID is prefixed with the subdirectory's name followed by a dash, so
+ * look up the requested name in index of all suffixes following a dash in
+ * desktop IDs. The index is built on first use and only unambiguous suffixes
+ * resolve to an application.
+ * Callee is responsible to free result with g_object_unref().
+ */
+static GAppInfo* _xfdashboard_application_tracker_lookup_desktop_id_suffix(XfdashboardApplicationTracker *self,
+																			const gchar *inName)
+{
+	XfdashboardApplicationTrackerPrivate	*priv;
+	const gchar								*desktopID;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_TRACKER(self), NULL);
+	g_return_val_if_fail(inName && *inName, NULL);
+
+	priv=self->priv;
+
+	/* Build index of desktop ID suffixes if not done already */
+	if(!priv->desktopIDSuffixIndex)
+	{
+		GList								*apps;
+		GList								*iter;
+		const gchar							*appID;
+		const gchar							*suffix;
+
+		priv->desktopIDSuffixIndex=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+
+		apps=xfdashboard_application_database_get_all_applications(priv->appDatabase);
+		for(iter=apps; iter; iter=g_list_next(iter))
+		{
+			if(!G_IS_APP_INFO(iter->data)) continue;
+
+			appID=g_app_info_get_id(G_APP_INFO(iter->data));
+			if(!appID) continue;
+
+			/* Add each suffix following a dash to index. If a suffix is
+			 * already in index it is ambiguous so mark it by setting NULL.
+			 */
+			for(suffix=strchr(appID, '-'); suffix; suffix=strchr(suffix+1, '-'))
+			{
+				if(g_hash_table_contains(priv->desktopIDSuffixIndex, suffix+1))
+				{
+					g_hash_table_insert(priv->desktopIDSuffixIndex, g_strdup(suffix+1), NULL);
+				}
+					else g_hash_table_insert(priv->desktopIDSuffixIndex, g_strdup(suffix+1), g_strdup(appID));
+			}
+		}
+		if(apps) g_list_free_full(apps, g_object_unref);
+
+		XFDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Built index of %u desktop ID suffixes",
+							g_hash_table_size(priv->desktopIDSuffixIndex));
+	}
+
+	/* Look up name in index */
+	desktopID=g_hash_table_lookup(priv->desktopIDSuffixIndex, inName);
+	if(!desktopID) return(NULL);
+
+	return(xfdashboard_application_database_lookup_desktop_id(priv->appDatabase, desktopID));
+}
+
 /* Get desktop ID from process' environment which owns window.
  * Callee is responsible to free result with g_object_unref().
  */
@@ -562,7 +817,6 @@ static GAppInfo* _xfdashboard_application_tracker_get_desktop_id_from_window_nam
 	GAppInfo								*foundAppInfo;
 	gchar									**names;
 	gchar									**iter;
-	GList									*apps;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_TRACKER(self), NULL);
 	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_WINDOW(inWindow), NULL);
@@ -570,9 +824,6 @@ static GAppInfo* _xfdashboard_application_tracker_get_desktop_id_from_window_nam
 	priv=self->priv;
 	foundAppInfo=NULL;
 
-	/* Get list of applications */
-	apps=xfdashboard_application_database_get_all_applications(priv->appDatabase);
-
 	/* Get window's names */
 	names=xfdashboard_window_tracker_window_get_instance_names(inWindow);
 
@@ -604,61 +855,20 @@ static GAppInfo* _xfdashboard_application_tracker_get_desktop_id_from_window_nam
 
 		/* If no application was found for the name it may be an application
 		 * located in a subdirectory. Then the desktop ID is prefixed with
-		 * the subdirectory's name followed by a dash. So iterate through all
-		 * applications and lookup with glob pattern '*-' followed by name
-		 * and suffix '.desktop'.
+		 * the subdirectory's name followed by a dash. So look up desktop ID
+		 * ending with a dash followed by name and suffix '.desktop'.
 		 */
 		if(!appInfo)
 		{
-			GList							*iterApps;
-			GList							*foundSubdirApps;
-			gchar							*globName;
-			GPatternSpec					*globPattern;
-			GAppInfo						*globAppInfo;
-
-			/* Build glob pattern */
-			globAppInfo=NULL;
-			globName=g_strconcat("*-", iterNameLowerCase, NULL);
-			globPattern=g_pattern_spec_new(globName);
-
-			/* Iterate through application and collect applications matching
-			 * glob pattern.
-			 */
-			foundSubdirApps=NULL;
-			for(iterApps=apps; iterApps; iterApps=g_list_next(iterApps))
-			{
-				if(!G_IS_APP_INFO(iterApps->data)) continue;
-				globAppInfo=G_APP_INFO(iterApps->data);
-
-				if(g_pattern_match_string(globPattern, g_app_info_get_id(globAppInfo)))
-				{
-					foundSubdirApps=g_list_prepend(foundSubdirApps, globAppInfo);
-					XFDASHBOARD_DEBUG(self, APPLICATIONS,
-										"Found possible application '%s' for window '%s' using pattern '%s'",
-										g_app_info_get_id(globAppInfo),
-										xfdashboard_window_tracker_window_get_name(inWindow),
-										globName);
-				}
-			}
-
-			/* If exactly one application was collected because it matched
-			 * the glob pattern then we found the application.
-			 */
-			if(g_list_length(foundSubdirApps)==1)
+			appInfo=_xfdashboard_application_tracker_lookup_desktop_id_suffix(self, iterNameLowerCase);
+			if(appInfo)
 			{
-				appInfo=G_APP_INFO(g_object_ref(G_OBJECT(foundSubdirApps->data)));
-
 				XFDASHBOARD_DEBUG(self, APPLICATIONS,
-									"Found exactly one application named '%s' for window '%s' using pattern '%s'",
+									"Found exactly one application named '%s' for window '%s' using suffix '-%s'",
 									g_app_info_get_id(appInfo),
 									xfdashboard_window_tracker_window_get_name(inWindow),
-									globName);
+									iterNameLowerCase);
 			}
-
-			/* Release allocated resources */
-			if(foundSubdirApps) g_list_free(foundSubdirApps);
-			if(globPattern) g_pattern_spec_free(globPattern);
-			if(globName) g_free(globName);
 		}
 
 		/* If we still did not find an application continue with next
@@ -693,7 +903,6 @@ static GAppInfo* _xfdashboard_application_tracker_get_desktop_id_from_window_nam
 			if(foundAppInfo) g_object_unref(foundAppInfo);
 			if(appInfo) g_object_unref(appInfo);
 			if(names) g_strfreev(names);
-			if(apps) g_list_free_full(apps, g_object_unref);
 
 			return(NULL);
 		}
@@ -712,7 +921,6 @@ static GAppInfo* _xfdashboard_application_tracker_get_desktop_id_from_window_nam
 
 	/* Release allocated resources */
 	if(names) g_strfreev(names);
-	if(apps) g_list_free_full(apps, g_object_unref);
 
 	/* Return found application info */
 	XFDASHBOARD_DEBUG(self, APPLICATIONS,
@@ -723,6 +931,100 @@ static GAppInfo* _xfdashboard_application_tracker_get_desktop_id_from_window_nam
 	return(foundAppInfo);
 }
 
+/* Resolve window to application by environment of its process or by its
+ * names. Results are cached by process (PID and executable) and by window
+ * names, so windows of the same process or class need not be resolved again.
+ * Callee is responsible to free result with g_object_unref().
+ */
+static GAppInfo* _xfdashboard_application_tracker_resolve_window(XfdashboardApplicationTracker *self,
+																	XfdashboardWindowTrackerWindow *inWindow)
+{
+	XfdashboardApplicationTrackerPrivate	*priv;
+	GAppInfo								*appInfo;
+	gint									windowPID;
+	gchar									**names;
+	gchar									*key;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATION_TRACKER(self), NULL);
+	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_WINDOW(inWindow), NULL);
+
+	priv=self->priv;
+	appInfo=NULL;
+
+	/* Try to find application by environment of window's process. The
+	 * result depends on the process (as it depends on the desktop file
+	 * the process was launched from) so cache it by PID, start time and
+	 * executable. The start time prevents a reused PID to resolve to the
+	 * application of the former process running the same executable.
+	 */
+	windowPID=xfdashboard_window_tracker_window_get_pid(inWindow);
+	if(windowPID>0)
+	{
+		gchar								*executable;
+
+		executable=_xfdashboard_application_tracker_get_executable_from_pid(windowPID);
+		key=g_strdup_printf("%d\n%" G_GUINT64_FORMAT "\n%s",
+							windowPID,
+							_xfdashboard_application_tracker_get_start_time_from_pid(windowPID),
+							executable ? executable : "");
+
+		if(!_xfdashboard_application_tracker_cache_lookup(self, priv->processCache, key, &appInfo))
+		{
+			appInfo=_xfdashboard_application_tracker_get_desktop_id_from_environment(self, inWindow);
+			_xfdashboard_application_tracker_cache_store(self, priv->processCache, key, appInfo);
+		}
+			else
+			{
+				XFDASHBOARD_DEBUG(self, APPLICATIONS,
+									"Resolved process %d (%s) of window '%s' from cache to desktop ID '%s'",
+									windowPID,
+									executable ? executable : "<nil>",
+									xfdashboard_window_tracker_window_get_name(inWindow),
+									appInfo ? g_app_info_get_id(appInfo) : "<nil>");
+			}
+
+		if(executable) g_free(executable);
+		if(key) g_free(key);
+	}
+
+	if(appInfo) return(appInfo);
+
+	/* Try to find application by window's names which only depends on the
+	 * class and instance names of window, so cache it by these names.
+	 */
+	names=xfdashboard_window_tracker_window_get_instance_names(inWindow);
+	if(!names) return(_xfdashboard_application_tracker_get_desktop_id_from_window_names(self, inWindow));
+
+	key=g_strjoinv("\n", names);
+	if(!_xfdashboard_application_tracker_cache_lookup(self, priv->windowNamesCache, key, &appInfo))
+	{
+		appInfo=_xfdashboard_application_tracker_get_desktop_id_from_window_names(self, inWindow);
+		_xfdashboard_application_tracker_cache_store(self, priv->windowNamesCache, key, appInfo);
+	}
+		else
+		{
+			XFDASHBOARD_DEBUG(self, APPLICATIONS,
+								"Resolved window names of '%s' from cache to desktop ID '%s'",
+								xfdashboard_window_tracker_window_get_name(inWindow),
+								appInfo ? g_app_info_get_id(appInfo) : "<nil>");
+		}
+
+	/* Release allocated resources */
+	if(key) g_free(key);
+	if(names) g_strfreev(names);
+
+	return(appInfo);
+}
+
+/* Application database has changed */
+static void _xfdashboard_application_tracker_on_application_database_changed(XfdashboardApplicationTracker *self,
+																				gpointer inUserData)
+{
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_TRACKER(self));
+
+	_xfdashboard_application_tracker_invalidate_caches(self);
+}
+
 /* A window was created */
 static void _xfdashboard_application_tracker_on_window_opened(XfdashboardApplicationTracker *self,
 																XfdashboardWindowTrackerWindow *inWindow,
@@ -766,8 +1068,7 @@ static void _xfdashboard_application_tracker_on_window_opened(XfdashboardApplica
 	}
 
 	/* Try to find application for window */
-	appInfo=_xfdashboard_application_tracker_get_desktop_id_from_environment(self, inWindow);
-	if(!appInfo) appInfo=_xfdashboard_application_tracker_get_desktop_id_from_window_names(self, inWindow);
+	appInfo=_xfdashboard_application_tracker_resolve_window(self, inWindow);
 
 	/* If we could not resolve window to a desktop application info, then stop here */
 	if(!appInfo)
@@ -824,6 +1125,9 @@ static void _xfdashboard_application_tracker_on_window_closed(XfdashboardApplica
 
 	priv=self->priv;
 
+	/* Forget resolved process if this was its last window */
+	_xfdashboard_application_tracker_cache_remove_process(self, inWindow);
+
 	/* Find application tracker item in list of known running applications
 	 * matching the window just closed.
 	 */
@@ -973,10 +1277,29 @@ static void _xfdashboard_application_tracker_dispose(GObject *inObject)
 
 	if(priv->appDatabase)
 	{
+		g_signal_handlers_disconnect_by_data(priv->appDatabase, self);
 		g_object_unref(priv->appDatabase);
 		priv->appDatabase=NULL;
 	}
 
+	if(priv->processCache)
+	{
+		g_hash_table_destroy(priv->processCache);
+		priv->processCache=NULL;
+	}
+
+	if(priv->windowNamesCache)
+	{
+		g_hash_table_destroy(priv->windowNamesCache);
+		priv->windowNamesCache=NULL;
+	}
+
+	if(priv->desktopIDSuffixIndex)
+	{
+		g_hash_table_destroy(priv->desktopIDSuffixIndex);
+		priv->desktopIDSuffixIndex=NULL;
+	}
+
 	/* Call parent's class dispose method */
 	G_OBJECT_CLASS(xfdashboard_application_tracker_parent_class)->dispose(inObject);
 }
@@ -1038,6 +1361,9 @@ static void xfdashboard_application_tracker_init(XfdashboardApplicationTracker *
 	priv->runningApps=NULL;
 	priv->appDatabase=xfdashboard_application_database_get_default();
 	priv->windowTracker=xfdashboard_window_tracker_get_default();
+	priv->processCache=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+	priv->windowNamesCache=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+	priv->desktopIDSuffixIndex=NULL;
 
 	/* Load application database if not done already */
 	if(!xfdashboard_application_database_is_loaded(priv->appDatabase))
@@ -1058,6 +1384,19 @@ static void xfdashboard_application_tracker_init(XfdashboardApplicationTracker *
 								"active-window-changed",
 								G_CALLBACK(_xfdashboard_application_tracker_on_active_window_changed),
 								self);
+
+	g_signal_connect_swapped(priv->appDatabase,
+								"application-added",
+								G_CALLBACK(_xfdashboard_application_tracker_on_application_database_changed),
+								self);
+	g_signal_connect_swapped(priv->appDatabase,
+								"application-removed",
+								G_CALLBACK(_xfdashboard_application_tracker_on_application_database_changed),
+								self);
+	g_signal_connect_swapped(priv->appDatabase,
+								"application-database-loaded",
+								G_CALLBACK(_xfdashboard_application_tracker_on_application_database_changed),
+								self);
 }
 
 /* IMPLEMENTATION: Public API */
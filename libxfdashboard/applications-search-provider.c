@@ -30,7 +30,12 @@
 
 #include <glib/gi18n-lib.h>
 #include <gtk/gtk.h>
+#include <glib/gstdio.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include <libxfdashboard/application-database.h>
 #include <libxfdashboard/application-button.h>
@@ -52,6 +57,9 @@ G_DEFINE_TYPE(XfdashboardApplicationsSearchProvider,
 				xfdashboard_applications_search_provider,
 				XFDASHBOARD_TYPE_SEARCH_PROVIDER)
 
+/* Forward declarations */
+typedef struct _XfdashboardApplicationsSearchProviderIndex			XfdashboardApplicationsSearchProviderIndex;
+
 /* Private structure - access only by public API if needed */
 #define XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_GET_PRIVATE(obj) \
 	(G_TYPE_INSTANCE_GET_PRIVATE((obj), XFDASHBOARD_TYPE_APPLICATIONS_SEARCH_PROVIDER, XfdashboardApplicationsSearchProviderPrivate))
@@ -66,11 +74,11 @@ struct _XfdashboardApplicationsSearchProviderPrivate
 	guint											applicationAddedID;
 	guint											applicationRemovedID;
 
-	GList											*allApps;
+	XfdashboardApplicationsSearchProviderIndex		*index;
+	GHashTable										*appInfoChangedIDs;
 
 	XfconfChannel									*xfconfChannel;
 	guint											xfconfSortModeBindingID;
-	XfdashboardApplicationsSearchProviderSortMode	currentSortMode;
 };
 
 /* Properties */
@@ -90,24 +98,87 @@ static GParamSpec* XfdashboardApplicationsSearchProviderProperties[PROP_LAST]={
 
 #define DEFAULT_DELIMITERS														"\t\n\r "
 
-#define XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_FILE				"applications-search-provider-statistics.ini"
-#define XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_ENTRIES_GROUP		"Entries"
-#define XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_ENTRIES_COUNT		"Count"
+/* Launch counters are stored in a snapshot and each launch since the snapshot
+ * was written is appended as one line containing the application desktop ID
+ * to a journal. The journal is compacted into a new snapshot in background
+ * when it has grown long enough and at shutdown.
+ */
+#define XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_SNAPSHOT_FILE		"applications-search-provider-statistics.snapshot"
+#define XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_SNAPSHOT_MAGIC		0x58445353	/* "XDSS" in native byte order */
+#define XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_SNAPSHOT_VERSION	1
+#define XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_SNAPSHOT_FORMAT		"(uuuta(su))"
+#define XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_JOURNAL_FILE		"applications-search-provider-statistics.journal"
+#define XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_COMPACT_THRESHOLD	256
+
+/* Key file of former versions which is migrated to snapshot */
+#define XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_LEGACY_FILE			"applications-search-provider-statistics.ini"
 #define XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_USED_COUNTER_GROUP	"Used Counters"
 
 typedef struct _XfdashboardApplicationsSearchProviderGlobal			XfdashboardApplicationsSearchProviderGlobal;
 struct _XfdashboardApplicationsSearchProviderGlobal
 {
-	gchar								*filename;
+	gchar								*snapshotFilename;
+	gchar								*journalFilename;
+	gchar								*legacyFilename;
 
 	GHashTable							*stats;
 
+	guint								generation;
+	gint								journalFD;
+	gint64								journalSize;
+	guint								journalEntries;
+
+	gboolean							compacting;
+	GCond								compactingDone;
+	GPtrArray							*pendingLaunches;
+	guint								compactRetryLaunches;
+
 	guint								shutdownSignalID;
 	guint								applicationLaunchedSignalID;
 
 	guint								maxUsedCounter;
 };
 
+/* Index of all applications to look up the applications which could match
+ * search terms by n-grams of their texts normalized and lower-cased at time
+ * of indexing. Each position of a text is indexed by the n-grams of one, two
+ * and three bytes starting there, so search terms shorter than a trigram can
+ * be looked up also.
+ */
+#define XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_INDEX_SERIAL		(_xfdashboard_applications_search_provider_index_serial_quark())
+
+#define XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_NGRAM_MAX_LENGTH	3
+
+typedef struct _XfdashboardApplicationsSearchProviderIndexEntry		XfdashboardApplicationsSearchProviderIndexEntry;
+struct _XfdashboardApplicationsSearchProviderIndexEntry
+{
+	volatile gint						refCount;
+
+	GAppInfo							*appInfo;
+	gchar								*desktopID;
+	gboolean							shouldShow;
+
+	gchar								*title;
+	gchar								*description;
+	gchar								**keywords;
+	gchar								*command;
+};
+
+/* The index is never modified while it is used as snapshot by a search, which
+ * may be performed in another thread, but copied before modifying it.
+ */
+struct _XfdashboardApplicationsSearchProviderIndex
+{
+	volatile gint						refCount;
+
+	GHashTable							*entries;
+	GHashTable							*desktopIDs;
+	GHashTable							*ngrams;
+	guint								serial;
+};
+
+G_LOCK_DEFINE_STATIC(_xfdashboard_applications_search_provider_index_lock);
+
 G_LOCK_DEFINE_STATIC(_xfdashboard_applications_search_provider_statistics_lock);
 XfdashboardApplicationsSearchProviderGlobal		_xfdashboard_applications_search_provider_statistics={0, };
 
@@ -177,77 +248,64 @@ static XfdashboardApplicationsSearchProviderStatistics* _xfdashboard_application
 	return(stats);
 }
 
-/* An application was launched successfully */
-static void _xfdashboard_applications_search_provider_on_application_launched(XfdashboardApplication *inApplication,
-																				GAppInfo *inAppInfo,
-																				gpointer inUserData)
+/* Increase launch counter of application by given amount. The caller must
+ * hold the statistics lock.
+ */
+static void _xfdashboard_applications_search_provider_statistics_increase(const gchar *inAppID, guint inAmount)
 {
-	const gchar											*appID;
 	XfdashboardApplicationsSearchProviderStatistics		*stats;
 
-	g_return_if_fail(G_IS_APP_INFO(inAppInfo));
-
-	/* Lock for thread-safety */
-	G_LOCK(_xfdashboard_applications_search_provider_statistics_lock);
-
-	/* Get application ID which is used to lookup and store statistics */
-	appID=g_app_info_get_id(inAppInfo);
+	g_return_if_fail(_xfdashboard_applications_search_provider_statistics.stats);
+	g_return_if_fail(inAppID && *inAppID);
 
-	/* Create new statistics data if application is new, otherwise take an extra
-	 * reference on statistics data to keep it alive as it will be removed and
-	 * re-added when updating and the removal may decrease the reference counter
-	 * to zero which destroys the statistics data.
-	 */
-	stats=_xfdashboard_applications_search_provider_statistics_get(appID);
-	if(!stats) stats=_xfdashboard_applications_search_provider_statistics_new();
-		else _xfdashboard_applications_search_provider_statistics_ref(stats);
+	/* Create new statistics data if application is new */
+	stats=_xfdashboard_applications_search_provider_statistics_get(inAppID);
+	if(!stats)
+	{
+		stats=_xfdashboard_applications_search_provider_statistics_new();
+		g_hash_table_insert(_xfdashboard_applications_search_provider_statistics.stats,
+							g_strdup(inAppID),
+							stats);
+	}
 
 	/* Increase launch counter and remember it has highest launch counter if it
 	 * is now higher than the one we remembered.
 	 */
-	stats->usedCounter++;
+	stats->usedCounter+=inAmount;
 	if(stats->usedCounter>_xfdashboard_applications_search_provider_statistics.maxUsedCounter)
 	{
 		_xfdashboard_applications_search_provider_statistics.maxUsedCounter=stats->usedCounter;
 	}
-
-	/* Store updated statistics */
-	g_hash_table_insert(_xfdashboard_applications_search_provider_statistics.stats,
-						g_strdup(appID),
-						_xfdashboard_applications_search_provider_statistics_ref(stats));
-
-	/* Release extra reference we took to keep this statistics data alive */
-	_xfdashboard_applications_search_provider_statistics_unref(stats);
-
-	/* Unlock for thread-safety */
-	G_UNLOCK(_xfdashboard_applications_search_provider_statistics_lock);
 }
 
-/* Save statistics to file */
-static gboolean _xfdashboard_applications_search_provider_save_statistics(GError **outError)
+/* Open journal file to append launch events to. If requested or if the file is
+ * empty the journal is (re-)started with a header line containing the generation
+ * of the snapshot it belongs to. The caller must hold the statistics lock.
+ */
+static gboolean _xfdashboard_applications_search_provider_statistics_open_journal(gboolean inTruncate, GError **outError)
 {
-	GKeyFile												*keyFile;
-	gchar													*keyFileData;
-	gsize													keyFileLength;
-	GList													*allAppIDs;
-	GList													*iter;
-	guint													entriesCount;
-	gchar													*fileFolder;
-	GError													*error;
-
+	gchar												*fileFolder;
+	gint												flags;
+	gint												fd;
+	struct stat											fileInfo;
+	gchar												*header;
+	gssize												headerLength;
+	int													errno_save;
+
+	g_return_val_if_fail(_xfdashboard_applications_search_provider_statistics.journalFilename, FALSE);
 	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
 
-	error=NULL;
-
-	/* If we have no filename do not store statistics but do not return error */
-	if(!_xfdashboard_applications_search_provider_statistics.filename) return(TRUE);
+	/* Close journal if it is still open */
+	if(_xfdashboard_applications_search_provider_statistics.journalFD>=0)
+	{
+		close(_xfdashboard_applications_search_provider_statistics.journalFD);
+		_xfdashboard_applications_search_provider_statistics.journalFD=-1;
+	}
 
-	/* Create parent folders for key file if not available */
-	fileFolder=g_path_get_dirname(_xfdashboard_applications_search_provider_statistics.filename);
+	/* Create parent folders for journal if not available */
+	fileFolder=g_path_get_dirname(_xfdashboard_applications_search_provider_statistics.journalFilename);
 	if(g_mkdir_with_parents(fileFolder, 0700)<0)
 	{
-		int											errno_save;
-
 		/* Get error code */
 		errno_save=errno;
 
@@ -260,419 +318,1495 @@ static gboolean _xfdashboard_applications_search_provider_save_statistics(GError
 						g_strerror(errno_save));
 
 		/* Release allocated resources */
-		if(fileFolder) g_free(fileFolder);
+		g_free(fileFolder);
 
 		return(FALSE);
 	}
+	g_free(fileFolder);
 
-	/* Create and set up key file to store statistics */
-	keyFile=g_key_file_new();
+	/* Open journal for appending */
+	flags=O_WRONLY | O_APPEND | O_CREAT;
+	if(inTruncate) flags|=O_TRUNC;
+#ifdef O_CLOEXEC
+	flags|=O_CLOEXEC;
+#endif
 
-	/* Get list of all applications from statistics hash table, iterate through
-	 * all applications and store them in key file.
-	 */
-	allAppIDs=g_hash_table_get_keys(_xfdashboard_applications_search_provider_statistics.stats);
+	fd=g_open(_xfdashboard_applications_search_provider_statistics.journalFilename, flags, 0600);
+	if(fd<0 || fstat(fd, &fileInfo)<0)
+	{
+		/* Get error code */
+		errno_save=errno;
+
+		/* Set error */
+		g_set_error(outError,
+						G_IO_ERROR,
+						g_io_error_from_errno(errno_save),
+						_("Could not open statistics journal of applications search provider at %s: %s"),
+						_xfdashboard_applications_search_provider_statistics.journalFilename,
+						g_strerror(errno_save));
+
+		/* Release allocated resources */
+		if(fd>=0) close(fd);
 
-	g_key_file_set_integer(keyFile,
-							XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_ENTRIES_GROUP,
-							XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_ENTRIES_COUNT,
-							g_list_length(allAppIDs));
+		return(FALSE);
+	}
 
-	entriesCount=0;
-	for(iter=allAppIDs; iter; iter=g_list_next(iter))
+	/* Write header if journal is new or was truncated */
+	if(fileInfo.st_size==0)
 	{
-		gchar												*name;
-		const gchar											*appID;
-		XfdashboardApplicationsSearchProviderStatistics		*stats;
+		header=g_strdup_printf("#%u\n", _xfdashboard_applications_search_provider_statistics.generation);
+		headerLength=strlen(header);
+		if(write(fd, header, headerLength)!=headerLength)
+		{
+			/* Get error code */
+			errno_save=errno;
+
+			/* Set error */
+			g_set_error(outError,
+							G_IO_ERROR,
+							g_io_error_from_errno(errno_save),
+							_("Could not write statistics journal of applications search provider at %s: %s"),
+							_xfdashboard_applications_search_provider_statistics.journalFilename,
+							g_strerror(errno_save));
 
-		/* Get current iterated application desktop ID */
-		appID=(const gchar*)iter->data;
+			/* Release allocated resources */
+			g_free(header);
+			close(fd);
+
+			return(FALSE);
+		}
+		g_free(header);
 
-		/* Get statistics data (it must exist because we got a list of all keys) */
-		stats=_xfdashboard_applications_search_provider_statistics_get(appID);
-		g_assert(stats!=NULL);
+		fileInfo.st_size=headerLength;
+	}
 
-		/* Store application desktop ID in "entries" overview group and increase counter */
-		entriesCount++;
+	/* Journal is ready to append launch events */
+	_xfdashboard_applications_search_provider_statistics.journalFD=fd;
+	_xfdashboard_applications_search_provider_statistics.journalSize=fileInfo.st_size;
 
-		name=g_strdup_printf("%d", entriesCount);
-		g_key_file_set_string(keyFile,
-								XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_ENTRIES_GROUP,
-								name,
-								appID);
-		g_free(name);
+	return(TRUE);
+}
 
-		/* Store statistics in key file in their groups but try to avoid to store
-		 * default values to keep key file small.
-		 */
+/* Append launch of application to journal. Each launch is written as one line
+ * with a single write() call. If it could not be written completely the journal
+ * is cut back to its former size so the next launch is not joined to a partial
+ * line. The caller must hold the statistics lock.
+ */
+static gboolean _xfdashboard_applications_search_provider_statistics_append_journal(const gchar *inAppID)
+{
+	gchar												*line;
+	gssize												lineLength;
+	gssize												written;
+	int													errno_save;
+
+	g_return_val_if_fail(inAppID && *inAppID, FALSE);
+
+	if(_xfdashboard_applications_search_provider_statistics.journalFD<0) return(FALSE);
+
+	line=g_strconcat(inAppID, "\n", NULL);
+	lineLength=strlen(line);
+
+	do
+	{
+		written=write(_xfdashboard_applications_search_provider_statistics.journalFD, line, lineLength);
+	}
+	while(written<0 && errno==EINTR);
+	errno_save=errno;
+
+	g_free(line);
+
+	if(written==lineLength)
+	{
+		_xfdashboard_applications_search_provider_statistics.journalSize+=lineLength;
+		return(TRUE);
+	}
+
+	g_warning(_("Could not write statistics journal of applications search provider at %s: %s"),
+				_xfdashboard_applications_search_provider_statistics.journalFilename,
+				written<0 ? g_strerror(errno_save) : _("Incomplete write"));
+
+	/* Remove partial line or stop appending to journal if this fails */
+	if(written>0 &&
+		ftruncate(_xfdashboard_applications_search_provider_statistics.journalFD, _xfdashboard_applications_search_provider_statistics.journalSize)<0)
+	{
+		close(_xfdashboard_applications_search_provider_statistics.journalFD);
+		_xfdashboard_applications_search_provider_statistics.journalFD=-1;
+	}
+
+	return(FALSE);
+}
+
+/* Build snapshot of all launch counters for next generation. The caller must
+ * hold the statistics lock.
+ */
+static GVariant* _xfdashboard_applications_search_provider_statistics_build_snapshot(void)
+{
+	GVariantBuilder										countersBuilder;
+	GHashTableIter										iter;
+	const gchar											*appID;
+	XfdashboardApplicationsSearchProviderStatistics		*stats;
+	GVariant											*snapshot;
+
+	g_return_val_if_fail(_xfdashboard_applications_search_provider_statistics.stats, NULL);
+
+	/* Try to avoid to store default values to keep snapshot small */
+	g_variant_builder_init(&countersBuilder, G_VARIANT_TYPE("a(su)"));
+
+	g_hash_table_iter_init(&iter, _xfdashboard_applications_search_provider_statistics.stats);
+	while(g_hash_table_iter_next(&iter, (gpointer*)&appID, (gpointer*)&stats))
+	{
 		if(stats->usedCounter>0)
 		{
-			g_key_file_set_integer(keyFile,
-									XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_USED_COUNTER_GROUP,
-									appID,
-									stats->usedCounter);
+			g_variant_builder_add(&countersBuilder, "(su)", appID, stats->usedCounter);
 		}
 	}
 
-	/* Store key file for statistics in file */
-	keyFileData=g_key_file_to_data(keyFile, &keyFileLength, NULL);
-	if(!g_file_set_contents(_xfdashboard_applications_search_provider_statistics.filename, keyFileData, keyFileLength, &error))
+	/* Remember size of journal covered by snapshot so launches appended to
+	 * journal while snapshot is written can be replayed if journal could not
+	 * be restarted for the new generation.
+	 */
+	snapshot=g_variant_new(XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_SNAPSHOT_FORMAT,
+							XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_SNAPSHOT_MAGIC,
+							XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_SNAPSHOT_VERSION,
+							_xfdashboard_applications_search_provider_statistics.generation+1,
+							(guint64)_xfdashboard_applications_search_provider_statistics.journalSize,
+							&countersBuilder);
+
+	return(g_variant_ref_sink(snapshot));
+}
+
+/* Write snapshot to file. It does not access any statistics data and is
+ * therefore called without holding the statistics lock.
+ */
+static gboolean _xfdashboard_applications_search_provider_statistics_write_snapshot(const gchar *inFilename,
+																					GVariant *inSnapshot,
+																					GError **outError)
+{
+	gchar												*fileFolder;
+
+	g_return_val_if_fail(inFilename && *inFilename, FALSE);
+	g_return_val_if_fail(inSnapshot, FALSE);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
+
+	/* Create parent folders for snapshot if not available */
+	fileFolder=g_path_get_dirname(inFilename);
+	if(g_mkdir_with_parents(fileFolder, 0700)<0)
 	{
-		/* Propagate error */
-		g_propagate_error(outError, error);
+		int												errno_save;
+
+		/* Get error code */
+		errno_save=errno;
+
+		/* Set error */
+		g_set_error(outError,
+						G_IO_ERROR,
+						g_io_error_from_errno(errno_save),
+						_("Could not create configuration folder for applications search provider at %s: %s"),
+						fileFolder,
+						g_strerror(errno_save));
 
 		/* Release allocated resources */
-		if(fileFolder) g_free(fileFolder);
-		if(keyFileData) g_free(keyFileData);
-		if(keyFile) g_key_file_free(keyFile);
+		g_free(fileFolder);
 
 		return(FALSE);
 	}
+	g_free(fileFolder);
 
-	/* Release allocated resources */
-	if(fileFolder) g_free(fileFolder);
-	if(keyFileData) g_free(keyFileData);
-	if(keyFile) g_key_file_free(keyFile);
-
-	/* If we get here saving statistics file was successful */
-	return(TRUE);
+	/* Write snapshot atomically */
+	return(g_file_set_contents(inFilename,
+								g_variant_get_data(inSnapshot),
+								g_variant_get_size(inSnapshot),
+								outError));
 }
 
-/* Load statistics from file */
-static gboolean _xfdashboard_applications_search_provider_load_statistics(XfdashboardApplicationsSearchProvider *self,
-																			GError **outError)
+/* Switch to generation of snapshot written and restart journal for it. Launches
+ * appended to old journal while the snapshot was written are not covered by it
+ * and are appended to new journal again. The caller must hold the statistics lock.
+ */
+static gboolean _xfdashboard_applications_search_provider_statistics_restart_journal(guint inGeneration, GError **outError)
 {
-	GKeyFile												*keyFile;
-	GList													*allAppIDs;
-	GList													*iter;
-	guint													entriesCount;
-	GError													*error;
+	guint												i;
 
-	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self), FALSE);
 	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
 
-	error=NULL;
+	_xfdashboard_applications_search_provider_statistics.generation=inGeneration;
 
-	/* If no statistics were set up, we cannot load from file */
-	if(!_xfdashboard_applications_search_provider_statistics.stats)
+	/* The snapshot supersedes the key file used by former versions */
+	if(_xfdashboard_applications_search_provider_statistics.legacyFilename)
 	{
-			/* Set error */
-			g_set_error(outError,
-							G_IO_ERROR,
-							G_IO_ERROR_FAILED,
-							_("Statistics were not initialized"));
-
-			return(FALSE);
+		g_unlink(_xfdashboard_applications_search_provider_statistics.legacyFilename);
+		g_free(_xfdashboard_applications_search_provider_statistics.legacyFilename);
+		_xfdashboard_applications_search_provider_statistics.legacyFilename=NULL;
 	}
 
-	/* Get path to statistics file to load statistics from */
-	if(!_xfdashboard_applications_search_provider_statistics.filename)
-	{
-		_xfdashboard_applications_search_provider_statistics.filename=
-			g_build_filename(g_get_user_data_dir(),
-								"xfdashboard",
-								XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_FILE,
-								NULL);
+	/* Restart journal for new generation */
+	_xfdashboard_applications_search_provider_statistics.journalEntries=0;
+	if(!_xfdashboard_applications_search_provider_statistics_open_journal(TRUE, outError)) return(FALSE);
 
-		if(!_xfdashboard_applications_search_provider_statistics.filename)
+	if(_xfdashboard_applications_search_provider_statistics.pendingLaunches)
+	{
+		for(i=0; i<_xfdashboard_applications_search_provider_statistics.pendingLaunches->len; i++)
 		{
-			/* Set error */
-			g_set_error(outError,
-							G_IO_ERROR,
-							G_IO_ERROR_NOT_FOUND,
-							_("Could not build path to statistics file of applications search provider"));
-
-			return(FALSE);
+			if(_xfdashboard_applications_search_provider_statistics_append_journal(g_ptr_array_index(_xfdashboard_applications_search_provider_statistics.pendingLaunches, i)))
+			{
+				_xfdashboard_applications_search_provider_statistics.journalEntries++;
+			}
 		}
 	}
-	XFDASHBOARD_DEBUG(self, APPLICATIONS,
-						"Will load statistics of applications search provider from %s",
-						_xfdashboard_applications_search_provider_statistics.filename);
 
-	/* If statistics file does not exist then return immediately but with success */
-	if(!g_file_test(_xfdashboard_applications_search_provider_statistics.filename, G_FILE_TEST_EXISTS | G_FILE_TEST_IS_REGULAR))
-	{
-		XFDASHBOARD_DEBUG(self, APPLICATIONS,
-							"Statistics file %s does not exists. Will create empty statistics database for applications search provider",
-							_xfdashboard_applications_search_provider_statistics.filename);
+	XFDASHBOARD_DEBUG(NULL, APPLICATIONS,
+						"Compacted statistics of applications search provider into snapshot %s of generation %u",
+						_xfdashboard_applications_search_provider_statistics.snapshotFilename,
+						inGeneration);
+
+	return(TRUE);
+}
 
+/* Write snapshot of all launch counters and restart journal while holding the
+ * statistics lock all the time. This is only used while loading statistics.
+ */
+static gboolean _xfdashboard_applications_search_provider_statistics_compact_locked(GError **outError)
+{
+	GVariant											*snapshot;
+	guint												generation;
+	gboolean											success;
+
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
+
+	/* If we have no filename do not store statistics but do not return error */
+	if(!_xfdashboard_applications_search_provider_statistics.snapshotFilename ||
+		!_xfdashboard_applications_search_provider_statistics.stats)
+	{
 		return(TRUE);
 	}
 
-	/* Load statistics from key file */
-	keyFile=g_key_file_new();
-	if(!g_key_file_load_from_file(keyFile, _xfdashboard_applications_search_provider_statistics.filename, G_KEY_FILE_NONE, &error))
-	{
-		/* Propagate error */
-		g_propagate_error(outError, error);
+	generation=_xfdashboard_applications_search_provider_statistics.generation+1;
+	snapshot=_xfdashboard_applications_search_provider_statistics_build_snapshot();
 
-		/* Release allocated resources */
-		if(keyFile) g_key_file_free(keyFile);
+	success=_xfdashboard_applications_search_provider_statistics_write_snapshot(_xfdashboard_applications_search_provider_statistics.snapshotFilename,
+																				snapshot,
+																				outError);
+	if(success) success=_xfdashboard_applications_search_provider_statistics_restart_journal(generation, outError);
 
-		return(FALSE);
-	}
+	g_variant_unref(snapshot);
 
-	/* Get number of applications and their application desktop IDs from key file */
-	entriesCount=g_key_file_get_integer(keyFile,
-										XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_ENTRIES_GROUP,
-										XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_ENTRIES_COUNT,
-										&error);
-	if(error)
-	{
-		/* Propagate error */
-		g_propagate_error(outError, error);
+	return(success);
+}
 
-		/* Release allocated resources */
-		if(keyFile) g_key_file_free(keyFile);
+/* Write snapshot of all launch counters and restart journal. The caller must
+ * not hold the statistics lock but must have set the compacting flag.
+ *
+ * The counters are copied while holding the statistics lock but the snapshot
+ * is written without it, so launches and searches are not blocked by disk I/O.
+ * The snapshot gets a new generation. If anything fails or crashes after
+ * writing the snapshot but before the journal was restarted, the remaining
+ * journal belongs to the former generation. Only the launches appended to it
+ * after the snapshot was built are replayed when loading, so no launch is
+ * counted twice.
+ */
+static gboolean _xfdashboard_applications_search_provider_statistics_compact(GError **outError)
+{
+	GVariant											*snapshot;
+	gchar												*snapshotFilename;
+	guint												generation;
+	gboolean											success;
 
-		return(FALSE);
-	}
-	XFDASHBOARD_DEBUG(self, APPLICATIONS,
-						"Will load statistics for %d applications",
-						entriesCount);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
 
-	allAppIDs=NULL;
-	while(entriesCount>0)
+	/* Copy counters and remember launches appended from now on */
+	G_LOCK(_xfdashboard_applications_search_provider_statistics_lock);
+
+	g_assert(_xfdashboard_applications_search_provider_statistics.compacting);
+
+	/* If we have no filename do not store statistics but do not return error */
+	if(!_xfdashboard_applications_search_provider_statistics.snapshotFilename ||
+		!_xfdashboard_applications_search_provider_statistics.stats)
 	{
-		gchar											*name;
-		gchar											*appID;
+		G_UNLOCK(_xfdashboard_applications_search_provider_statistics_lock);
+		return(TRUE);
+	}
 
-		/* Get application desktop ID */
-		name=g_strdup_printf("%d", entriesCount);
-		appID=g_key_file_get_string(keyFile,
-									XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_ENTRIES_GROUP,
-									name,
-									&error);
-		g_free(name);
+	generation=_xfdashboard_applications_search_provider_statistics.generation+1;
+	snapshot=_xfdashboard_applications_search_provider_statistics_build_snapshot();
+	snapshotFilename=g_strdup(_xfdashboard_applications_search_provider_statistics.snapshotFilename);
+	_xfdashboard_applications_search_provider_statistics.pendingLaunches=g_ptr_array_new_with_free_func(g_free);
 
-		if(error)
-		{
-			/* Propagate error */
-			g_propagate_error(outError, error);
+	G_UNLOCK(_xfdashboard_applications_search_provider_statistics_lock);
 
-			/* Release allocated resources */
-			if(appID) g_free(appID);
-			if(allAppIDs) g_list_free_full(allAppIDs, g_free);
-			if(keyFile) g_key_file_free(keyFile);
+	/* Write snapshot without holding lock */
+	success=_xfdashboard_applications_search_provider_statistics_write_snapshot(snapshotFilename, snapshot, outError);
 
-			return(FALSE);
-		}
+	/* Switch to new generation */
+	G_LOCK(_xfdashboard_applications_search_provider_statistics_lock);
 
-		/* Store application desktop ID in list to iterate */
-		allAppIDs=g_list_prepend(allAppIDs, appID);
-		XFDASHBOARD_DEBUG(self, APPLICATIONS,
-							"Will load statistics for application '%s'",
-							appID);
+	if(success) success=_xfdashboard_applications_search_provider_statistics_restart_journal(generation, outError);
+
+	g_ptr_array_unref(_xfdashboard_applications_search_provider_statistics.pendingLaunches);
+	_xfdashboard_applications_search_provider_statistics.pendingLaunches=NULL;
+
+	G_UNLOCK(_xfdashboard_applications_search_provider_statistics_lock);
+
+	/* Release allocated resources */
+	g_variant_unref(snapshot);
+	g_free(snapshotFilename);
+
+	return(success);
+}
+
+/* Compact statistics in background */
+static gpointer _xfdashboard_applications_search_provider_statistics_compact_thread(gpointer inUserData)
+{
+	GError												*error;
+	gboolean											success;
+
+	error=NULL;
 
-		/* Continue with next application in entries group */
-		entriesCount--;
+	success=_xfdashboard_applications_search_provider_statistics_compact(&error);
+	if(!success)
+	{
+		g_warning(_("Failed to compact statistics of applications search provider: %s"),
+					error ? error->message : _("Unknown error"));
+		if(error) g_clear_error(&error);
 	}
 
-	/* Iterate through all application desktop IDs and create statistics data
-	 * with default values for each one first. Then try to load stored values
-	 * from key file.
+	/* Lock for thread-safety */
+	G_LOCK(_xfdashboard_applications_search_provider_statistics_lock);
+
+	/* Do not try again at each following launch if compaction failed but only
+	 * after as many launches as needed to trigger a compaction and at shutdown.
 	 */
-	for(iter=allAppIDs; iter; iter=g_list_next(iter))
+	if(!success) _xfdashboard_applications_search_provider_statistics.compactRetryLaunches=XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_COMPACT_THRESHOLD;
+		else _xfdashboard_applications_search_provider_statistics.compactRetryLaunches=0;
+
+	_xfdashboard_applications_search_provider_statistics.compacting=FALSE;
+	g_cond_broadcast(&_xfdashboard_applications_search_provider_statistics.compactingDone);
+
+	/* Unlock for thread-safety */
+	G_UNLOCK(_xfdashboard_applications_search_provider_statistics_lock);
+
+	return(NULL);
+}
+
+/* Start compacting statistics in background if journal has grown long enough
+ * or could not be appended to anymore and no compaction is running. After a
+ * failed compaction it is delayed by some launches. The caller must hold the
+ * statistics lock.
+ */
+static void _xfdashboard_applications_search_provider_statistics_schedule_compaction(void)
+{
+	GThread												*thread;
+
+	if(_xfdashboard_applications_search_provider_statistics.compacting) return;
+
+	if(_xfdashboard_applications_search_provider_statistics.compactRetryLaunches>0)
+	{
+		_xfdashboard_applications_search_provider_statistics.compactRetryLaunches--;
+		return;
+	}
+
+	if(_xfdashboard_applications_search_provider_statistics.journalFD>=0 &&
+		_xfdashboard_applications_search_provider_statistics.journalEntries<XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_COMPACT_THRESHOLD)
+	{
+		return;
+	}
+
+	_xfdashboard_applications_search_provider_statistics.compacting=TRUE;
+
+	thread=g_thread_new("xfdashboard-statistics",
+						_xfdashboard_applications_search_provider_statistics_compact_thread,
+						NULL);
+	g_thread_unref(thread);
+}
+
+/* Wait until a compaction running in background has finished. The caller must
+ * hold the statistics lock.
+ */
+static void _xfdashboard_applications_search_provider_statistics_wait_compaction(void)
+{
+	while(_xfdashboard_applications_search_provider_statistics.compacting)
 	{
-		const gchar											*appID;
-		XfdashboardApplicationsSearchProviderStatistics		*stats;
+		g_cond_wait(&_xfdashboard_applications_search_provider_statistics.compactingDone,
+					&G_LOCK_NAME(_xfdashboard_applications_search_provider_statistics_lock));
+	}
+}
+
+/* An application was launched successfully */
+static void _xfdashboard_applications_search_provider_on_application_launched(XfdashboardApplication *inApplication,
+																				GAppInfo *inAppInfo,
+																				gpointer inUserData)
+{
+	const gchar											*appID;
+
+	g_return_if_fail(G_IS_APP_INFO(inAppInfo));
+
+	/* Get application ID which is used to lookup and store statistics */
+	appID=g_app_info_get_id(inAppInfo);
+	if(!appID || !*appID) return;
+
+	/* Lock for thread-safety */
+	G_LOCK(_xfdashboard_applications_search_provider_statistics_lock);
+
+	/* Update statistics in memory */
+	_xfdashboard_applications_search_provider_statistics_increase(appID, 1);
+
+	/* Append launch event to journal. Also remember it if a snapshot is
+	 * written currently which does not cover it, even if it could not be
+	 * appended, so it is stored in journal of new generation.
+	 */
+	if(_xfdashboard_applications_search_provider_statistics_append_journal(appID))
+	{
+		_xfdashboard_applications_search_provider_statistics.journalEntries++;
+	}
+
+	if(_xfdashboard_applications_search_provider_statistics.pendingLaunches)
+	{
+		g_ptr_array_add(_xfdashboard_applications_search_provider_statistics.pendingLaunches, g_strdup(appID));
+	}
+
+	/* Compact statistics if journal has grown long enough or is broken */
+	_xfdashboard_applications_search_provider_statistics_schedule_compaction();
+
+	/* Unlock for thread-safety */
+	G_UNLOCK(_xfdashboard_applications_search_provider_statistics_lock);
+}
+
+/* Load statistics from key file written by former versions which did not use
+ * snapshots and journals. The caller must hold the statistics lock.
+ */
+static gboolean _xfdashboard_applications_search_provider_statistics_load_legacy(XfdashboardApplicationsSearchProvider *self,
+																					GError **outError)
+{
+	GKeyFile											*keyFile;
+	gchar												**allAppIDs;
+	gchar												**iter;
+	gint												usedCounter;
+	GError												*error;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self), FALSE);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
+
+	error=NULL;
+
+	/* Load statistics from key file */
+	keyFile=g_key_file_new();
+	if(!g_key_file_load_from_file(keyFile, _xfdashboard_applications_search_provider_statistics.legacyFilename, G_KEY_FILE_NONE, &error))
+	{
+		/* Propagate error */
+		g_propagate_error(outError, error);
+
+		/* Release allocated resources */
+		if(keyFile) g_key_file_free(keyFile);
+
+		return(FALSE);
+	}
+
+	/* Only launch counters of applications which were launched at least once
+	 * were stored, so iterate through them.
+	 */
+	allAppIDs=g_key_file_get_keys(keyFile,
+									XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_USED_COUNTER_GROUP,
+									NULL,
+									NULL);
+	for(iter=allAppIDs; iter && *iter; iter++)
+	{
+		usedCounter=g_key_file_get_integer(keyFile,
+											XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_USED_COUNTER_GROUP,
+											*iter,
+											&error);
+		if(error)
+		{
+			g_critical(_("Could not get value from group [%s] for application %s from statistics file of applications search provider: %s"),
+						XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_USED_COUNTER_GROUP,
+						*iter,
+						error->message);
+			g_clear_error(&error);
+			continue;
+		}
+
+		if(usedCounter>0) _xfdashboard_applications_search_provider_statistics_increase(*iter, usedCounter);
+		XFDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Loaded statistics for '%s' from key file %s",
+							*iter,
+							_xfdashboard_applications_search_provider_statistics.legacyFilename);
+	}
+
+	/* Release allocated resources */
+	if(allAppIDs) g_strfreev(allAppIDs);
+	if(keyFile) g_key_file_free(keyFile);
+
+	return(TRUE);
+}
+
+/* Load statistics from snapshot file and return the size of journal of former
+ * generation covered by it. The caller must hold the statistics lock.
+ */
+static gboolean _xfdashboard_applications_search_provider_statistics_load_snapshot(XfdashboardApplicationsSearchProvider *self,
+																					guint64 *outJournalOffset,
+																					GError **outError)
+{
+	GMappedFile											*mappedFile;
+	GVariant											*snapshot;
+	guint32												magic;
+	guint32												version;
+	guint32												generation;
+	guint64												journalOffset;
+	GVariantIter										*counters;
+	const gchar											*appID;
+	guint32												usedCounter;
+	GError												*error;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self), FALSE);
+	g_return_val_if_fail(outJournalOffset, FALSE);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
+
+	error=NULL;
+	*outJournalOffset=0;
+
+	/* Map snapshot file into memory. If it does not exist try to load the key
+	 * file of former versions. If neither exists start with empty statistics.
+	 */
+	mappedFile=g_mapped_file_new(_xfdashboard_applications_search_provider_statistics.snapshotFilename, FALSE, &error);
+	if(!mappedFile)
+	{
+		if(!g_error_matches(error, G_FILE_ERROR, G_FILE_ERROR_NOENT))
+		{
+			/* Propagate error */
+			g_propagate_error(outError, error);
+
+			return(FALSE);
+		}
+		g_clear_error(&error);
+
+		if(g_file_test(_xfdashboard_applications_search_provider_statistics.legacyFilename, G_FILE_TEST_EXISTS | G_FILE_TEST_IS_REGULAR))
+		{
+			return(_xfdashboard_applications_search_provider_statistics_load_legacy(self, outError));
+		}
+
+		XFDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Statistics file %s does not exists. Will create empty statistics database for applications search provider",
+							_xfdashboard_applications_search_provider_statistics.snapshotFilename);
+
+		return(TRUE);
+	}
+
+	/* The mapped file is owned by the variant from now on and the data is not
+	 * trusted so any corruption results in default values but never in reading
+	 * beyond mapped memory.
+	 */
+	snapshot=g_variant_new_from_data(G_VARIANT_TYPE(XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_SNAPSHOT_FORMAT),
+										g_mapped_file_get_contents(mappedFile),
+										g_mapped_file_get_length(mappedFile),
+										FALSE,
+										(GDestroyNotify)g_mapped_file_unref,
+										mappedFile);
+	g_variant_ref_sink(snapshot);
+
+	g_variant_get(snapshot,
+					XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_SNAPSHOT_FORMAT,
+					&magic,
+					&version,
+					&generation,
+					&journalOffset,
+					&counters);
+
+	/* Do not load a snapshot written by another version because it would be
+	 * overridden when compacting.
+	 */
+	if(magic!=XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_SNAPSHOT_MAGIC ||
+		version!=XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_SNAPSHOT_VERSION)
+	{
+		/* Set error */
+		g_set_error(outError,
+						G_IO_ERROR,
+						G_IO_ERROR_INVALID_DATA,
+						_("Unsupported statistics file of applications search provider"));
+
+		/* Release allocated resources */
+		g_variant_iter_free(counters);
+		g_variant_unref(snapshot);
+
+		return(FALSE);
+	}
+
+	while(g_variant_iter_next(counters, "(&su)", &appID, &usedCounter))
+	{
+		if(*appID && usedCounter>0) _xfdashboard_applications_search_provider_statistics_increase(appID, usedCounter);
+	}
+
+	_xfdashboard_applications_search_provider_statistics.generation=generation;
+	*outJournalOffset=journalOffset;
+
+	/* A snapshot exists so the key file of former versions is not needed anymore */
+	g_free(_xfdashboard_applications_search_provider_statistics.legacyFilename);
+	_xfdashboard_applications_search_provider_statistics.legacyFilename=NULL;
+
+	XFDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Loaded snapshot of generation %u with statistics for %u applications from %s",
+						generation,
+						g_hash_table_size(_xfdashboard_applications_search_provider_statistics.stats),
+						_xfdashboard_applications_search_provider_statistics.snapshotFilename);
+
+	/* Release allocated resources */
+	g_variant_iter_free(counters);
+	g_variant_unref(snapshot);
+
+	return(TRUE);
+}
+
+/* Check if line of journal is a launch event, i.e. a desktop ID */
+static gboolean _xfdashboard_applications_search_provider_statistics_is_valid_launch(const gchar *inData, gsize inLength)
+{
+	static const gchar									suffix[]=".desktop";
+
+	if(inLength<=strlen(suffix)) return(FALSE);
+	if(memchr(inData, '#', inLength)) return(FALSE);
+	if(strncmp(inData+inLength-strlen(suffix), suffix, strlen(suffix))!=0) return(FALSE);
+	if(!g_utf8_validate(inData, inLength, NULL)) return(FALSE);
+
+	return(TRUE);
+}
+
+/* Replay launch events from journal. A journal belonging to the generation of
+ * loaded snapshot is replayed completely. A journal of the former generation is
+ * left if the journal could not be restarted after the snapshot was written, so
+ * only launches appended after the given offset, which are not covered by the
+ * snapshot, are replayed. Returns TRUE if journal can be continued, FALSE if it
+ * must be restarted. The caller must hold the statistics lock.
+ */
+static gboolean _xfdashboard_applications_search_provider_statistics_load_journal(XfdashboardApplicationsSearchProvider *self,
+																					guint64 inJournalOffset)
+{
+	GMappedFile											*mappedFile;
+	const gchar											*data;
+	const gchar											*dataEnd;
+	const gchar											*lineEnd;
+	gchar												*line;
+	gchar												*header;
+	gboolean											isCurrent;
+	gboolean											isFormer;
+	guint												skipped;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self), FALSE);
+
+	/* Map journal file into memory */
+	mappedFile=g_mapped_file_new(_xfdashboard_applications_search_provider_statistics.journalFilename, FALSE, NULL);
+	if(!mappedFile) return(FALSE);
+
+	data=g_mapped_file_get_contents(mappedFile);
+	dataEnd=data+g_mapped_file_get_length(mappedFile);
+
+	/* Check header for generation */
+	header=g_strdup_printf("#%u\n", _xfdashboard_applications_search_provider_statistics.generation);
+	isCurrent=((gsize)(dataEnd-data)>=strlen(header) && strncmp(data, header, strlen(header))==0);
+	if(isCurrent) data+=strlen(header);
+	g_free(header);
+
+	isFormer=FALSE;
+	if(!isCurrent && _xfdashboard_applications_search_provider_statistics.generation>0)
+	{
+		header=g_strdup_printf("#%u\n", _xfdashboard_applications_search_provider_statistics.generation-1);
+		isFormer=((gsize)(dataEnd-data)>=strlen(header) &&
+					strncmp(data, header, strlen(header))==0 &&
+					inJournalOffset>=strlen(header) &&
+					inJournalOffset<=(guint64)(dataEnd-data));
+		if(isFormer) data+=inJournalOffset;
+		g_free(header);
+	}
+
+	if(!isCurrent && !isFormer)
+	{
+		XFDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Ignoring statistics journal %s not belonging to generation %u",
+							_xfdashboard_applications_search_provider_statistics.journalFilename,
+							_xfdashboard_applications_search_provider_statistics.generation);
+
+		/* Release allocated resources */
+		g_mapped_file_unref(mappedFile);
+
+		return(FALSE);
+	}
+
+	/* Replay each complete line as one launch but skip malformed lines. An
+	 * incomplete last line may be left by an interrupted write and is ignored.
+	 */
+	skipped=0;
+	while(data<dataEnd &&
+			(lineEnd=memchr(data, '\n', dataEnd-data)))
+	{
+		if(_xfdashboard_applications_search_provider_statistics_is_valid_launch(data, lineEnd-data))
+		{
+			line=g_strndup(data, lineEnd-data);
+			_xfdashboard_applications_search_provider_statistics_increase(line, 1);
+			_xfdashboard_applications_search_provider_statistics.journalEntries++;
+			g_free(line);
+		}
+			else skipped++;
+
+		data=lineEnd+1;
+	}
+
+	XFDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Replayed %u launches and skipped %u malformed lines from statistics journal %s",
+						_xfdashboard_applications_search_provider_statistics.journalEntries,
+						skipped,
+						_xfdashboard_applications_search_provider_statistics.journalFilename);
+
+	/* Release allocated resources */
+	g_mapped_file_unref(mappedFile);
+
+	/* Do not continue journal of former generation or after an incomplete line */
+	return(isCurrent && data>=dataEnd);
+}
+
+/* Load statistics from snapshot and journal files */
+static gboolean _xfdashboard_applications_search_provider_load_statistics(XfdashboardApplicationsSearchProvider *self,
+																			GError **outError)
+{
+	gchar													*fileFolder;
+	guint64													journalOffset;
+	gboolean												continueJournal;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self), FALSE);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
+
+	/* If no statistics were set up, we cannot load from file */
+	if(!_xfdashboard_applications_search_provider_statistics.stats)
+	{
+			/* Set error */
+			g_set_error(outError,
+							G_IO_ERROR,
+							G_IO_ERROR_FAILED,
+							_("Statistics were not initialized"));
+
+			return(FALSE);
+	}
+
+	/* Get path to statistics files to load statistics from */
+	fileFolder=g_build_filename(g_get_user_data_dir(), "xfdashboard", NULL);
+	if(!fileFolder)
+	{
+		/* Set error */
+		g_set_error(outError,
+						G_IO_ERROR,
+						G_IO_ERROR_NOT_FOUND,
+						_("Could not build path to statistics file of applications search provider"));
+
+		return(FALSE);
+	}
+
+	_xfdashboard_applications_search_provider_statistics.snapshotFilename=
+		g_build_filename(fileFolder, XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_SNAPSHOT_FILE, NULL);
+	_xfdashboard_applications_search_provider_statistics.journalFilename=
+		g_build_filename(fileFolder, XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_JOURNAL_FILE, NULL);
+	_xfdashboard_applications_search_provider_statistics.legacyFilename=
+		g_build_filename(fileFolder, XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_LEGACY_FILE, NULL);
+	g_free(fileFolder);
+
+	XFDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Will load statistics of applications search provider from %s",
+						_xfdashboard_applications_search_provider_statistics.snapshotFilename);
+
+	/* Load snapshot and replay launches from journal on top of it */
+	if(!_xfdashboard_applications_search_provider_statistics_load_snapshot(self, &journalOffset, outError)) return(FALSE);
+
+	continueJournal=_xfdashboard_applications_search_provider_statistics_load_journal(self, journalOffset);
+	if(!continueJournal &&
+		_xfdashboard_applications_search_provider_statistics.journalEntries>0)
+	{
+		/* Journal cannot be continued but launches were replayed from it, so
+		 * store them in a new snapshot before journal is restarted.
+		 */
+		if(!_xfdashboard_applications_search_provider_statistics_compact_locked(outError)) return(FALSE);
+	}
+		else if(!_xfdashboard_applications_search_provider_statistics_open_journal(!continueJournal, outError)) return(FALSE);
+
+	/* Compact statistics now if journal has grown long enough */
+	_xfdashboard_applications_search_provider_statistics_schedule_compaction();
+
+	/* If we get here loading statistics file was successful */
+	XFDASHBOARD_DEBUG(self, APPLICATIONS,
+						"Loaded statistics of applications search provider from %s",
+						_xfdashboard_applications_search_provider_statistics.snapshotFilename);
+
+	return(TRUE);
+}
+
+/* Free filenames and close journal of statistics. The caller must hold the
+ * statistics lock.
+ */
+static void _xfdashboard_applications_search_provider_statistics_release_files(void)
+{
+	if(_xfdashboard_applications_search_provider_statistics.journalFD>=0)
+	{
+		close(_xfdashboard_applications_search_provider_statistics.journalFD);
+		_xfdashboard_applications_search_provider_statistics.journalFD=-1;
+	}
+
+	if(_xfdashboard_applications_search_provider_statistics.snapshotFilename)
+	{
+		g_free(_xfdashboard_applications_search_provider_statistics.snapshotFilename);
+		_xfdashboard_applications_search_provider_statistics.snapshotFilename=NULL;
+	}
+
+	if(_xfdashboard_applications_search_provider_statistics.journalFilename)
+	{
+		g_free(_xfdashboard_applications_search_provider_statistics.journalFilename);
+		_xfdashboard_applications_search_provider_statistics.journalFilename=NULL;
+	}
+
+	if(_xfdashboard_applications_search_provider_statistics.legacyFilename)
+	{
+		g_free(_xfdashboard_applications_search_provider_statistics.legacyFilename);
+		_xfdashboard_applications_search_provider_statistics.legacyFilename=NULL;
+	}
+}
+
+/* Destroy statistics for this search provider */
+static void _xfdashboard_applications_search_provider_destroy_statistics(void)
+{
+	XfdashboardApplication			*application;
+	GError							*error;
+
+	error=NULL;
+
+	/* Only existing statistics can be destroyed */
+	if(!_xfdashboard_applications_search_provider_statistics.stats) return;
+
+	/* Lock for thread-safety */
+	G_LOCK(_xfdashboard_applications_search_provider_statistics_lock);
+
+	/* Get application instance */
+	application=xfdashboard_application_get_default();
+
+	/* Disconnect application "shutdown" signal handler */
+	if(_xfdashboard_applications_search_provider_statistics.shutdownSignalID)
+	{
+		g_signal_handler_disconnect(application, _xfdashboard_applications_search_provider_statistics.shutdownSignalID);
+		_xfdashboard_applications_search_provider_statistics.shutdownSignalID=0;
+	}
+
+	/* Disconnect application "application-launched" signal handler */
+	if(_xfdashboard_applications_search_provider_statistics.applicationLaunchedSignalID)
+	{
+		g_signal_handler_disconnect(application, _xfdashboard_applications_search_provider_statistics.applicationLaunchedSignalID);
+		_xfdashboard_applications_search_provider_statistics.applicationLaunchedSignalID=0;
+	}
+
+	/* Compact statistics to keep next start-up short after a compaction running
+	 * in background has finished. No launch is tracked anymore, so the lock can
+	 * be released while compacting. All launches are already stored in journal
+	 * so nothing is lost if this fails.
+	 */
+	_xfdashboard_applications_search_provider_statistics_wait_compaction();
+
+	if(_xfdashboard_applications_search_provider_statistics.journalEntries>0 ||
+		_xfdashboard_applications_search_provider_statistics.journalFD<0)
+	{
+		_xfdashboard_applications_search_provider_statistics.compacting=TRUE;
+		G_UNLOCK(_xfdashboard_applications_search_provider_statistics_lock);
+
+		if(!_xfdashboard_applications_search_provider_statistics_compact(&error))
+		{
+			g_critical(_("Failed to save statistics of applications search provider: %s"),
+						error ? error->message : _("Unknown error"));
+			if(error) g_clear_error(&error);
+		}
+
+		G_LOCK(_xfdashboard_applications_search_provider_statistics_lock);
+		_xfdashboard_applications_search_provider_statistics.compacting=FALSE;
+	}
+
+	/* Destroy statistics */
+	XFDASHBOARD_DEBUG(NULL, APPLICATIONS, "Destroying statistics of applications search provider");
+	g_hash_table_destroy(_xfdashboard_applications_search_provider_statistics.stats);
+	_xfdashboard_applications_search_provider_statistics.stats=NULL;
+
+	/* Close journal and destroy filenames for statistics */
+	_xfdashboard_applications_search_provider_statistics_release_files();
+
+	/* Reset other variables */
+	_xfdashboard_applications_search_provider_statistics.maxUsedCounter=0;
+	_xfdashboard_applications_search_provider_statistics.generation=0;
+	_xfdashboard_applications_search_provider_statistics.journalEntries=0;
+	_xfdashboard_applications_search_provider_statistics.compactRetryLaunches=0;
+
+	/* Unlock for thread-safety */
+	G_UNLOCK(_xfdashboard_applications_search_provider_statistics_lock);
+}
+
+/* Create and load statistics for this search provider if not done already */
+static void _xfdashboard_applications_search_provider_create_statistics(XfdashboardApplicationsSearchProvider *self)
+{
+	XfdashboardApplication			*application;
+	GError							*error;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self));
+
+	error=NULL;
+
+	/* Statistics were already set up */
+	if(_xfdashboard_applications_search_provider_statistics.stats) return;
+
+	g_assert(!_xfdashboard_applications_search_provider_statistics.shutdownSignalID);
+	g_assert(!_xfdashboard_applications_search_provider_statistics.applicationLaunchedSignalID);
+
+	/* Lock for thread-safety */
+	G_LOCK(_xfdashboard_applications_search_provider_statistics_lock);
+
+	/* Initialize non-critical variables */
+	_xfdashboard_applications_search_provider_statistics.maxUsedCounter=0;
+	_xfdashboard_applications_search_provider_statistics.generation=0;
+	_xfdashboard_applications_search_provider_statistics.journalEntries=0;
+	_xfdashboard_applications_search_provider_statistics.compactRetryLaunches=0;
+	_xfdashboard_applications_search_provider_statistics.journalSize=0;
+	_xfdashboard_applications_search_provider_statistics.journalFD=-1;
+
+	/* Create hash-table for statistics */
+	_xfdashboard_applications_search_provider_statistics.stats=
+		g_hash_table_new_full(g_str_hash,
+								g_str_equal,
+								g_free,
+								(GDestroyNotify)_xfdashboard_applications_search_provider_statistics_unref);
+	XFDASHBOARD_DEBUG(self, APPLICATIONS, "Created statistics of applications search provider");
+
+	/* Load statistics from file */
+	if(!_xfdashboard_applications_search_provider_load_statistics(self, &error))
+	{
+		g_critical(_("Failed to load statistics of applications search provider from %s: %s"),
+					_xfdashboard_applications_search_provider_statistics.snapshotFilename,
+					error ? error->message : _("Unknown error"));
+		if(error) g_clear_error(&error);
+
+		/* Destroy hash-table to avoid the half-loaded hash-table being stored again
+		 * and overriding existing statistics file (even if it may be broken).
+		 * Also close journal and release filenames.
+		 */
+		if(_xfdashboard_applications_search_provider_statistics.stats)
+		{
+			g_hash_table_destroy(_xfdashboard_applications_search_provider_statistics.stats);
+			_xfdashboard_applications_search_provider_statistics.stats=NULL;
+		}
+
+		_xfdashboard_applications_search_provider_statistics_release_files();
+
+		/* Unlock for thread-safety */
+		G_UNLOCK(_xfdashboard_applications_search_provider_statistics_lock);
+
+		/* Return here to prevent further initializations of statistics
+		 * which are not used and not deinitialized in 'destroy' function.
+		 */
+		return;
+	}
+
+	/* Get application instance */
+	application=xfdashboard_application_get_default();
+
+	/* Connect to "shutdown" signal of application to clean up statistics */
+	_xfdashboard_applications_search_provider_statistics.shutdownSignalID=
+		g_signal_connect(application,
+							"shutdown-final",
+							G_CALLBACK(_xfdashboard_applications_search_provider_destroy_statistics),
+							NULL);
+
+	/* Connect to "application-launched" signal of application to track app launches */
+	_xfdashboard_applications_search_provider_statistics.applicationLaunchedSignalID=
+		g_signal_connect(application,
+							"application-launched",
+							G_CALLBACK(_xfdashboard_applications_search_provider_on_application_launched),
+							NULL);
+
+	/* Unlock for thread-safety */
+	G_UNLOCK(_xfdashboard_applications_search_provider_statistics_lock);
+}
+
+/* Quark declarations */
+static GQuark _xfdashboard_applications_search_provider_index_serial_quark(void)
+{
+	return(g_quark_from_static_string("xfdashboard-applications-search-provider-index-serial-quark"));
+}
+
+/* Get normalized and lower-cased copy of text as it is indexed and compared
+ * against search terms.
+ */
+static gchar* _xfdashboard_applications_search_provider_normalize_text(const gchar *inText)
+{
+	gchar												*normalized;
+	gchar												*result;
+
+	g_return_val_if_fail(inText, NULL);
+
+	normalized=g_utf8_normalize(inText, -1, G_NORMALIZE_ALL);
+	if(!normalized) return(g_utf8_strdown(inText, -1));
+
+	result=g_utf8_strdown(normalized, -1);
+	g_free(normalized);
+
+	return(result);
+}
+
+/* Create, destroy, ref and unref index entry of an application. Index entries
+ * are not modified after creation and may be shared by several snapshots of
+ * the index which can be used in other threads.
+ */
+static XfdashboardApplicationsSearchProviderIndexEntry* _xfdashboard_applications_search_provider_index_entry_new(GAppInfo *inAppInfo)
+{
+	XfdashboardApplicationsSearchProviderIndexEntry		*entry;
+	const gchar											*value;
+
+	g_return_val_if_fail(G_IS_APP_INFO(inAppInfo), NULL);
+
+	/* Create index entry and store all texts to match search terms against
+	 * in the form they are compared, i.e. title, description, keywords and
+	 * base name of executable normalized and in lower-case. Also store all
+	 * information about application needed while searching to avoid accessing
+	 * application in another thread.
+	 */
+	entry=g_new0(XfdashboardApplicationsSearchProviderIndexEntry, 1);
+	entry->refCount=1;
+	entry->appInfo=G_APP_INFO(g_object_ref(inAppInfo));
+	entry->desktopID=g_strdup(g_app_info_get_id(inAppInfo));
+	entry->shouldShow=g_app_info_should_show(inAppInfo);
+
+	value=g_app_info_get_display_name(inAppInfo);
+	if(value) entry->title=_xfdashboard_applications_search_provider_normalize_text(value);
+
+	value=g_app_info_get_description(inAppInfo);
+	if(value) entry->description=_xfdashboard_applications_search_provider_normalize_text(value);
+
+	value=g_app_info_get_executable(inAppInfo);
+	if(value)
+	{
+		gchar											*basename;
+
+		basename=g_path_get_basename(value);
+		entry->command=_xfdashboard_applications_search_provider_normalize_text(basename);
+		g_free(basename);
+	}
+
+	if(XFDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo))
+	{
+		GList											*appKeywords;
+		GList											*iter;
+		gchar											**keywordsIter;
+
+		appKeywords=xfdashboard_desktop_app_info_get_keywords(XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo));
+		if(appKeywords)
+		{
+			entry->keywords=g_new0(gchar*, g_list_length(appKeywords)+1);
+
+			keywordsIter=entry->keywords;
+			for(iter=appKeywords; iter; iter=g_list_next(iter))
+			{
+				if(!iter->data) continue;
+
+				*keywordsIter=_xfdashboard_applications_search_provider_normalize_text(iter->data);
+				keywordsIter++;
+			}
+		}
+	}
+
+	return(entry);
+}
+
+static void _xfdashboard_applications_search_provider_index_entry_free(XfdashboardApplicationsSearchProviderIndexEntry *inData)
+{
+	g_return_if_fail(inData);
+
+	/* Release allocated resources */
+	if(inData->appInfo) g_object_unref(inData->appInfo);
+	if(inData->desktopID) g_free(inData->desktopID);
+	if(inData->title) g_free(inData->title);
+	if(inData->description) g_free(inData->description);
+	if(inData->keywords) g_strfreev(inData->keywords);
+	if(inData->command) g_free(inData->command);
+	g_free(inData);
+}
+
+static XfdashboardApplicationsSearchProviderIndexEntry* _xfdashboard_applications_search_provider_index_entry_ref(XfdashboardApplicationsSearchProviderIndexEntry *inData)
+{
+	g_return_val_if_fail(inData, NULL);
+
+	g_atomic_int_inc(&inData->refCount);
+	return(inData);
+}
+
+static void _xfdashboard_applications_search_provider_index_entry_unref(XfdashboardApplicationsSearchProviderIndexEntry *inData)
+{
+	g_return_if_fail(inData);
+
+	if(g_atomic_int_dec_and_test(&inData->refCount)) _xfdashboard_applications_search_provider_index_entry_free(inData);
+}
+
+/* Create, destroy, ref and unref index */
+static XfdashboardApplicationsSearchProviderIndex* _xfdashboard_applications_search_provider_index_new(void)
+{
+	XfdashboardApplicationsSearchProviderIndex			*index;
+
+	index=g_new0(XfdashboardApplicationsSearchProviderIndex, 1);
+	index->refCount=1;
+	index->serial=1;
+	index->entries=g_hash_table_new_full(g_direct_hash,
+											g_direct_equal,
+											NULL,
+											(GDestroyNotify)_xfdashboard_applications_search_provider_index_entry_unref);
+	index->desktopIDs=g_hash_table_new(g_str_hash, g_str_equal);
+	index->ngrams=g_hash_table_new_full(g_direct_hash,
+											g_direct_equal,
+											NULL,
+											(GDestroyNotify)g_ptr_array_unref);
+
+	return(index);
+}
+
+static void _xfdashboard_applications_search_provider_index_free(XfdashboardApplicationsSearchProviderIndex *inIndex)
+{
+	g_return_if_fail(inIndex);
+
+	/* Release allocated resources */
+	if(inIndex->ngrams) g_hash_table_destroy(inIndex->ngrams);
+	if(inIndex->desktopIDs) g_hash_table_destroy(inIndex->desktopIDs);
+	if(inIndex->entries) g_hash_table_destroy(inIndex->entries);
+	g_free(inIndex);
+}
+
+static XfdashboardApplicationsSearchProviderIndex* _xfdashboard_applications_search_provider_index_ref(XfdashboardApplicationsSearchProviderIndex *inIndex)
+{
+	g_return_val_if_fail(inIndex, NULL);
+
+	g_atomic_int_inc(&inIndex->refCount);
+	return(inIndex);
+}
+
+static void _xfdashboard_applications_search_provider_index_unref(XfdashboardApplicationsSearchProviderIndex *inIndex)
+{
+	g_return_if_fail(inIndex);
+
+	if(g_atomic_int_dec_and_test(&inIndex->refCount)) _xfdashboard_applications_search_provider_index_free(inIndex);
+}
+
+/* Create a copy of index sharing its index entries */
+static XfdashboardApplicationsSearchProviderIndex* _xfdashboard_applications_search_provider_index_copy(XfdashboardApplicationsSearchProviderIndex *inIndex)
+{
+	XfdashboardApplicationsSearchProviderIndex			*index;
+	XfdashboardApplicationsSearchProviderIndexEntry		*entry;
+	GHashTableIter										iter;
+	gpointer											ngram;
+	GPtrArray											*entries;
+	GPtrArray											*copy;
+	guint												i;
+
+	g_return_val_if_fail(inIndex, NULL);
+
+	index=_xfdashboard_applications_search_provider_index_new();
+	index->serial=inIndex->serial;
+
+	g_hash_table_iter_init(&iter, inIndex->entries);
+	while(g_hash_table_iter_next(&iter, NULL, (gpointer*)&entry))
+	{
+		g_hash_table_insert(index->entries, entry->appInfo, _xfdashboard_applications_search_provider_index_entry_ref(entry));
+	}
+
+	g_hash_table_iter_init(&iter, inIndex->desktopIDs);
+	while(g_hash_table_iter_next(&iter, NULL, (gpointer*)&entry))
+	{
+		g_hash_table_insert(index->desktopIDs, entry->desktopID, entry);
+	}
+
+	g_hash_table_iter_init(&iter, inIndex->ngrams);
+	while(g_hash_table_iter_next(&iter, &ngram, (gpointer*)&entries))
+	{
+		copy=g_ptr_array_sized_new(entries->len);
+		for(i=0; i<entries->len; i++) g_ptr_array_add(copy, g_ptr_array_index(entries, i));
+		g_hash_table_insert(index->ngrams, ngram, copy);
+	}
+
+	return(index);
+}
+
+/* Get snapshot of index which is not modified anymore and can be used in
+ * any thread. The returned snapshot must be freed with
+ * _xfdashboard_applications_search_provider_index_unref().
+ */
+static XfdashboardApplicationsSearchProviderIndex* _xfdashboard_applications_search_provider_index_get_snapshot(XfdashboardApplicationsSearchProvider *self)
+{
+	XfdashboardApplicationsSearchProviderIndex			*index;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self), NULL);
+
+	G_LOCK(_xfdashboard_applications_search_provider_index_lock);
+	index=_xfdashboard_applications_search_provider_index_ref(self->priv->index);
+	G_UNLOCK(_xfdashboard_applications_search_provider_index_lock);
+
+	return(index);
+}
+
+/* Get index to modify. If the current index is used as a snapshot anywhere
+ * else it is copied first so that no snapshot is ever modified.
+ * Must be called with index lock held.
+ */
+static XfdashboardApplicationsSearchProviderIndex* _xfdashboard_applications_search_provider_index_get_writable(XfdashboardApplicationsSearchProvider *self)
+{
+	XfdashboardApplicationsSearchProviderPrivate		*priv;
+	XfdashboardApplicationsSearchProviderIndex			*index;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self), NULL);
+
+	priv=self->priv;
+
+	if(g_atomic_int_get(&priv->index->refCount)>1)
+	{
+		index=_xfdashboard_applications_search_provider_index_copy(priv->index);
+		_xfdashboard_applications_search_provider_index_unref(priv->index);
+		priv->index=index;
+	}
+
+	return(priv->index);
+}
+
+/* Get key of n-gram of given length at start of text. The bytes are stored
+ * left-aligned, so n-grams of different length never get the same key as
+ * texts do not contain NUL bytes.
+ */
+static gpointer _xfdashboard_applications_search_provider_get_ngram(const gchar *inText,
+																	guint inLength)
+{
+	guint												key;
+	guint												i;
+
+	key=0;
+	for(i=0; i<XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_NGRAM_MAX_LENGTH; i++)
+	{
+		key<<=8;
+		if(i<inLength) key|=(guint)(guchar)inText[i];
+	}
+
+	return(GUINT_TO_POINTER(key));
+}
+
+/* Add or remove index entry to resp. from list of applications of each n-gram
+ * found in given text.
+ */
+static void _xfdashboard_applications_search_provider_index_text(XfdashboardApplicationsSearchProviderIndex *inIndex,
+																	XfdashboardApplicationsSearchProviderIndexEntry *inEntry,
+																	const gchar *inText,
+																	gboolean inAdd)
+{
+	GPtrArray											*entries;
+	gpointer											ngram;
+	guint												length;
 
-		/* Get current iterated application desktop ID */
-		appID=(const gchar*)iter->data;
+	g_return_if_fail(inIndex);
+	g_return_if_fail(inEntry);
 
-		/* Create statistics data for application with default values */
-		stats=_xfdashboard_applications_search_provider_statistics_new();
-		if(!stats)
-		{
-			g_critical(_("Could not create statistics data for application '%s' of applications search provider"), appID);
-			continue;
-		}
+	if(!inText) return;
 
-		/* Try to load stored values for application from key file */
-		if(g_key_file_has_key(keyFile, XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_USED_COUNTER_GROUP, appID, NULL))
+	while(*inText)
+	{
+		for(length=1; length<=XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_NGRAM_MAX_LENGTH && inText[length-1]; length++)
 		{
-			stats->usedCounter=g_key_file_get_integer(keyFile,
-														XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_USED_COUNTER_GROUP,
-														appID,
-														&error);
-			if(error)
-			{
-				g_critical(_("Could not get value from group [%s] for application %s from statistics file of applications search provider: %s"),
-							XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_STATISTICS_USED_COUNTER_GROUP,
-							appID,
-							error->message);
-				g_clear_error(&error);
-			}
+			ngram=_xfdashboard_applications_search_provider_get_ngram(inText, length);
+			entries=(GPtrArray*)g_hash_table_lookup(inIndex->ngrams, ngram);
 
-			if(stats->usedCounter>_xfdashboard_applications_search_provider_statistics.maxUsedCounter)
+			if(inAdd)
 			{
-				_xfdashboard_applications_search_provider_statistics.maxUsedCounter=stats->usedCounter;
+				if(!entries)
+				{
+					entries=g_ptr_array_new();
+					g_hash_table_insert(inIndex->ngrams, ngram, entries);
+				}
+
+				/* All n-grams of an index entry are added in one go, so if this
+				 * n-gram was seen before for this index entry it is the last
+				 * one in list.
+				 */
+				if(entries->len==0 ||
+					g_ptr_array_index(entries, entries->len-1)!=inEntry)
+				{
+					g_ptr_array_add(entries, inEntry);
+				}
 			}
+				else if(entries)
+				{
+					g_ptr_array_remove_fast(entries, inEntry);
+					if(entries->len==0) g_hash_table_remove(inIndex->ngrams, ngram);
+				}
 		}
 
-		/* Store statistics data for application in hash-table */
-		g_hash_table_insert(_xfdashboard_applications_search_provider_statistics.stats, g_strdup(appID), _xfdashboard_applications_search_provider_statistics_ref(stats));
-		XFDASHBOARD_DEBUG(self, APPLICATIONS,
-							"Loaded and stored statistics for '%s' for applications search provider",
-							appID);
-
-		/* Release allocated resources */
-		_xfdashboard_applications_search_provider_statistics_unref(stats);
+		/* Continue with n-grams at next position */
+		inText++;
 	}
+}
 
-	/* Release allocated resources */
-	if(allAppIDs) g_list_free_full(allAppIDs, g_free);
-	if(keyFile) g_key_file_free(keyFile);
+static void _xfdashboard_applications_search_provider_index_entry(XfdashboardApplicationsSearchProviderIndex *inIndex,
+																	XfdashboardApplicationsSearchProviderIndexEntry *inEntry,
+																	gboolean inAdd)
+{
+	gchar												**keywordsIter;
 
-	/* If we get here saving statistics file was successful */
-	XFDASHBOARD_DEBUG(self, APPLICATIONS,
-						"Loaded statistics of applications search provider from %s",
-						_xfdashboard_applications_search_provider_statistics.filename);
+	g_return_if_fail(inIndex);
+	g_return_if_fail(inEntry);
 
-	return(TRUE);
+	_xfdashboard_applications_search_provider_index_text(inIndex, inEntry, inEntry->title, inAdd);
+	_xfdashboard_applications_search_provider_index_text(inIndex, inEntry, inEntry->description, inAdd);
+	_xfdashboard_applications_search_provider_index_text(inIndex, inEntry, inEntry->command, inAdd);
+
+	if(inEntry->keywords)
+	{
+		for(keywordsIter=inEntry->keywords; *keywordsIter; keywordsIter++)
+		{
+			_xfdashboard_applications_search_provider_index_text(inIndex, inEntry, *keywordsIter, inAdd);
+		}
+	}
 }
 
-/* Destroy statistics for this search provider */
-static void _xfdashboard_applications_search_provider_destroy_statistics(void)
-{
-	XfdashboardApplication			*application;
-	GError							*error;
+/* Forward declarations */
+static void _xfdashboard_applications_search_provider_on_app_info_changed(XfdashboardApplicationsSearchProvider *self,
+																			gpointer inUserData);
 
-	error=NULL;
+/* Add application to resp. remove application from index */
+static void _xfdashboard_applications_search_provider_index_add(XfdashboardApplicationsSearchProvider *self,
+																GAppInfo *inAppInfo)
+{
+	XfdashboardApplicationsSearchProviderPrivate		*priv;
+	XfdashboardApplicationsSearchProviderIndex			*index;
+	XfdashboardApplicationsSearchProviderIndexEntry		*entry;
+	guint												signalID;
 
-	/* Only existing statistics can be destroyed */
-	if(!_xfdashboard_applications_search_provider_statistics.stats) return;
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self));
+	g_return_if_fail(G_IS_APP_INFO(inAppInfo));
 
-	/* Lock for thread-safety */
-	G_LOCK(_xfdashboard_applications_search_provider_statistics_lock);
+	priv=self->priv;
 
-	/* Get application instance */
-	application=xfdashboard_application_get_default();
+	G_LOCK(_xfdashboard_applications_search_provider_index_lock);
 
-	/* Disconnect application "shutdown" signal handler */
-	if(_xfdashboard_applications_search_provider_statistics.shutdownSignalID)
+	/* Do not index application twice */
+	if(g_hash_table_contains(priv->index->entries, inAppInfo))
 	{
-		g_signal_handler_disconnect(application, _xfdashboard_applications_search_provider_statistics.shutdownSignalID);
-		_xfdashboard_applications_search_provider_statistics.shutdownSignalID=0;
+		G_UNLOCK(_xfdashboard_applications_search_provider_index_lock);
+		return;
 	}
 
-	/* Disconnect application "application-launched" signal handler */
-	if(_xfdashboard_applications_search_provider_statistics.applicationLaunchedSignalID)
-	{
-		g_signal_handler_disconnect(application, _xfdashboard_applications_search_provider_statistics.applicationLaunchedSignalID);
-		_xfdashboard_applications_search_provider_statistics.applicationLaunchedSignalID=0;
-	}
+	index=_xfdashboard_applications_search_provider_index_get_writable(self);
 
-	/* Save statistics to file */
-	if(!_xfdashboard_applications_search_provider_save_statistics(&error))
-	{
-		g_critical(_("Failed to save statistics of applications search provider to %s: %s"),
-					_xfdashboard_applications_search_provider_statistics.filename,
-					error ? error->message : _("Unknown error"));
-		if(error) g_clear_error(&error);
-	}
+	entry=_xfdashboard_applications_search_provider_index_entry_new(inAppInfo);
+	g_hash_table_insert(index->entries, entry->appInfo, entry);
+	if(entry->desktopID) g_hash_table_insert(index->desktopIDs, entry->desktopID, entry);
+	_xfdashboard_applications_search_provider_index_entry(index, entry, TRUE);
+	index->serial++;
 
-	/* Destroy statistics */
-	XFDASHBOARD_DEBUG(NULL, APPLICATIONS, "Destroying statistics of applications search provider");
-	g_hash_table_destroy(_xfdashboard_applications_search_provider_statistics.stats);
-	_xfdashboard_applications_search_provider_statistics.stats=NULL;
+	G_UNLOCK(_xfdashboard_applications_search_provider_index_lock);
 
-	/* Destroy filename for statistics */
-	if(_xfdashboard_applications_search_provider_statistics.filename)
+	/* Re-index application if its desktop file was reloaded */
+	if(XFDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo) &&
+		!g_hash_table_contains(priv->appInfoChangedIDs, inAppInfo))
 	{
-		g_free(_xfdashboard_applications_search_provider_statistics.filename);
-		_xfdashboard_applications_search_provider_statistics.filename=NULL;
+		signalID=g_signal_connect_swapped(inAppInfo,
+											"changed",
+											G_CALLBACK(_xfdashboard_applications_search_provider_on_app_info_changed),
+											self);
+		g_hash_table_insert(priv->appInfoChangedIDs, g_object_ref(inAppInfo), GUINT_TO_POINTER(signalID));
 	}
-
-	/* Reset other variables */
-	_xfdashboard_applications_search_provider_statistics.maxUsedCounter=0;
-
-	/* Unlock for thread-safety */
-	G_UNLOCK(_xfdashboard_applications_search_provider_statistics_lock);
 }
 
-/* Create and load statistics for this search provider if not done already */
-static void _xfdashboard_applications_search_provider_create_statistics(XfdashboardApplicationsSearchProvider *self)
+static void _xfdashboard_applications_search_provider_index_remove(XfdashboardApplicationsSearchProvider *self,
+																	GAppInfo *inAppInfo)
 {
-	XfdashboardApplication			*application;
-	GError							*error;
+	XfdashboardApplicationsSearchProviderPrivate		*priv;
+	XfdashboardApplicationsSearchProviderIndex			*index;
+	XfdashboardApplicationsSearchProviderIndexEntry		*entry;
+	gpointer											signalID;
 
 	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self));
+	g_return_if_fail(G_IS_APP_INFO(inAppInfo));
 
-	error=NULL;
+	priv=self->priv;
 
-	/* Statistics were already set up */
-	if(_xfdashboard_applications_search_provider_statistics.stats) return;
+	/* Stop watching application for changes */
+	if(g_hash_table_lookup_extended(priv->appInfoChangedIDs, inAppInfo, NULL, &signalID))
+	{
+		g_signal_handler_disconnect(inAppInfo, GPOINTER_TO_UINT(signalID));
+		g_hash_table_remove(priv->appInfoChangedIDs, inAppInfo);
+	}
 
-	g_assert(!_xfdashboard_applications_search_provider_statistics.shutdownSignalID);
-	g_assert(!_xfdashboard_applications_search_provider_statistics.applicationLaunchedSignalID);
+	G_LOCK(_xfdashboard_applications_search_provider_index_lock);
 
-	/* Lock for thread-safety */
-	G_LOCK(_xfdashboard_applications_search_provider_statistics_lock);
+	if(!g_hash_table_contains(priv->index->entries, inAppInfo))
+	{
+		G_UNLOCK(_xfdashboard_applications_search_provider_index_lock);
+		return;
+	}
 
-	/* Initialize non-critical variables */
-	_xfdashboard_applications_search_provider_statistics.maxUsedCounter=0;
+	index=_xfdashboard_applications_search_provider_index_get_writable(self);
 
-	/* Create hash-table for statistics */
-	_xfdashboard_applications_search_provider_statistics.stats=
-		g_hash_table_new_full(g_str_hash,
-								g_str_equal,
-								g_free,
-								(GDestroyNotify)_xfdashboard_applications_search_provider_statistics_unref);
-	XFDASHBOARD_DEBUG(self, APPLICATIONS, "Created statistics of applications search provider");
+	entry=(XfdashboardApplicationsSearchProviderIndexEntry*)g_hash_table_lookup(index->entries, inAppInfo);
+	_xfdashboard_applications_search_provider_index_entry(index, entry, FALSE);
+	if(entry->desktopID &&
+		g_hash_table_lookup(index->desktopIDs, entry->desktopID)==entry)
+	{
+		g_hash_table_remove(index->desktopIDs, entry->desktopID);
+	}
+	g_hash_table_remove(index->entries, inAppInfo);
+	index->serial++;
 
-	/* Load statistics from file */
-	if(!_xfdashboard_applications_search_provider_load_statistics(self, &error))
+	G_UNLOCK(_xfdashboard_applications_search_provider_index_lock);
+}
+
+/* Find the smallest list of applications which could match all search terms.
+ * As an application must match each search term, it is enough to look at
+ * the applications of the rarest n-gram of any search term. Search terms
+ * shorter than a trigram are looked up as a whole. Returns FALSE if no
+ * application can match at all. If all search terms are empty, the list is
+ * set to NULL and all applications must be checked.
+ */
+static gboolean _xfdashboard_applications_search_provider_index_lookup(XfdashboardApplicationsSearchProviderIndex *inIndex,
+																		gchar **inSearchTerms,
+																		GPtrArray **outCandidates)
+{
+	GPtrArray											*candidates;
+	GPtrArray											*entries;
+	const gchar											*term;
+	guint												length;
+
+	g_return_val_if_fail(inIndex, FALSE);
+	g_return_val_if_fail(inSearchTerms, FALSE);
+	g_return_val_if_fail(outCandidates, FALSE);
+
+	candidates=NULL;
+
+	while(*inSearchTerms)
 	{
-		g_critical(_("Failed to load statistics of applications search provider from %s: %s"),
-					_xfdashboard_applications_search_provider_statistics.filename,
-					error ? error->message : _("Unknown error"));
-		if(error) g_clear_error(&error);
+		length=MIN(strlen(*inSearchTerms), XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_NGRAM_MAX_LENGTH);
 
-		/* Destroy hash-table to avoid the half-loaded hash-table being stored again
-		 * and overriding existing statistics file (even if it may be broken).
-		 * Also release 
-		 */
-		if(_xfdashboard_applications_search_provider_statistics.stats)
+		for(term=*inSearchTerms; length>0 && strlen(term)>=length; term++)
 		{
-			g_hash_table_destroy(_xfdashboard_applications_search_provider_statistics.stats);
-			_xfdashboard_applications_search_provider_statistics.stats=NULL;
-		}
+			entries=(GPtrArray*)g_hash_table_lookup(inIndex->ngrams, _xfdashboard_applications_search_provider_get_ngram(term, length));
+			if(!entries) return(FALSE);
 
-		if(_xfdashboard_applications_search_provider_statistics.filename)
-		{
-			g_free(_xfdashboard_applications_search_provider_statistics.filename);
-			_xfdashboard_applications_search_provider_statistics.filename=NULL;
+			if(!candidates || entries->len<candidates->len) candidates=entries;
 		}
 
-		/* Unlock for thread-safety */
-		G_UNLOCK(_xfdashboard_applications_search_provider_statistics_lock);
-
-		/* Return here to prevent further initializations of statistics
-		 * which are not used and not deinitialized in 'destroy' function.
-		 */
-		return;
+		/* Continue with next search term */
+		inSearchTerms++;
 	}
 
-	/* Get application instance */
-	application=xfdashboard_application_get_default();
+	*outCandidates=candidates;
+	return(TRUE);
+}
 
-	/* Connect to "shutdown" signal of application to clean up statistics */
-	_xfdashboard_applications_search_provider_statistics.shutdownSignalID=
-		g_signal_connect(application,
-							"shutdown-final",
-							G_CALLBACK(_xfdashboard_applications_search_provider_destroy_statistics),
-							NULL);
+/* An indexed application has changed, so re-index it */
+static void _xfdashboard_applications_search_provider_on_app_info_changed(XfdashboardApplicationsSearchProvider *self,
+																			gpointer inUserData)
+{
+	GAppInfo										*appInfo;
 
-	/* Connect to "application-launched" signal of application to track app launches */
-	_xfdashboard_applications_search_provider_statistics.applicationLaunchedSignalID=
-		g_signal_connect(application,
-							"application-launched",
-							G_CALLBACK(_xfdashboard_applications_search_provider_on_application_launched),
-							NULL);
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self));
+	g_return_if_fail(G_IS_APP_INFO(inUserData));
 
-	/* Unlock for thread-safety */
-	G_UNLOCK(_xfdashboard_applications_search_provider_statistics_lock);
+	/* Take an extra reference as removing it from index releases its reference */
+	appInfo=G_APP_INFO(g_object_ref(inUserData));
+	_xfdashboard_applications_search_provider_index_remove(self, appInfo);
+	_xfdashboard_applications_search_provider_index_add(self, appInfo);
+	g_object_unref(appInfo);
 }
 
 /* An application was added to database */
@@ -680,21 +1814,11 @@ static void _xfdashboard_applications_search_provider_on_application_added(Xfdas
 																			GAppInfo *inAppInfo,
 																			gpointer inUserData)
 {
-	XfdashboardApplicationsSearchProviderPrivate	*priv;
-
 	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self));
+	g_return_if_fail(G_IS_APP_INFO(inAppInfo));
 
-	priv=self->priv;
-
-	/* Release current list of all installed applications */
-	if(priv->allApps)
-	{
-		g_list_free_full(priv->allApps, g_object_unref);
-		priv->allApps=NULL;
-	}
-
-	/* Get new list of all installed applications */
-	priv->allApps=xfdashboard_application_database_get_all_applications(priv->appDB);
+	/* Add application to index */
+	_xfdashboard_applications_search_provider_index_add(self, inAppInfo);
 }
 
 /* An application was removed to database */
@@ -702,21 +1826,11 @@ static void _xfdashboard_applications_search_provider_on_application_removed(Xfd
 																				GAppInfo *inAppInfo,
 																				gpointer inUserData)
 {
-	XfdashboardApplicationsSearchProviderPrivate	*priv;
-
 	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self));
+	g_return_if_fail(G_IS_APP_INFO(inAppInfo));
 
-	priv=self->priv;
-
-	/* Release current list of all installed applications */
-	if(priv->allApps)
-	{
-		g_list_free_full(priv->allApps, g_object_unref);
-		priv->allApps=NULL;
-	}
-
-	/* Get new list of all installed applications */
-	priv->allApps=xfdashboard_application_database_get_all_applications(priv->appDB);
+	/* Remove application from index */
+	_xfdashboard_applications_search_provider_index_remove(self, inAppInfo);
 }
 
 /* User selected to open a new window or to launch that application at pop-up menu */
@@ -924,30 +2038,27 @@ static void _xfdashboard_applications_search_provider_on_drag_end(ClutterDragAct
 	}
 }
 
-/* Check if given app info matches search terms and return score as fraction
- * between 0.0and 1.0 - so called "relevance". A negative score means that
- * the given app info does not match at all.
+/* Check if given index entry of an app info matches search terms and return
+ * score as fraction between 0.0and 1.0 - so called "relevance". A negative
+ * score means that the given app info does not match at all.
  */
 static gfloat _xfdashboard_applications_search_provider_score(XfdashboardApplicationsSearchProvider *self,
+																XfdashboardApplicationsSearchProviderSortMode inSortMode,
 																gchar **inSearchTerms,
-																GAppInfo *inAppInfo)
+																XfdashboardApplicationsSearchProviderIndexEntry *inEntry)
 {
-	XfdashboardApplicationsSearchProviderPrivate		*priv;
-	gchar												*title;
-	gchar												*description;
-	GList												*keywords;
+	const gchar											*title;
+	const gchar											*description;
+	gchar												**keywords;
 	const gchar											*command;
-	const gchar											*value;
 	gint												matchesFound, matchesExpected;
 	gfloat												pointsSearch;
 	gfloat												score;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self), -1.0f);
-	g_return_val_if_fail(G_IS_APP_INFO(inAppInfo), -1.0f);
+	g_return_val_if_fail(inEntry, -1.0f);
 
-	priv=self->priv;
 	score=-1.0f;
-	keywords=NULL;
 
 	/* Empty search term matches no menu item */
 	if(!inSearchTerms) return(0.0f);
@@ -970,35 +2081,21 @@ static gfloat _xfdashboard_applications_search_provider_score(XfdashboardApplica
 	 * the total weight "points" by the number of search terms to get the average
 	 * which is also the result score when *not* taking the launch count of
 	 * application into account.
+	 *
+	 * The texts to match were already normalized and converted to lower-case
+	 * when the application was indexed. The command is the base name of the
+	 * executable which must start with the search term to match.
 	 */
-	value=g_app_info_get_display_name(inAppInfo);
-	if(value) title=g_utf8_strdown(value, -1);
-		else title=NULL;
-
-	value=g_app_info_get_description(inAppInfo);
-	if(value) description=g_utf8_strdown(value, -1);
-		else description=NULL;
-
-	command=g_app_info_get_executable(inAppInfo);
-
-	if(XFDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo))
-	{
-		GList											*appKeywords;
-		GList											*iter;
-
-		appKeywords=xfdashboard_desktop_app_info_get_keywords(XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo));
-		for(iter=appKeywords; iter; iter=g_list_next(iter))
-		{
-			keywords=g_list_prepend(keywords, g_utf8_strdown(iter->data, -1));
-		}
-	}
+	title=inEntry->title;
+	description=inEntry->description;
+	keywords=inEntry->keywords;
+	command=inEntry->command;
 
 	matchesFound=0;
 	pointsSearch=0.0f;
 	while(*inSearchTerms)
 	{
 		gboolean										termMatch;
-		gchar											*commandPos;
 		gfloat											pointsTerm;
 
 		/* Reset "found" indicator and score of current search term */
@@ -1015,12 +2112,11 @@ static gfloat _xfdashboard_applications_search_provider_score(XfdashboardApplica
 
 		if(keywords)
 		{
-			GList						*iter;
+			gchar						**iter;
 
-			for(iter=keywords; iter; iter=g_list_next(iter))
+			for(iter=keywords; *iter; iter++)
 			{
-				if(iter->data &&
-					g_strstr_len(iter->data, -1, *inSearchTerms))
+				if(g_strstr_len(*iter, -1, *inSearchTerms))
 				{
 					pointsTerm+=0.25;
 					termMatch=TRUE;
@@ -1029,15 +2125,11 @@ static gfloat _xfdashboard_applications_search_provider_score(XfdashboardApplica
 			}
 		}
 
-		if(command)
+		if(command &&
+			g_str_has_prefix(command, *inSearchTerms))
 		{
-			commandPos=g_strstr_len(command, -1, *inSearchTerms);
-			if(commandPos &&
-				(commandPos==command || *(commandPos-1)==G_DIR_SEPARATOR))
-			{
-				pointsTerm+=0.25;
-				termMatch=TRUE;
-			}
+			pointsTerm+=0.25;
+			termMatch=TRUE;
 		}
 
 		if(description &&
@@ -1074,7 +2166,7 @@ static gfloat _xfdashboard_applications_search_provider_score(XfdashboardApplica
 		/* Set maximum points to the number of expected number of matches
 		 * if we should take title, description and command into calculation.
 		 */
-		if(priv->currentSortMode & XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_NAMES)
+		if(inSortMode & XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_NAMES)
 		{
 			currentPoints+=pointsSearch;
 			maxPoints+=matchesExpected*1.0f;
@@ -1084,12 +2176,18 @@ static gfloat _xfdashboard_applications_search_provider_score(XfdashboardApplica
 		 * of any application to the highest points possible and also add the number
 		 * of launches of this application to the total points we got so far.
 		 */
-		if(priv->currentSortMode & XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_MOST_USED)
+		if(inSortMode & XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_MOST_USED)
 		{
+			/* Lock for thread-safety as search may be performed in another thread */
+			G_LOCK(_xfdashboard_applications_search_provider_statistics_lock);
+
 			maxPoints+=(_xfdashboard_applications_search_provider_statistics.maxUsedCounter*1.0f);
 
-			stats=_xfdashboard_applications_search_provider_statistics_get(g_app_info_get_id(inAppInfo));
+			stats=_xfdashboard_applications_search_provider_statistics_get(inEntry->desktopID);
 			if(stats) currentPoints+=(stats->usedCounter*1.0f);
+
+			/* Unlock for thread-safety */
+			G_UNLOCK(_xfdashboard_applications_search_provider_statistics_lock);
 		}
 
 		/* Calculate score but if maximum points is still zero we should do a simple
@@ -1099,69 +2197,65 @@ static gfloat _xfdashboard_applications_search_provider_score(XfdashboardApplica
 			else score=1.0f;
 	}
 
-	/* Release allocated resources */
-	if(keywords) g_list_free_full(keywords, g_free);
-	if(description) g_free(description);
-	if(title) g_free(title);
-
 	/* Return score of this application for requested search terms */
 	return(score);
 }
 
-/* Callback to sort each item in result set */
+/* Callback to sort each item in result set. The texts to compare are looked up
+ * in the index snapshot the result set was created from, so it can be called
+ * in any thread.
+ */
 static gint _xfdashboard_applications_search_provider_sort_result_set(GVariant *inLeft,
 																		GVariant *inRight,
 																		gpointer inUserData)
 {
-	XfdashboardApplicationsSearchProvider				*self;
-	XfdashboardApplicationsSearchProviderPrivate		*priv;
-	const gchar											*leftID;
-	const gchar											*rightID;
-	GAppInfo											*leftAppInfo;
-	GAppInfo											*rightAppInfo;
-	const gchar											*leftName;
-	const gchar											*rightName;
-	gchar												*lowerLeftName;
-	gchar												*lowerRightName;
-	gint												result;
+	XfdashboardApplicationsSearchProviderIndex			*index;
+	XfdashboardApplicationsSearchProviderIndexEntry		*leftEntry;
+	XfdashboardApplicationsSearchProviderIndexEntry		*rightEntry;
 
 	g_return_val_if_fail(inLeft, 0);
 	g_return_val_if_fail(inRight, 0);
-	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(inUserData), 0);
-
-	self=XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER(inUserData);
-	priv=self->priv;
+	g_return_val_if_fail(inUserData, 0);
 
-	/* Get desktop IDs of both items */
-	leftID=g_variant_get_string(inLeft, NULL);
-	rightID=g_variant_get_string(inRight, NULL);
+	index=(XfdashboardApplicationsSearchProviderIndex*)inUserData;
 
-	/* Get desktop application information of both items */
-	leftAppInfo=xfdashboard_application_database_lookup_desktop_id(priv->appDB, leftID);
-	if(leftAppInfo) leftName=g_app_info_get_display_name(G_APP_INFO(leftAppInfo));
-		else leftName=NULL;
+	/* Get index entries of both items */
+	leftEntry=(XfdashboardApplicationsSearchProviderIndexEntry*)g_hash_table_lookup(index->desktopIDs, g_variant_get_string(inLeft, NULL));
+	rightEntry=(XfdashboardApplicationsSearchProviderIndexEntry*)g_hash_table_lookup(index->desktopIDs, g_variant_get_string(inRight, NULL));
 
-	rightAppInfo=xfdashboard_application_database_lookup_desktop_id(priv->appDB, rightID);
-	if(rightAppInfo) rightName=g_app_info_get_display_name(G_APP_INFO(rightAppInfo));
-		else rightName=NULL;
+	/* Return result of comparing the display names of both applications
+	 * which were converted to lower-case when indexed.
+	 */
+	return(g_strcmp0(leftEntry ? leftEntry->title : NULL, rightEntry ? rightEntry->title : NULL));
+}
 
-	/* Get result of comparing both desktop application information objects */
-	if(leftName) lowerLeftName=g_utf8_strdown(leftName, -1);
-		else lowerLeftName=NULL;
+/* Check indexed application for a match against search terms and add it to
+ * result set if it matches.
+ */
+static void _xfdashboard_applications_search_provider_add_result(XfdashboardApplicationsSearchProvider *self,
+																	XfdashboardApplicationsSearchProviderSortMode inSortMode,
+																	XfdashboardSearchResultSet *ioResultSet,
+																	gchar **inSearchTerms,
+																	XfdashboardApplicationsSearchProviderIndexEntry *inEntry)
+{
+	GVariant											*resultItem;
+	gfloat												score;
 
-	if(rightName) lowerRightName=g_utf8_strdown(rightName, -1);
-		else lowerRightName=NULL;
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(self));
+	g_return_if_fail(XFDASHBOARD_IS_SEARCH_RESULT_SET(ioResultSet));
+	g_return_if_fail(inEntry);
 
-	result=g_strcmp0(lowerLeftName, lowerRightName);
+	/* If desktop app info should be hidden then do not add it */
+	if(!inEntry->shouldShow || !inEntry->desktopID) return;
 
-	/* Release allocated resources */
-	if(rightAppInfo) g_object_unref(rightAppInfo);
-	if(leftAppInfo) g_object_unref(leftAppInfo);
-	if(lowerLeftName) g_free(lowerLeftName);
-	if(lowerRightName) g_free(lowerRightName);
+	/* Check for a match against search terms */
+	score=_xfdashboard_applications_search_provider_score(self, inSortMode, inSearchTerms, inEntry);
+	if(score<0.0f) return;
 
-	/* Return result */
-	return(result);
+	/* Create result item and add it to result set */
+	resultItem=g_variant_new_string(inEntry->desktopID);
+	xfdashboard_search_result_set_add_item(ioResultSet, resultItem);
+	xfdashboard_search_result_set_set_item_score(ioResultSet, resultItem, score);
 }
 
 /* IMPLEMENTATION: XfdashboardSearchProvider */
@@ -1193,22 +2287,29 @@ static XfdashboardSearchResultSet* _xfdashboard_applications_search_provider_get
 	XfdashboardApplicationsSearchProvider				*self;
 	XfdashboardApplicationsSearchProviderPrivate		*priv;
 	XfdashboardSearchResultSet							*resultSet;
-	GList												*iter;
 	guint												numberTerms;
 	gchar												**terms, **termsIter;
-	XfdashboardDesktopAppInfo							*appInfo;
-	gfloat												score;
+	GPtrArray											*candidates;
+	XfdashboardApplicationsSearchProviderIndex			*index;
+	XfdashboardApplicationsSearchProviderIndexEntry		*entry;
+	XfdashboardApplicationsSearchProviderSortMode		sortMode;
+	GHashTableIter										iter;
+	guint												i;
+	gboolean											isIncremental;
+	GList												*previousItems;
+	GList												*previousIter;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(inProvider), NULL);
 
 	self=XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER(inProvider);
 	priv=self->priv;
 
-	/* Set new match mode */
-	priv->currentSortMode=priv->nextSortMode;
+	/* Get match mode to use for this search */
+	sortMode=priv->nextSortMode;
 
-	/* To perform case-insensitive searches through model convert all search terms
-	 * to lower-case before starting search.
+	/* To perform case-insensitive searches through model normalize all search
+	 * terms and convert them to lower-case like the indexed texts before
+	 * starting search.
 	 * Remember that string list must be NULL terminated.
 	 */
 	numberTerms=g_strv_length((gchar**)inSearchTerms);
@@ -1228,7 +2329,7 @@ static XfdashboardSearchResultSet* _xfdashboard_applications_search_provider_get
 	termsIter=terms;
 	while(*inSearchTerms)
 	{
-		*termsIter=g_utf8_strdown(*inSearchTerms, -1);
+		*termsIter=_xfdashboard_applications_search_provider_normalize_text(*inSearchTerms);
 
 		/* Move to next entry where to store lower-case and
 		 * initialize with NULL for NULL termination of list.
@@ -1240,41 +2341,76 @@ static XfdashboardSearchResultSet* _xfdashboard_applications_search_provider_get
 		inSearchTerms++;
 	}
 
-	/* Create empty result set to store matching result items */
-	resultSet=xfdashboard_search_result_set_new();
+	/* Get snapshot of index to search in. This search may be performed in
+	 * another thread than the main thread which may modify the index while
+	 * searching but it will never modify this snapshot.
+	 */
+	index=_xfdashboard_applications_search_provider_index_get_snapshot(self);
 
-	/* Perform search */
-	for(iter=priv->allApps; iter; iter=g_list_next(iter))
+	/* Create empty result set to store matching result items and remember
+	 * state of index it was created from.
+	 */
+	resultSet=xfdashboard_search_result_set_new();
+	g_object_set_qdata(G_OBJECT(resultSet),
+						XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_INDEX_SERIAL,
+						GUINT_TO_POINTER(index->serial));
+
+	/* If a previous result set is given the search terms refine the ones of
+	 * previous search, so only the applications in previous result set can
+	 * match. But this is only true if no application was added, removed or
+	 * changed since the previous result set was created.
+	 */
+	candidates=NULL;
+	isIncremental=(inPreviousResultSet &&
+					GPOINTER_TO_UINT(g_object_get_qdata(G_OBJECT(inPreviousResultSet), XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_INDEX_SERIAL))==index->serial);
+	if(isIncremental)
 	{
-		/* Get app info to check for match */
-		appInfo=XFDASHBOARD_DESKTOP_APP_INFO(iter->data);
+		XFDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Rescoring %u applications of previous result set",
+							xfdashboard_search_result_set_get_size(inPreviousResultSet));
 
-		/* If desktop app info should be hidden then continue with next one */
-		if(!g_app_info_should_show(G_APP_INFO(appInfo)))
+		previousItems=xfdashboard_search_result_set_get_all(inPreviousResultSet);
+		for(previousIter=previousItems; previousIter; previousIter=g_list_next(previousIter))
 		{
-			continue;
+			entry=(XfdashboardApplicationsSearchProviderIndexEntry*)g_hash_table_lookup(index->desktopIDs, g_variant_get_string((GVariant*)previousIter->data, NULL));
+			if(entry) _xfdashboard_applications_search_provider_add_result(self, sortMode, resultSet, terms, entry);
 		}
+		g_list_free_full(previousItems, (GDestroyNotify)g_variant_unref);
+	}
 
-		/* Check for a match against search terms */
-		score=_xfdashboard_applications_search_provider_score(self, terms, G_APP_INFO(appInfo));
-		if(score>=0.0f)
+	/* Otherwise perform search but only check the applications which could
+	 * match by looking up the index. If all search terms are empty check
+	 * all applications.
+	 */
+	if(!isIncremental &&
+		_xfdashboard_applications_search_provider_index_lookup(index, terms, &candidates))
+	{
+		if(candidates)
 		{
-			GVariant									*resultItem;
-
-			/* Create result item */
-			resultItem=g_variant_new_string(g_app_info_get_id(G_APP_INFO(appInfo)));
-
-			/* Add result item to result set */
-			xfdashboard_search_result_set_add_item(resultSet, resultItem);
-			xfdashboard_search_result_set_set_item_score(resultSet, resultItem, score);
+			for(i=0; i<candidates->len; i++)
+			{
+				entry=(XfdashboardApplicationsSearchProviderIndexEntry*)g_ptr_array_index(candidates, i);
+				_xfdashboard_applications_search_provider_add_result(self, sortMode, resultSet, terms, entry);
+			}
 		}
+			else
+			{
+				g_hash_table_iter_init(&iter, index->entries);
+				while(g_hash_table_iter_next(&iter, NULL, (gpointer*)&entry))
+				{
+					_xfdashboard_applications_search_provider_add_result(self, sortMode, resultSet, terms, entry);
+				}
+			}
 	}
 
-	/* Sort result set */
+	/* Sort result set by the texts in index snapshot it was created from */
 	xfdashboard_search_result_set_set_sort_func_full(resultSet,
 														_xfdashboard_applications_search_provider_sort_result_set,
-														g_object_ref(self),
-														g_object_unref);
+														_xfdashboard_applications_search_provider_index_ref(index),
+														(GDestroyNotify)_xfdashboard_applications_search_provider_index_unref);
+
+	/* Release allocated resources */
+	_xfdashboard_applications_search_provider_index_unref(index);
 
 	/* Release allocated resources */
 	if(terms)
@@ -1292,6 +2428,14 @@ static XfdashboardSearchResultSet* _xfdashboard_applications_search_provider_get
 	return(resultSet);
 }
 
+/* The search of this provider only works on snapshots of the index and can
+ * be performed in any thread.
+ */
+static gboolean _xfdashboard_applications_search_provider_is_thread_safe(XfdashboardSearchProvider *inProvider)
+{
+	return(TRUE);
+}
+
 /* Create actor for a result item of the result set returned from a search request */
 static ClutterActor* _xfdashboard_applications_search_provider_create_result_actor(XfdashboardSearchProvider *inProvider,
 																					GVariant *inResultItem)
@@ -1302,6 +2446,7 @@ static ClutterActor* _xfdashboard_applications_search_provider_create_result_act
 	ClutterAction									*clickAction;
 	ClutterAction									*dragAction;
 	GAppInfo										*appInfo;
+	XfdashboardActorPool							*actorPool;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_SEARCH_PROVIDER(inProvider), NULL);
 	g_return_val_if_fail(inResultItem, NULL);
@@ -1320,19 +2465,35 @@ static ClutterActor* _xfdashboard_applications_search_provider_create_result_act
 		return(NULL);
 	}
 
-	/* Create actor for result item */
-	actor=xfdashboard_application_button_new_from_app_info(appInfo);
-	clutter_actor_show(actor);
-
-	clickAction=xfdashboard_click_action_new();
-	g_signal_connect_swapped(clickAction, "clicked", G_CALLBACK(_xfdashboard_applications_search_provider_on_popup_menu), self);
-	clutter_actor_add_action(actor, clickAction);
-
-	dragAction=xfdashboard_drag_action_new();
-	clutter_drag_action_set_drag_threshold(CLUTTER_DRAG_ACTION(dragAction), -1, -1);
-	clutter_actor_add_action(actor, dragAction);
-	g_signal_connect(dragAction, "drag-begin", G_CALLBACK(_xfdashboard_applications_search_provider_on_drag_begin), self);
-	g_signal_connect(dragAction, "drag-end", G_CALLBACK(_xfdashboard_applications_search_provider_on_drag_end), self);
+	/* Reuse a recycled actor for result item by rebinding it to app info.
+	 * Its actions were set up by this provider already when it was created.
+	 */
+	actorPool=xfdashboard_search_provider_get_actor_pool(inProvider);
+	actor=xfdashboard_actor_pool_acquire(actorPool, XFDASHBOARD_TYPE_APPLICATION_BUTTON, NULL);
+	if(actor)
+	{
+		xfdashboard_application_button_set_app_info(XFDASHBOARD_APPLICATION_BUTTON(actor), appInfo);
+		clutter_actor_show(actor);
+	}
+		else
+		{
+			/* Create actor for result item */
+			actor=xfdashboard_application_button_new_from_app_info(appInfo);
+			clutter_actor_show(actor);
+
+			clickAction=xfdashboard_click_action_new();
+			g_signal_connect_swapped(clickAction, "clicked", G_CALLBACK(_xfdashboard_applications_search_provider_on_popup_menu), self);
+			clutter_actor_add_action(actor, clickAction);
+
+			dragAction=xfdashboard_drag_action_new();
+			clutter_drag_action_set_drag_threshold(CLUTTER_DRAG_ACTION(dragAction), -1, -1);
+			clutter_actor_add_action(actor, dragAction);
+			g_signal_connect(dragAction, "drag-begin", G_CALLBACK(_xfdashboard_applications_search_provider_on_drag_begin), self);
+			g_signal_connect(dragAction, "drag-end", G_CALLBACK(_xfdashboard_applications_search_provider_on_drag_end), self);
+
+			/* Allow actor to be recycled */
+			xfdashboard_actor_pool_register(actorPool, actor, NULL);
+		}
 
 	/* Release allocated resources */
 	g_object_unref(appInfo);
@@ -1385,10 +2546,28 @@ static void _xfdashboard_applications_search_provider_dispose(GObject *inObject)
 		priv->appDB=NULL;
 	}
 
-	if(priv->allApps)
+	if(priv->appInfoChangedIDs)
+	{
+		GHashTableIter								iter;
+		GAppInfo									*appInfo;
+		gpointer									signalID;
+
+		g_hash_table_iter_init(&iter, priv->appInfoChangedIDs);
+		while(g_hash_table_iter_next(&iter, (gpointer*)&appInfo, &signalID))
+		{
+			g_signal_handler_disconnect(appInfo, GPOINTER_TO_UINT(signalID));
+		}
+
+		g_hash_table_destroy(priv->appInfoChangedIDs);
+		priv->appInfoChangedIDs=NULL;
+	}
+
+	if(priv->index)
 	{
-		g_list_free_full(priv->allApps, g_object_unref);
-		priv->allApps=NULL;
+		G_LOCK(_xfdashboard_applications_search_provider_index_lock);
+		_xfdashboard_applications_search_provider_index_unref(priv->index);
+		priv->index=NULL;
+		G_UNLOCK(_xfdashboard_applications_search_provider_index_lock);
 	}
 
 	if(priv->xfconfSortModeBindingID)
@@ -1464,6 +2643,7 @@ static void xfdashboard_applications_search_provider_class_init(XfdashboardAppli
 	providerClass->get_name=_xfdashboard_applications_search_provider_get_name;
 	providerClass->get_icon=_xfdashboard_applications_search_provider_get_icon;
 	providerClass->get_result_set=_xfdashboard_applications_search_provider_get_result_set;
+	providerClass->is_thread_safe=_xfdashboard_applications_search_provider_is_thread_safe;
 	providerClass->create_result_actor=_xfdashboard_applications_search_provider_create_result_actor;
 	providerClass->activate_result=_xfdashboard_applications_search_provider_activate_result;
 
@@ -1488,12 +2668,13 @@ static void xfdashboard_applications_search_provider_class_init(XfdashboardAppli
 static void xfdashboard_applications_search_provider_init(XfdashboardApplicationsSearchProvider *self)
 {
 	XfdashboardApplicationsSearchProviderPrivate	*priv;
+	GList											*allApps;
+	GList											*iter;
 
 	self->priv=priv=XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_GET_PRIVATE(self);
 
 	/* Set up default values */
 	priv->xfconfChannel=xfdashboard_application_get_xfconf_channel(NULL);
-	priv->currentSortMode=XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_NONE;
 	priv->nextSortMode=XFDASHBOARD_APPLICATIONS_SEARCH_PROVIDER_SORT_MODE_NONE;
 
 	/* Get application database */
@@ -1507,8 +2688,19 @@ static void xfdashboard_applications_search_provider_init(XfdashboardApplication
 														G_CALLBACK(_xfdashboard_applications_search_provider_on_application_removed),
 														self);
 
-	/* Get list of all installed applications */
-	priv->allApps=xfdashboard_application_database_get_all_applications(priv->appDB);
+	/* Build index of all installed applications */
+	priv->index=_xfdashboard_applications_search_provider_index_new();
+	priv->appInfoChangedIDs=g_hash_table_new_full(g_direct_hash,
+													g_direct_equal,
+													g_object_unref,
+													NULL);
+
+	allApps=xfdashboard_application_database_get_all_applications(priv->appDB);
+	for(iter=allApps; iter; iter=g_list_next(iter))
+	{
+		_xfdashboard_applications_search_provider_index_add(self, G_APP_INFO(iter->data));
+	}
+	g_list_free_full(allApps, g_object_unref);
 
 	/* Bind to xfconf to react on changes */
 	priv->xfconfSortModeBindingID=
@@ -27,6 +27,7 @@
 
 #include <glib/gi18n-lib.h>
 #include <gtk/gtk.h>
+#include <math.h>
 
 #include <libxfdashboard/applications-view.h>
 #include <libxfdashboard/view.h>
@@ -49,6 +50,7 @@
 #include <libxfdashboard/popup-menu-item-button.h>
 #include <libxfdashboard/popup-menu-item-separator.h>
 #include <libxfdashboard/application-tracker.h>
+#include <libxfdashboard/actor-pool.h>
 #include <libxfdashboard/compat.h>
 #include <libxfdashboard/debug.h>
 
@@ -84,6 +86,13 @@ struct _XfdashboardApplicationsViewPrivate
 	XfconfChannel						*xfconfChannel;
 	gboolean							showAllAppsMenu;
 	guint								xfconfShowAllAppsMenuBindingID;
+
+	GPtrArray							*pendingItems;
+	guint								pendingItemsIndex;
+	guint								realizePendingItemsID;
+
+	XfdashboardActorPool				*actorPool;
+	ClutterActor						*draggedItem;
 };
 
 /* Properties */
@@ -109,6 +118,11 @@ static GParamSpec* XfdashboardApplicationsViewProperties[PROP_LAST]={ 0, };
 #define ALL_APPLICATIONS_MENU_ICON		"applications-other"
 #define SHOW_ALL_APPS_XFCONF_PROP		"/components/applications-view/show-all-apps"
 
+#define REALIZE_INITIAL_ITEMS			32		/* Number of items to realize if size of items is unknown */
+#define REALIZE_OVERSCAN_FACTOR			1.0f	/* Realize items this factor of viewport's height ahead */
+
+#define PLACEHOLDER_APP_INFO_KEY		"xfdashboard-applications-view-placeholder-app-info"
+
 /* Forward declarations */
 static void _xfdashboard_applications_view_on_item_clicked(XfdashboardApplicationsView *self, gpointer inUserData);
 
@@ -174,6 +188,9 @@ static void _xfdashboard_applications_view_on_drag_begin(ClutterDragAction *inAc
 	/* Prevent signal "clicked" from being emitted on dragged icon */
 	g_signal_handlers_block_by_func(inActor, _xfdashboard_applications_view_on_item_clicked, inUserData);
 
+	/* Do not recycle dragged icon even if it is scrolled out of view */
+	XFDASHBOARD_APPLICATIONS_VIEW(inUserData)->priv->draggedItem=inActor;
+
 	/* Get stage */
 	stage=CLUTTER_STAGE(clutter_actor_get_stage(inActor));
 
@@ -217,6 +234,9 @@ static void _xfdashboard_applications_view_on_drag_end(ClutterDragAction *inActi
 
 	/* Allow signal "clicked" from being emitted again */
 	g_signal_handlers_unblock_by_func(inActor, _xfdashboard_applications_view_on_item_clicked, inUserData);
+
+	/* Allow dragged icon to be recycled again */
+	XFDASHBOARD_APPLICATIONS_VIEW(inUserData)->priv->draggedItem=NULL;
 }
 
 /* Filter of applications data model has changed */
@@ -451,6 +471,608 @@ static void _xfdashboard_applications_view_on_all_applications_menu_parent_menu_
 	xfdashboard_view_scroll_to(XFDASHBOARD_VIEW(self), -1, 0);
 }
 
+/* Get style class of actors for current view mode */
+static const gchar* _xfdashboard_applications_view_get_view_mode_class(XfdashboardApplicationsView *self)
+{
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self), NULL);
+
+	if(self->priv->viewMode==XFDASHBOARD_VIEW_MODE_LIST) return("view-mode-list");
+	return("view-mode-icon");
+}
+
+/* Add actor of an item to view either at end or in place of a placeholder */
+static void _xfdashboard_applications_view_add_item_actor(XfdashboardApplicationsView *self,
+															ClutterActor *inActor,
+															ClutterActor *inPlaceholder)
+{
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self));
+	g_return_if_fail(CLUTTER_IS_ACTOR(inActor));
+	g_return_if_fail(!inPlaceholder || CLUTTER_IS_ACTOR(inPlaceholder));
+
+	if(inPlaceholder) clutter_actor_replace_child(CLUTTER_ACTOR(self), inPlaceholder, inActor);
+		else clutter_actor_add_child(CLUTTER_ACTOR(self), inActor);
+}
+
+/* Create actor for an application, add it to view and set up its actions.
+ * If a placeholder is given the actor replaces it.
+ */
+static ClutterActor* _xfdashboard_applications_view_create_application_actor(XfdashboardApplicationsView *self,
+																				GAppInfo *inAppInfo,
+																				ClutterActor *inPlaceholder)
+{
+	XfdashboardApplicationsViewPrivate	*priv;
+	ClutterActor						*actor;
+	ClutterAction						*clickAction;
+	ClutterAction						*dragAction;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self), NULL);
+	g_return_val_if_fail(G_IS_APP_INFO(inAppInfo), NULL);
+
+	priv=self->priv;
+
+	/* Reuse a recycled actor set up for current view mode if available
+	 * by rebinding it to app info. Its actions are still connected to
+	 * this view.
+	 */
+	actor=xfdashboard_actor_pool_acquire(priv->actorPool,
+											XFDASHBOARD_TYPE_APPLICATION_BUTTON,
+											_xfdashboard_applications_view_get_view_mode_class(self));
+	if(actor)
+	{
+		xfdashboard_application_button_set_app_info(XFDASHBOARD_APPLICATION_BUTTON(actor), inAppInfo);
+		_xfdashboard_applications_view_add_item_actor(self, actor, inPlaceholder);
+		clutter_actor_show(actor);
+
+		return(actor);
+	}
+
+	/* Create actor for app info */
+	actor=xfdashboard_application_button_new_from_app_info(inAppInfo);
+	g_signal_connect_swapped(actor, "clicked", G_CALLBACK(_xfdashboard_applications_view_on_item_clicked), self);
+
+	/* Add to view and layout */
+	_xfdashboard_applications_view_setup_actor_for_view_mode(self, CLUTTER_ACTOR(actor));
+	_xfdashboard_applications_view_add_item_actor(self, actor, inPlaceholder);
+	clutter_actor_show(actor);
+
+	/* Set up and add pop-up menu click action and drag action */
+	clickAction=xfdashboard_click_action_new();
+	g_signal_connect_swapped(clickAction, "clicked", G_CALLBACK(_xfdashboard_applications_view_on_popup_menu), self);
+	clutter_actor_add_action(actor, clickAction);
+
+	dragAction=xfdashboard_drag_action_new_with_source(CLUTTER_ACTOR(self));
+	clutter_drag_action_set_drag_threshold(CLUTTER_DRAG_ACTION(dragAction), -1, -1);
+	clutter_actor_add_action(actor, dragAction);
+	g_signal_connect(dragAction, "drag-begin", G_CALLBACK(_xfdashboard_applications_view_on_drag_begin), self);
+	g_signal_connect(dragAction, "drag-end", G_CALLBACK(_xfdashboard_applications_view_on_drag_end), self);
+
+	/* Allow actor to be recycled */
+	xfdashboard_actor_pool_register(priv->actorPool, actor, _xfdashboard_applications_view_get_view_mode_class(self));
+
+	return(actor);
+}
+
+/* Create actor for a sub-menu and add it to view */
+static ClutterActor* _xfdashboard_applications_view_create_menu_actor(XfdashboardApplicationsView *self,
+																		GarconMenuElement *inMenuElement)
+{
+	XfdashboardApplicationsViewPrivate	*priv;
+	ClutterActor						*actor;
+	gchar								*actorText;
+	const gchar							*iconName;
+	const gchar							*title;
+	const gchar							*description;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self), NULL);
+	g_return_val_if_fail(GARCON_IS_MENU_ELEMENT(inMenuElement), NULL);
+
+	priv=self->priv;
+
+	/* Create actor for menu element */
+	actor=xfdashboard_button_new();
+
+	iconName=garcon_menu_element_get_icon_name(inMenuElement);
+	if(iconName) xfdashboard_label_set_icon_name(XFDASHBOARD_LABEL(actor), iconName);
+
+	title=garcon_menu_element_get_name(inMenuElement);
+	description=garcon_menu_element_get_comment(inMenuElement);
+
+	if(priv->viewMode==XFDASHBOARD_VIEW_MODE_LIST)
+	{
+		actorText=g_markup_printf_escaped(priv->formatTitleDescription,
+											title ? title : "",
+											description ? description : "");
+	}
+		else
+		{
+			actorText=g_markup_printf_escaped(priv->formatTitleOnly,
+												title ? title : "");
+		}
+	xfdashboard_label_set_text(XFDASHBOARD_LABEL(actor), actorText);
+	g_free(actorText);
+
+	g_signal_connect(actor, "clicked", G_CALLBACK(_xfdashboard_applications_view_on_menu_clicked), inMenuElement);
+
+	/* Add to view and layout */
+	_xfdashboard_applications_view_setup_actor_for_view_mode(self, CLUTTER_ACTOR(actor));
+	clutter_actor_add_child(CLUTTER_ACTOR(self), CLUTTER_ACTOR(actor));
+	clutter_actor_show(actor);
+
+	return(actor);
+}
+
+/* Create actor for a pending item which is either an application (GAppInfo)
+ * or an element of the applications menu.
+ */
+static void _xfdashboard_applications_view_realize_item(XfdashboardApplicationsView *self, GObject *inItem)
+{
+	ClutterActor						*actor;
+	GAppInfo							*appInfo;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self));
+	g_return_if_fail(G_IS_OBJECT(inItem));
+
+	/* Create actor for item */
+	if(G_IS_APP_INFO(inItem))
+	{
+		actor=_xfdashboard_applications_view_create_application_actor(self, G_APP_INFO(inItem), NULL);
+	}
+		else if(GARCON_IS_MENU_ITEM(inItem))
+		{
+			appInfo=xfdashboard_desktop_app_info_new_from_menu_item(GARCON_MENU_ITEM(inItem));
+			actor=_xfdashboard_applications_view_create_application_actor(self, appInfo, NULL);
+			g_object_unref(appInfo);
+		}
+		else if(GARCON_IS_MENU_ELEMENT(inItem))
+		{
+			actor=_xfdashboard_applications_view_create_menu_actor(self, GARCON_MENU_ELEMENT(inItem));
+		}
+		else
+		{
+			g_warning(_("Cannot create actor for item of type %s"), G_OBJECT_TYPE_NAME(inItem));
+			return;
+		}
+
+	/* If no item was selected (i.e. no "parent menu" item) select this one
+	 * which is usually the first menu item.
+	 */
+	if(actor &&
+		xfdashboard_view_has_focus(XFDASHBOARD_VIEW(self)) &&
+		!xfdashboard_focusable_get_selection(XFDASHBOARD_FOCUSABLE(self)))
+	{
+		xfdashboard_focusable_set_selection(XFDASHBOARD_FOCUSABLE(self), actor);
+	}
+}
+
+/* Get number of columns items are layouted in for requested width */
+static gint _xfdashboard_applications_view_get_columns_for_width(XfdashboardApplicationsView *self,
+																	gfloat inForWidth,
+																	gfloat inChildWidth)
+{
+	XfdashboardApplicationsViewPrivate	*priv;
+	gint								columns;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self), 1);
+
+	priv=self->priv;
+
+	/* In list mode each item is in its own row */
+	if(priv->viewMode!=XFDASHBOARD_VIEW_MODE_ICON) return(1);
+
+	/* If layout uses a fixed number of columns return it */
+	columns=xfdashboard_dynamic_table_layout_get_fixed_columns(XFDASHBOARD_DYNAMIC_TABLE_LAYOUT(priv->layout));
+	if(columns>0) return(columns);
+
+	/* Determine number of columns the same way as the layout does */
+	if(inForWidth<=0.0f || inChildWidth<=0.0f) return(1);
+
+	columns=floor((inForWidth+priv->spacing)/(inChildWidth+priv->spacing));
+	return(MAX(columns, 1));
+}
+
+/* Get visible area of view. The viewpad sets the clipping of the active
+ * view to the area currently visible. If no clipping was set yet assume
+ * the area of stage at top of view. Returns FALSE if visible area is unknown.
+ */
+static gboolean _xfdashboard_applications_view_get_visible_area(XfdashboardApplicationsView *self,
+																gfloat *outY,
+																gfloat *outWidth,
+																gfloat *outHeight)
+{
+	ClutterActor						*stage;
+	gfloat								viewportY, viewportWidth, viewportHeight;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self), FALSE);
+
+	if(clutter_actor_has_clip(CLUTTER_ACTOR(self)))
+	{
+		clutter_actor_get_clip(CLUTTER_ACTOR(self), NULL, &viewportY, &viewportWidth, &viewportHeight);
+	}
+		else
+		{
+			stage=clutter_actor_get_stage(CLUTTER_ACTOR(self));
+			if(!stage) return(FALSE);
+
+			viewportY=0.0f;
+			clutter_actor_get_size(stage, &viewportWidth, &viewportHeight);
+		}
+
+	if(viewportWidth<=0.0f || viewportHeight<=0.0f) return(FALSE);
+
+	/* Set result */
+	if(outY) *outY=viewportY;
+	if(outWidth) *outWidth=viewportWidth;
+	if(outHeight) *outHeight=viewportHeight;
+
+	return(TRUE);
+}
+
+/* Get number of pending items which need to be realized to fill the visible
+ * area of this view including the overscan margin.
+ */
+static guint _xfdashboard_applications_view_get_number_items_to_realize(XfdashboardApplicationsView *self)
+{
+	XfdashboardApplicationsViewPrivate	*priv;
+	ClutterActor						*lastChild;
+	gfloat								viewportY, viewportWidth, viewportHeight;
+	gfloat								childWidth, childHeight;
+	gint								columns, rows;
+	gint								numberChildren;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self), 0);
+
+	priv=self->priv;
+
+	/* If no item is realized yet the size of an item is unknown, so realize
+	 * an initial set of items to measure.
+	 */
+	lastChild=clutter_actor_get_last_child(CLUTTER_ACTOR(self));
+	if(!lastChild) return(REALIZE_INITIAL_ITEMS);
+
+	/* Get visible area of view */
+	if(!_xfdashboard_applications_view_get_visible_area(self, &viewportY, &viewportWidth, &viewportHeight)) return(0);
+
+	/* Determine size of an item by the last one realized */
+	clutter_actor_get_preferred_size(lastChild, NULL, NULL, &childWidth, &childHeight);
+	if(childHeight<=0.0f) return(0);
+
+	/* Determine number of items needed to fill all rows up to end of
+	 * visible area plus overscan margin.
+	 */
+	columns=_xfdashboard_applications_view_get_columns_for_width(self, viewportWidth, childWidth);
+	rows=ceil((viewportY+(viewportHeight*(1.0f+REALIZE_OVERSCAN_FACTOR)))/(childHeight+priv->spacing));
+	numberChildren=clutter_actor_get_n_children(CLUTTER_ACTOR(self));
+
+	if((rows*columns)<=numberChildren) return(0);
+	return((rows*columns)-numberChildren);
+}
+
+/* Check if there are pending items not realized yet */
+static gboolean _xfdashboard_applications_view_has_pending_items(XfdashboardApplicationsView *self)
+{
+	XfdashboardApplicationsViewPrivate	*priv;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self), FALSE);
+
+	priv=self->priv;
+
+	return(priv->pendingItemsIndex<priv->pendingItems->len);
+}
+
+/* Realize the next number of pending items in order */
+static void _xfdashboard_applications_view_realize_pending_items_count(XfdashboardApplicationsView *self,
+																		guint inCount)
+{
+	XfdashboardApplicationsViewPrivate	*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self));
+
+	priv=self->priv;
+
+	if(inCount>0 && priv->pendingItemsIndex<priv->pendingItems->len)
+	{
+		XFDASHBOARD_DEBUG(self, ACTOR,
+							"Realizing %u of %u pending items",
+							MIN(inCount, priv->pendingItems->len-priv->pendingItemsIndex),
+							priv->pendingItems->len-priv->pendingItemsIndex);
+	}
+
+	while(inCount>0 && priv->pendingItemsIndex<priv->pendingItems->len)
+	{
+		_xfdashboard_applications_view_realize_item(self, G_OBJECT(g_ptr_array_index(priv->pendingItems, priv->pendingItemsIndex)));
+		priv->pendingItemsIndex++;
+		inCount--;
+	}
+
+	/* Release pending items if all were realized */
+	if(priv->pendingItemsIndex>=priv->pendingItems->len)
+	{
+		g_ptr_array_set_size(priv->pendingItems, 0);
+		priv->pendingItemsIndex=0;
+	}
+}
+
+/* Realize pending items needed to fill visible area */
+static void _xfdashboard_applications_view_realize_pending_items(XfdashboardApplicationsView *self)
+{
+	guint								count;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self));
+
+	/* Realize items until the visible area is filled or all items are realized */
+	while(_xfdashboard_applications_view_has_pending_items(self))
+	{
+		count=_xfdashboard_applications_view_get_number_items_to_realize(self);
+
+		if(count==0) break;
+
+		_xfdashboard_applications_view_realize_pending_items_count(self, count);
+	}
+}
+
+/* Check if actor is a placeholder for a recycled application button */
+static gboolean _xfdashboard_applications_view_is_placeholder(ClutterActor *inActor)
+{
+	return(inActor && g_object_get_data(G_OBJECT(inActor), PLACEHOLDER_APP_INFO_KEY)!=NULL);
+}
+
+/* Create placeholder of requested size for an application button which is
+ * not realized. The placeholder is not added to view.
+ */
+static ClutterActor* _xfdashboard_applications_view_create_placeholder(XfdashboardApplicationsView *self,
+																		GAppInfo *inAppInfo,
+																		gfloat inWidth,
+																		gfloat inHeight)
+{
+	ClutterActor						*placeholder;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self), NULL);
+	g_return_val_if_fail(G_IS_APP_INFO(inAppInfo), NULL);
+
+	placeholder=clutter_actor_new();
+	clutter_actor_set_size(placeholder, inWidth, inHeight);
+	_xfdashboard_applications_view_setup_actor_for_view_mode(self, placeholder);
+	g_object_set_data_full(G_OBJECT(placeholder), PLACEHOLDER_APP_INFO_KEY, g_object_ref(inAppInfo), g_object_unref);
+	clutter_actor_show(placeholder);
+
+	return(placeholder);
+}
+
+/* Replace an application button scrolled out of view by a placeholder of
+ * same size and recycle the button.
+ */
+static void _xfdashboard_applications_view_unrealize_item(XfdashboardApplicationsView *self,
+															ClutterActor *inActor)
+{
+	XfdashboardApplicationsViewPrivate	*priv;
+	ClutterActor						*placeholder;
+	GAppInfo							*appInfo;
+	gfloat								width, height;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self));
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION_BUTTON(inActor));
+
+	priv=self->priv;
+
+	appInfo=xfdashboard_application_button_get_app_info(XFDASHBOARD_APPLICATION_BUTTON(inActor));
+	if(!appInfo) return;
+
+	/* Create placeholder keeping position and size of application button in layout */
+	clutter_actor_get_size(inActor, &width, &height);
+
+	placeholder=_xfdashboard_applications_view_create_placeholder(self, appInfo, width, height);
+	clutter_actor_insert_child_below(CLUTTER_ACTOR(self), placeholder, inActor);
+
+	/* Recycle application button */
+	if(!xfdashboard_actor_pool_release(priv->actorPool, inActor)) clutter_actor_destroy(inActor);
+}
+
+/* Replace a placeholder by an application button again. Returns the
+ * application button now at position of placeholder.
+ */
+static ClutterActor* _xfdashboard_applications_view_restore_item(XfdashboardApplicationsView *self,
+																	ClutterActor *inPlaceholder)
+{
+	GAppInfo							*appInfo;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self), NULL);
+	g_return_val_if_fail(CLUTTER_IS_ACTOR(inPlaceholder), NULL);
+
+	appInfo=G_APP_INFO(g_object_get_data(G_OBJECT(inPlaceholder), PLACEHOLDER_APP_INFO_KEY));
+	if(!appInfo) return(inPlaceholder);
+
+	return(_xfdashboard_applications_view_create_application_actor(self, appInfo, inPlaceholder));
+}
+
+/* Add all pending items to view but realize only the last ones requested.
+ * Applications skipped get a placeholder of the size of an item, so that
+ * the end of all items can be selected without realizing all items in between.
+ */
+static void _xfdashboard_applications_view_skip_pending_items(XfdashboardApplicationsView *self,
+																guint inRealizeCount)
+{
+	XfdashboardApplicationsViewPrivate	*priv;
+	ClutterActor						*lastChild;
+	GObject								*item;
+	GAppInfo							*appInfo;
+	gfloat								childWidth, childHeight;
+	guint								skipCount;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self));
+
+	priv=self->priv;
+
+	/* Realize an item at least to know the size of an item */
+	if(!clutter_actor_get_last_child(CLUTTER_ACTOR(self)))
+	{
+		_xfdashboard_applications_view_realize_pending_items_count(self, 1);
+	}
+
+	if(!_xfdashboard_applications_view_has_pending_items(self)) return;
+
+	lastChild=clutter_actor_get_last_child(CLUTTER_ACTOR(self));
+	clutter_actor_get_preferred_size(lastChild, NULL, NULL, &childWidth, &childHeight);
+
+	/* Add placeholders for all pending items but the last ones requested.
+	 * Sub-menus are realized as they do not have an application button.
+	 */
+	skipCount=priv->pendingItems->len-priv->pendingItemsIndex;
+	skipCount=(skipCount>inRealizeCount ? skipCount-inRealizeCount : 0);
+
+	XFDASHBOARD_DEBUG(self, ACTOR,
+						"Skipping %u of %u pending items",
+						skipCount,
+						priv->pendingItems->len-priv->pendingItemsIndex);
+
+	while(skipCount>0)
+	{
+		item=G_OBJECT(g_ptr_array_index(priv->pendingItems, priv->pendingItemsIndex));
+
+		appInfo=NULL;
+		if(G_IS_APP_INFO(item)) appInfo=G_APP_INFO(g_object_ref(item));
+			else if(GARCON_IS_MENU_ITEM(item)) appInfo=xfdashboard_desktop_app_info_new_from_menu_item(GARCON_MENU_ITEM(item));
+
+		if(appInfo)
+		{
+			clutter_actor_add_child(CLUTTER_ACTOR(self),
+									_xfdashboard_applications_view_create_placeholder(self, appInfo, childWidth, childHeight));
+			g_object_unref(appInfo);
+		}
+			else _xfdashboard_applications_view_realize_item(self, item);
+
+		priv->pendingItemsIndex++;
+		skipCount--;
+	}
+
+	/* Realize remaining items */
+	_xfdashboard_applications_view_realize_pending_items_count(self, priv->pendingItems->len-priv->pendingItemsIndex);
+}
+
+/* Recycle application buttons scrolled out of visible area including the
+ * overscan margin and restore the ones scrolled into it again.
+ */
+static void _xfdashboard_applications_view_update_realized_items(XfdashboardApplicationsView *self)
+{
+	XfdashboardApplicationsViewPrivate	*priv;
+	ClutterActor						*child;
+	ClutterActor						*nextChild;
+	gfloat								viewportY, viewportHeight;
+	gfloat								topY, bottomY;
+	gfloat								childY1, childY2;
+	gboolean							isVisible;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self));
+
+	priv=self->priv;
+
+	/* Do not recycle anything as long as visible area is unknown */
+	if(!clutter_actor_has_clip(CLUTTER_ACTOR(self))) return;
+	if(!_xfdashboard_applications_view_get_visible_area(self, &viewportY, NULL, &viewportHeight)) return;
+
+	topY=viewportY-(viewportHeight*REALIZE_OVERSCAN_FACTOR);
+	bottomY=viewportY+(viewportHeight*(1.0f+REALIZE_OVERSCAN_FACTOR));
+
+	/* Get next sibling before child is replaced */
+	child=clutter_actor_get_first_child(CLUTTER_ACTOR(self));
+	while(child)
+	{
+		nextChild=clutter_actor_get_next_sibling(child);
+
+		if(clutter_actor_has_allocation(child))
+		{
+			childY1=clutter_actor_get_y(child);
+			childY2=childY1+clutter_actor_get_height(child);
+			isVisible=(childY2>=topY && childY1<=bottomY);
+
+			if(isVisible && _xfdashboard_applications_view_is_placeholder(child))
+			{
+				_xfdashboard_applications_view_restore_item(self, child);
+			}
+				else if(!isVisible &&
+						XFDASHBOARD_IS_APPLICATION_BUTTON(child) &&
+						child!=priv->selectedItem &&
+						child!=priv->draggedItem)
+				{
+					_xfdashboard_applications_view_unrealize_item(self, child);
+				}
+		}
+
+		child=nextChild;
+	}
+}
+
+/* Remove all children and recycle application buttons */
+static void _xfdashboard_applications_view_remove_all_children(XfdashboardApplicationsView *self)
+{
+	XfdashboardApplicationsViewPrivate	*priv;
+	ClutterActor						*child;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self));
+
+	priv=self->priv;
+
+	while((child=clutter_actor_get_first_child(CLUTTER_ACTOR(self))))
+	{
+		if(!xfdashboard_actor_pool_release(priv->actorPool, child)) clutter_actor_destroy(child);
+	}
+}
+
+/* Forget all pending items */
+static void _xfdashboard_applications_view_clear_pending_items(XfdashboardApplicationsView *self)
+{
+	XfdashboardApplicationsViewPrivate	*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self));
+
+	priv=self->priv;
+
+	if(priv->realizePendingItemsID)
+	{
+		g_source_remove(priv->realizePendingItemsID);
+		priv->realizePendingItemsID=0;
+	}
+
+	g_ptr_array_set_size(priv->pendingItems, 0);
+	priv->pendingItemsIndex=0;
+}
+
+/* Idle callback to realize pending items which became visible */
+static gboolean _xfdashboard_applications_view_on_realize_pending_items_idle(gpointer inUserData)
+{
+	XfdashboardApplicationsView			*self;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(inUserData), G_SOURCE_REMOVE);
+
+	self=XFDASHBOARD_APPLICATIONS_VIEW(inUserData);
+
+	self->priv->realizePendingItemsID=0;
+	_xfdashboard_applications_view_update_realized_items(self);
+	_xfdashboard_applications_view_realize_pending_items(self);
+
+	return(G_SOURCE_REMOVE);
+}
+
+/* Clipping of this view changed, i.e. the view was scrolled or resized, so
+ * realize pending items which became visible and recycle application buttons
+ * which are not visible anymore. This is deferred to an idle callback because
+ * clipping is usually set while layouting or painting.
+ */
+static void _xfdashboard_applications_view_on_clip_changed(XfdashboardApplicationsView *self,
+															GParamSpec *inSpec,
+															gpointer inUserData)
+{
+	XfdashboardApplicationsViewPrivate	*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self));
+
+	priv=self->priv;
+
+	if(!priv->realizePendingItemsID)
+	{
+		priv->realizePendingItemsID=g_idle_add(_xfdashboard_applications_view_on_realize_pending_items_idle, self);
+	}
+}
+
 /* Show sub-menu with all installed applications */
 static gint _xfdashboard_applications_view_on_all_applications_sort_app_info(XfdashboardDesktopAppInfo *inLeft, XfdashboardDesktopAppInfo *inRight)
 {
@@ -527,17 +1149,16 @@ static void _xfdashboard_applications_view_on_all_applications_menu_clicked(Xfda
 	GList								*iter;
 	XfdashboardDesktopAppInfo			*appInfo;
 	XfdashboardApplicationDatabase		*appDB;
-	ClutterAction						*clickAction;
-	ClutterAction						*dragAction;
 	gchar								*actorText;
 
 	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self));
 
 	priv=self->priv;
 
-	/* Destroy all children */
+	/* Destroy all children and forget items not realized yet */
+	_xfdashboard_applications_view_clear_pending_items(self);
 	xfdashboard_focusable_set_selection(XFDASHBOARD_FOCUSABLE(self), NULL);
-	clutter_actor_destroy_all_children(CLUTTER_ACTOR(self));
+	_xfdashboard_applications_view_remove_all_children(self);
 	clutter_layout_manager_layout_changed(priv->layout);
 
 	/* Create parent menu item */
@@ -566,7 +1187,9 @@ static void _xfdashboard_applications_view_on_all_applications_menu_clicked(Xfda
 		xfdashboard_focusable_set_selection(XFDASHBOARD_FOCUSABLE(self), CLUTTER_ACTOR(actor));
 	}
 
-	/* Create menu items for all installed applications */
+	/* Collect all installed applications. Actors for them are only created
+	 * when they get visible in viewport.
+	 */
 	appDB=xfdashboard_application_database_get_default();
 
 	allApps=xfdashboard_application_database_get_all_applications(appDB);
@@ -583,40 +1206,15 @@ static void _xfdashboard_applications_view_on_all_applications_menu_clicked(Xfda
 			continue;
 		}
 
-		/* Create actor for app info */
-		actor=xfdashboard_application_button_new_from_app_info(G_APP_INFO(appInfo));
-
-		g_signal_connect_swapped(actor, "clicked", G_CALLBACK(_xfdashboard_applications_view_on_item_clicked), self);
-
-		/* Set up and add pop-up menu click action */
-		clickAction=xfdashboard_click_action_new();
-		g_signal_connect_swapped(clickAction, "clicked", G_CALLBACK(_xfdashboard_applications_view_on_popup_menu), self);
-		clutter_actor_add_action(actor, clickAction);
-
-		/* Add to view and layout */
-		_xfdashboard_applications_view_setup_actor_for_view_mode(self, CLUTTER_ACTOR(actor));
-		clutter_actor_add_child(CLUTTER_ACTOR(self), CLUTTER_ACTOR(actor));
-		clutter_actor_show(actor);
-
-		/* Add drag action to actor */
-		dragAction=xfdashboard_drag_action_new_with_source(CLUTTER_ACTOR(self));
-		clutter_drag_action_set_drag_threshold(CLUTTER_DRAG_ACTION(dragAction), -1, -1);
-		clutter_actor_add_action(actor, dragAction);
-		g_signal_connect(dragAction, "drag-begin", G_CALLBACK(_xfdashboard_applications_view_on_drag_begin), self);
-		g_signal_connect(dragAction, "drag-end", G_CALLBACK(_xfdashboard_applications_view_on_drag_end), self);
-
-		/* If no item was selected (i.e. no "parent menu" item) select this one
-		 * which is usually the first menu item.
-		 */
-		if(xfdashboard_view_has_focus(XFDASHBOARD_VIEW(self)) &&
-			!xfdashboard_focusable_get_selection(XFDASHBOARD_FOCUSABLE(self)))
-		{
-			xfdashboard_focusable_set_selection(XFDASHBOARD_FOCUSABLE(self), CLUTTER_ACTOR(actor));
-		}
+		/* Add app info to list of pending items */
+		g_ptr_array_add(priv->pendingItems, g_object_ref(appInfo));
 	}
 
 	g_list_free_full(allApps, g_object_unref);
 	g_object_unref(appDB);
+
+	/* Create actors for items visible in viewport */
+	_xfdashboard_applications_view_realize_pending_items(self);
 }
 
 /* Filter to display applications has changed */
@@ -627,17 +1225,15 @@ static void _xfdashboard_applications_view_on_filter_changed(XfdashboardApplicat
 	ClutterActor						*actor;
 	GarconMenuElement					*menuElement=NULL;
 	GarconMenu							*parentMenu=NULL;
-	ClutterAction						*clickAction;
-	ClutterAction						*dragAction;
-	GAppInfo							*appInfo;
 
 	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(self));
 
 	priv=XFDASHBOARD_APPLICATIONS_VIEW(self)->priv;
 
-	/* Destroy all children */
+	/* Destroy all children and forget items not realized yet */
+	_xfdashboard_applications_view_clear_pending_items(self);
 	xfdashboard_focusable_set_selection(XFDASHBOARD_FOCUSABLE(self), NULL);
-	clutter_actor_destroy_all_children(CLUTTER_ACTOR(self));
+	_xfdashboard_applications_view_remove_all_children(self);
 	clutter_layout_manager_layout_changed(priv->layout);
 
 	/* Get parent menu */
@@ -704,7 +1300,9 @@ static void _xfdashboard_applications_view_on_filter_changed(XfdashboardApplicat
 		}
 	}
 
-	/* Iterate through (filtered) data model and create actor for each entry */
+	/* Iterate through (filtered) data model and collect each entry. Actors
+	 * for them are only created when they get visible in viewport.
+	 */
 	iterator=xfdashboard_model_iter_new(XFDASHBOARD_MODEL(priv->apps));
 	if(iterator)
 	{
@@ -721,83 +1319,17 @@ static void _xfdashboard_applications_view_on_filter_changed(XfdashboardApplicat
 
 			if(!menuElement) continue;
 
-			/* Create actor for menu element. Support drag'n'drop at actor if
-			 * menu element is a menu item.
+			/* Add menu element to list of pending items which takes
+			 * the reference we got from model.
 			 */
-			if(GARCON_IS_MENU_ITEM(menuElement))
-			{
-				appInfo=xfdashboard_desktop_app_info_new_from_menu_item(GARCON_MENU_ITEM(menuElement));
-				actor=xfdashboard_application_button_new_from_app_info(appInfo);
-				g_object_unref(appInfo);
-
-				g_signal_connect_swapped(actor, "clicked", G_CALLBACK(_xfdashboard_applications_view_on_item_clicked), self);
-			}
-				else
-				{
-					gchar		*actorText;
-					const gchar	*iconName;
-					const gchar	*title;
-					const gchar	*description;
-
-					actor=xfdashboard_button_new();
-
-					iconName=garcon_menu_element_get_icon_name(menuElement);
-					if(iconName) xfdashboard_label_set_icon_name(XFDASHBOARD_LABEL(actor), iconName);
-
-					title=garcon_menu_element_get_name(menuElement);
-					description=garcon_menu_element_get_comment(menuElement);
-
-					if(priv->viewMode==XFDASHBOARD_VIEW_MODE_LIST)
-					{
-						actorText=g_markup_printf_escaped(priv->formatTitleDescription,
-															title ? title : "",
-															description ? description : "");
-					}
-						else
-						{
-							actorText=g_markup_printf_escaped(priv->formatTitleOnly,
-																title ? title : "");
-						}
-					xfdashboard_label_set_text(XFDASHBOARD_LABEL(actor), actorText);
-					g_free(actorText);
-
-					g_signal_connect(actor, "clicked", G_CALLBACK(_xfdashboard_applications_view_on_menu_clicked), menuElement);
-				}
-
-			/* Add to view and layout */
-			_xfdashboard_applications_view_setup_actor_for_view_mode(self, CLUTTER_ACTOR(actor));
-			clutter_actor_add_child(CLUTTER_ACTOR(self), CLUTTER_ACTOR(actor));
-			clutter_actor_show(actor);
-
-			/* Set up and add pop-up menu click action and drag action */
-			if(GARCON_IS_MENU_ITEM(menuElement))
-			{
-				clickAction=xfdashboard_click_action_new();
-				g_signal_connect_swapped(clickAction, "clicked", G_CALLBACK(_xfdashboard_applications_view_on_popup_menu), self);
-				clutter_actor_add_action(actor, clickAction);
-
-				dragAction=xfdashboard_drag_action_new_with_source(CLUTTER_ACTOR(self));
-				clutter_drag_action_set_drag_threshold(CLUTTER_DRAG_ACTION(dragAction), -1, -1);
-				clutter_actor_add_action(actor, dragAction);
-				g_signal_connect(dragAction, "drag-begin", G_CALLBACK(_xfdashboard_applications_view_on_drag_begin), self);
-				g_signal_connect(dragAction, "drag-end", G_CALLBACK(_xfdashboard_applications_view_on_drag_end), self);
-			}
-
-			/* If no item was selected (i.e. no "parent menu" item) select this one
-			 * which is usually the first menu item.
-			 */
-			if(xfdashboard_view_has_focus(XFDASHBOARD_VIEW(self)) &&
-				!xfdashboard_focusable_get_selection(XFDASHBOARD_FOCUSABLE(self)))
-			{
-				xfdashboard_focusable_set_selection(XFDASHBOARD_FOCUSABLE(self), CLUTTER_ACTOR(actor));
-			}
-
-			/* Release allocated resources */
-			g_object_unref(menuElement);
+			g_ptr_array_add(priv->pendingItems, menuElement);
 			menuElement=NULL;
 		}
 		g_object_unref(iterator);
 	}
+
+	/* Create actors for items visible in viewport */
+	_xfdashboard_applications_view_realize_pending_items(self);
 }
 
 /* Application model has fully loaded */
@@ -912,6 +1444,12 @@ static gboolean _xfdashboard_applications_view_focusable_set_selection(Xfdashboa
 		return(FALSE);
 	}
 
+	/* Restore application button if a placeholder should be selected */
+	if(_xfdashboard_applications_view_is_placeholder(inSelection))
+	{
+		inSelection=_xfdashboard_applications_view_restore_item(self, inSelection);
+	}
+
 	/* Remove weak reference at current selection */
 	if(priv->selectedItem)
 	{
@@ -1008,7 +1546,29 @@ static ClutterActor* _xfdashboard_applications_view_get_selection_from_icon_mode
 
 		case XFDASHBOARD_SELECTION_TARGET_UP:
 			currentSelectionRow--;
-			if(currentSelectionRow<0) currentSelectionRow=rows-1;
+			if(currentSelectionRow<0)
+			{
+				/* Wrap around to last row of all items and not only of
+				 * the ones realized so far. Only the items of last row
+				 * are realized, all others get placeholders.
+				 */
+				if(_xfdashboard_applications_view_has_pending_items(self))
+				{
+					guint				totalItems;
+					guint				lastRowItems;
+
+					totalItems=((guint)numberChildren)+(priv->pendingItems->len-priv->pendingItemsIndex);
+					lastRowItems=totalItems % ((guint)columns);
+					if(lastRowItems==0) lastRowItems=(guint)columns;
+
+					_xfdashboard_applications_view_skip_pending_items(self, lastRowItems);
+
+					numberChildren=clutter_actor_get_n_children(CLUTTER_ACTOR(self));
+					rows=(numberChildren+columns-1)/columns;
+				}
+
+				currentSelectionRow=rows-1;
+			}
 			newSelectionIndex=(currentSelectionRow*columns)+currentSelectionColumn;
 
 			newSelectionIndex=MIN(newSelectionIndex, numberChildren-1);
@@ -1017,6 +1577,18 @@ static ClutterActor* _xfdashboard_applications_view_get_selection_from_icon_mode
 
 		case XFDASHBOARD_SELECTION_TARGET_DOWN:
 			currentSelectionRow++;
+
+			/* Realize next row if it is still pending before wrapping around */
+			if(currentSelectionRow>=rows &&
+				_xfdashboard_applications_view_has_pending_items(self))
+			{
+				numberChildren=clutter_actor_get_n_children(CLUTTER_ACTOR(self));
+				_xfdashboard_applications_view_realize_pending_items_count(self, MAX(((currentSelectionRow+1)*columns)-numberChildren, 0));
+
+				numberChildren=clutter_actor_get_n_children(CLUTTER_ACTOR(self));
+				rows=(numberChildren+columns-1)/columns;
+			}
+
 			if(currentSelectionRow>=rows) currentSelectionRow=0;
 			newSelectionIndex=(currentSelectionRow*columns)+currentSelectionColumn;
 
@@ -1099,11 +1671,25 @@ static ClutterActor* _xfdashboard_applications_view_get_selection_from_list_mode
 
 		case XFDASHBOARD_SELECTION_TARGET_UP:
 			newSelection=clutter_actor_get_previous_sibling(inSelection);
-			if(!newSelection) newSelection=clutter_actor_get_last_child(CLUTTER_ACTOR(self));
+			if(!newSelection)
+			{
+				/* Wrap around to last item of all items and not only of
+				 * the ones realized so far. Only the last item is realized,
+				 * all others get placeholders.
+				 */
+				_xfdashboard_applications_view_skip_pending_items(self, 1);
+				newSelection=clutter_actor_get_last_child(CLUTTER_ACTOR(self));
+			}
 			break;
 
 		case XFDASHBOARD_SELECTION_TARGET_DOWN:
 			newSelection=clutter_actor_get_next_sibling(inSelection);
+			if(!newSelection && _xfdashboard_applications_view_has_pending_items(self))
+			{
+				/* Realize next item if it is still pending before wrapping around */
+				_xfdashboard_applications_view_realize_pending_items_count(self, 1);
+				newSelection=clutter_actor_get_next_sibling(inSelection);
+			}
 			if(!newSelection) newSelection=clutter_actor_get_first_child(CLUTTER_ACTOR(self));
 			break;
 
@@ -1219,6 +1805,10 @@ static ClutterActor* _xfdashboard_applications_view_focusable_find_selection(Xfd
 	if(!inSelection)
 	{
 		newSelection=clutter_actor_get_first_child(CLUTTER_ACTOR(self));
+		if(_xfdashboard_applications_view_is_placeholder(newSelection))
+		{
+			newSelection=_xfdashboard_applications_view_restore_item(self, newSelection);
+		}
 
 		valueName=xfdashboard_get_enum_value_name(XFDASHBOARD_TYPE_SELECTION_TARGET, inDirection);
 		XFDASHBOARD_DEBUG(self, ACTOR,
@@ -1271,6 +1861,8 @@ static ClutterActor* _xfdashboard_applications_view_focusable_find_selection(Xfd
 			break;
 
 		case XFDASHBOARD_SELECTION_TARGET_LAST:
+			/* Realize only last item of all items but not all in between */
+			_xfdashboard_applications_view_skip_pending_items(self, 1);
 			newSelection=clutter_actor_get_last_child(CLUTTER_ACTOR(self));
 			break;
 
@@ -1293,6 +1885,14 @@ static ClutterActor* _xfdashboard_applications_view_focusable_find_selection(Xfd
 	/* If new selection could be found override current selection with it */
 	if(newSelection) selection=newSelection;
 
+	/* If new selection is a placeholder of a recycled application button
+	 * restore the button to select it.
+	 */
+	if(_xfdashboard_applications_view_is_placeholder(selection))
+	{
+		selection=_xfdashboard_applications_view_restore_item(self, selection);
+	}
+
 	/* Return new selection found */
 	XFDASHBOARD_DEBUG(self, ACTOR,
 						"Selecting %s at %s for current selection %s in direction %u",
@@ -1350,6 +1950,63 @@ void _xfdashboard_applications_view_focusable_iface_init(XfdashboardFocusableInt
 	iface->activate_selection=_xfdashboard_applications_view_focusable_activate_selection;
 }
 
+/* IMPLEMENTATION: ClutterActor */
+
+/* Get preferred height of this view. Items not realized yet are not known to
+ * layout manager, so add their estimated height to report the full extent
+ * of all items to viewpad and its scrollbars.
+ */
+static void _xfdashboard_applications_view_get_preferred_height(ClutterActor *inActor,
+																gfloat inForWidth,
+																gfloat *outMinHeight,
+																gfloat *outNaturalHeight)
+{
+	XfdashboardApplicationsView			*self;
+	XfdashboardApplicationsViewPrivate	*priv;
+	ClutterActorClass					*clutterActorClass;
+	ClutterActor						*lastChild;
+	gfloat								minHeight, naturalHeight;
+	gfloat								childWidth, childHeight;
+	gint								numberChildren;
+	gint								numberItems;
+	gint								columns;
+	gint								realizedRows, totalRows;
+
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATIONS_VIEW(inActor));
+
+	self=XFDASHBOARD_APPLICATIONS_VIEW(inActor);
+	priv=self->priv;
+
+	/* Get preferred height of realized items from parent class */
+	minHeight=naturalHeight=0.0f;
+
+	clutterActorClass=CLUTTER_ACTOR_CLASS(xfdashboard_applications_view_parent_class);
+	clutterActorClass->get_preferred_height(inActor, inForWidth, &minHeight, &naturalHeight);
+
+	/* Add estimated height of pending items. In icon mode without a width
+	 * to layout for all items are layouted in one row so nothing to add.
+	 */
+	lastChild=clutter_actor_get_last_child(inActor);
+	if(lastChild &&
+		priv->pendingItemsIndex<priv->pendingItems->len &&
+		(priv->viewMode!=XFDASHBOARD_VIEW_MODE_ICON || inForWidth>=0.0f))
+	{
+		clutter_actor_get_preferred_size(lastChild, NULL, NULL, &childWidth, &childHeight);
+
+		numberChildren=clutter_actor_get_n_children(inActor);
+		numberItems=numberChildren+(priv->pendingItems->len-priv->pendingItemsIndex);
+		columns=_xfdashboard_applications_view_get_columns_for_width(self, inForWidth, childWidth);
+
+		realizedRows=(numberChildren+columns-1)/columns;
+		totalRows=(numberItems+columns-1)/columns;
+		naturalHeight+=(totalRows-realizedRows)*(childHeight+priv->spacing);
+	}
+
+	/* Store sizes computed */
+	if(outMinHeight) *outMinHeight=minHeight;
+	if(outNaturalHeight) *outNaturalHeight=naturalHeight;
+}
+
 /* IMPLEMENTATION: GObject */
 
 /* Dispose this object */
@@ -1359,6 +2016,24 @@ static void _xfdashboard_applications_view_dispose(GObject *inObject)
 	XfdashboardApplicationsViewPrivate	*priv=self->priv;
 
 	/* Release allocated resources */
+	if(priv->realizePendingItemsID)
+	{
+		g_source_remove(priv->realizePendingItemsID);
+		priv->realizePendingItemsID=0;
+	}
+
+	if(priv->pendingItems)
+	{
+		g_ptr_array_unref(priv->pendingItems);
+		priv->pendingItems=NULL;
+	}
+
+	if(priv->actorPool)
+	{
+		g_object_unref(priv->actorPool);
+		priv->actorPool=NULL;
+	}
+
 	if(priv->selectedItem)
 	{
 		g_object_remove_weak_pointer(G_OBJECT(priv->selectedItem), &priv->selectedItem);
@@ -1501,9 +2176,12 @@ static void _xfdashboard_applications_view_get_property(GObject *inObject,
 static void xfdashboard_applications_view_class_init(XfdashboardApplicationsViewClass *klass)
 {
 	XfdashboardActorClass	*actorClass=XFDASHBOARD_ACTOR_CLASS(klass);
+	ClutterActorClass		*clutterActorClass=CLUTTER_ACTOR_CLASS(klass);
 	GObjectClass			*gobjectClass=G_OBJECT_CLASS(klass);
 
 	/* Override functions */
+	clutterActorClass->get_preferred_height=_xfdashboard_applications_view_get_preferred_height;
+
 	gobjectClass->dispose=_xfdashboard_applications_view_dispose;
 	gobjectClass->set_property=_xfdashboard_applications_view_set_property;
 	gobjectClass->get_property=_xfdashboard_applications_view_get_property;
@@ -1588,6 +2266,11 @@ static void xfdashboard_applications_view_init(XfdashboardApplicationsView *self
 	priv->showAllAppsMenu=FALSE;
 	priv->xfconfChannel=xfdashboard_application_get_xfconf_channel(NULL);
 	priv->xfconfShowAllAppsMenuBindingID=0;
+	priv->pendingItems=g_ptr_array_new_with_free_func(g_object_unref);
+	priv->pendingItemsIndex=0;
+	priv->realizePendingItemsID=0;
+	priv->actorPool=xfdashboard_actor_pool_new();
+	priv->draggedItem=NULL;
 
 	/* Set up view */
 	xfdashboard_view_set_name(XFDASHBOARD_VIEW(self), _("Applications"));
@@ -1602,6 +2285,7 @@ static void xfdashboard_applications_view_init(XfdashboardApplicationsView *self
 	/* Connect signals */
 	g_signal_connect_swapped(priv->apps, "filter-changed", G_CALLBACK(_xfdashboard_applications_view_on_filter_changed), self);
 	g_signal_connect_swapped(priv->apps, "loaded", G_CALLBACK(_xfdashboard_applications_view_on_model_loaded), self);
+	g_signal_connect(self, "notify::clip-rect", G_CALLBACK(_xfdashboard_applications_view_on_clip_changed), NULL);
 
 	/* Connect signal to application */
 	application=xfdashboard_application_get_default();
@@ -1664,8 +2348,9 @@ void xfdashboard_applications_view_set_view_mode(XfdashboardApplicationsView *se
 				g_assert_not_reached();
 		}
 
-		/* Rebuild view */
+		/* Rebuild view and drop recycled actors set up for old view mode */
 		_xfdashboard_applications_view_on_filter_changed(self, NULL);
+		xfdashboard_actor_pool_clear(priv->actorPool);
 
 		/* Notify about property change */
 		g_object_notify_by_pspec(G_OBJECT(self), XfdashboardApplicationsViewProperties[PROP_VIEW_MODE]);
@@ -39,6 +39,22 @@ G_BEGIN_DECLS
 #define clutter_actor_get_reactive(actor)	CLUTTER_ACTOR_IS_REACTIVE( (actor) )
 #endif
 
+#if !GLIB_CHECK_VERSION(2, 36, 0)
+#include <unistd.h>
+
+inline static guint g_get_num_processors(void)
+{
+#ifdef _SC_NPROCESSORS_ONLN
+	glong		count;
+
+	count=sysconf(_SC_NPROCESSORS_ONLN);
+	if(count>0) return((guint)count);
+#endif
+
+	return(1);
+}
+#endif
+
 #if !GLIB_CHECK_VERSION(2, 44, 0)
 inline static gboolean g_strv_contains(const gchar * const *inStringList, const gchar *inString)
 {
@@ -87,8 +87,27 @@ struct _XfdashboardCssSelectorRule
 
 	guint							origLine;
 	guint							origPosition;
+
+	/* Precompiled representation used for matching */
+	GType							typeID;
+	GQuark							*classQuarks;
+	guint							classCount;
+	guint64							classMask;
+	GQuark							*pseudoClassQuarks;
+	guint							pseudoClassCount;
+	guint64							pseudoClassMask;
 };
 
+/* Bit in a quark set's mask to quickly reject non-matching sets */
+#define XFDASHBOARD_CSS_SELECTOR_QUARK_MASK_BIT(q)		(G_GUINT64_CONSTANT(1) << ((q) & 63))
+
+/* Serialized form of a selector: its priority and the chain of its rules
+ * beginning at rightmost rule. Each rule is stored as type, ID, classes,
+ * pseudo-classes, mode of parent rule, source, priority, line, position
+ * and original line and position.
+ */
+#define XFDASHBOARD_CSS_SELECTOR_VARIANT_TYPE			"(ia(msmsmsmsumsiuuuu))"
+
 /* Create rule */
 static XfdashboardCssSelectorRule* _xfdashboard_css_selector_rule_new(const gchar *inSource,
 																		gint inPriority,
@@ -117,6 +136,8 @@ static void _xfdashboard_css_selector_rule_free(XfdashboardCssSelectorRule *inRu
 	if(inRule->classes) g_free(inRule->classes);
 	if(inRule->pseudoClasses) g_free(inRule->pseudoClasses);
 	if(inRule->source) g_free(inRule->source);
+	if(inRule->classQuarks) g_free(inRule->classQuarks);
+	if(inRule->pseudoClassQuarks) g_free(inRule->pseudoClassQuarks);
 
 	/* Destroy parent selector */
 	if(inRule->parentRule) _xfdashboard_css_selector_rule_free(inRule->parentRule);
@@ -183,52 +204,91 @@ static gchar* _xfdashboard_css_selector_rule_to_string(XfdashboardCssSelectorRul
 	return(selector);
 }
 
-/* Check if haystack contains needle.
- * The haystack is a string representing a list which entries is seperated
- * by a seperator character. This function looks up the haystack if it
- * contains an entry matching the needle and returns TRUE in this case.
- * Otherwise FALSE is returned. A needle length of -1 signals that needle
- * is a NULL-terminated string and length should be determine automatically.
+/* Build zero-terminated quark set and its mask for a string representing
+ * a list which entries are seperated by a seperator character.
  */
-static gboolean _xfdashboard_css_selector_list_contains(const gchar *inNeedle,
-														gint inNeedleLength,
-														const gchar *inHaystack,
-														gchar inSeperator)
+static GQuark* _xfdashboard_css_selector_compile_list(const gchar *inList,
+														gchar inSeperator,
+														guint *outCount,
+														guint64 *outMask)
 {
-	const gchar		*start;
+	GQuark			*quarks;
+	guint			count;
+	guint			i;
+	guint64			mask;
 
-	g_return_val_if_fail(inNeedle && *inNeedle!=0, FALSE);
-	g_return_val_if_fail(inNeedleLength>0 || inNeedleLength==-1, FALSE);
-	g_return_val_if_fail(inHaystack && *inHaystack!=0, FALSE);
-	g_return_val_if_fail(inSeperator, FALSE);
+	g_return_val_if_fail(outCount, NULL);
+	g_return_val_if_fail(outMask, NULL);
 
-	/* If given length of needle is negative it is a NULL-terminated string */
-	if(inNeedleLength<0) inNeedleLength=strlen(inNeedle);
+	quarks=xfdashboard_stylable_build_quark_list(inList, inSeperator, &count);
 
-	/* Lookup needle in haystack */
-	for(start=inHaystack; start; start=strchr(start, inSeperator))
-	{
-		gint		length;
-		gchar		*nextEntry;
+	mask=0;
+	for(i=0; i<count; i++) mask|=XFDASHBOARD_CSS_SELECTOR_QUARK_MASK_BIT(quarks[i]);
 
-		/* Move to character after separator */
-		if(start[0]==inSeperator) start++;
+	*outCount=count;
+	*outMask=mask;
+	return(quarks);
+}
 
-		/* Find end of this haystack entry */
-		nextEntry=strchr(start, inSeperator);
-		if(!nextEntry) length=strlen(start);
-			else length=nextEntry-start;
+/* Resolve type to GType and class and pseudo-class names to quarks once
+ * for this rule and all its parent rules so matching only needs to compare
+ * integers.
+ */
+static void _xfdashboard_css_selector_rule_compile(XfdashboardCssSelectorRule *ioRule)
+{
+	g_return_if_fail(ioRule);
 
-		/* If enrty in haystack is not of same length as needle,
-		 * then it is not a match
-		 */
-		if(length!=inNeedleLength) continue;
+	/* Resolve type but types which are not registered yet are resolved
+	 * the first time they are matched.
+	 */
+	ioRule->typeID=G_TYPE_INVALID;
+	if(ioRule->type && ioRule->type[0]!='*') ioRule->typeID=g_type_from_name(ioRule->type);
+
+	/* Resolve classes and pseudo-classes */
+	if(ioRule->classQuarks) g_free(ioRule->classQuarks);
+	ioRule->classQuarks=_xfdashboard_css_selector_compile_list(ioRule->classes,
+																'.',
+																&ioRule->classCount,
+																&ioRule->classMask);
+
+	if(ioRule->pseudoClassQuarks) g_free(ioRule->pseudoClassQuarks);
+	ioRule->pseudoClassQuarks=_xfdashboard_css_selector_compile_list(ioRule->pseudoClasses,
+																		':',
+																		&ioRule->pseudoClassCount,
+																		&ioRule->pseudoClassMask);
+
+	/* Compile parent rule */
+	if(ioRule->parentRule) _xfdashboard_css_selector_rule_compile(ioRule->parentRule);
+}
 
-		if(!strncmp(inNeedle, start, inNeedleLength)) return(TRUE);
+/* Check if quark set of a node contains all quarks of the rule's quark set */
+static gboolean _xfdashboard_css_selector_quarks_contains_all(const GQuark *inNodeQuarks,
+																const GQuark *inRuleQuarks,
+																guint64 inRuleMask)
+{
+	const GQuark	*node;
+	const GQuark	*rule;
+	guint64			nodeMask;
+
+	/* An empty rule set is always a subset */
+	if(!inRuleQuarks || !*inRuleQuarks) return(TRUE);
+
+	/* An empty node set cannot contain anything */
+	if(!inNodeQuarks || !*inNodeQuarks) return(FALSE);
+
+	/* Reject quickly if any bit of rule's mask is not set in node's mask */
+	nodeMask=0;
+	for(node=inNodeQuarks; *node; node++) nodeMask|=XFDASHBOARD_CSS_SELECTOR_QUARK_MASK_BIT(*node);
+	if((inRuleMask & ~nodeMask)!=0) return(FALSE);
+
+	/* Check that each quark of rule is in node's set */
+	for(rule=inRuleQuarks; *rule; rule++)
+	{
+		for(node=inNodeQuarks; *node && *node!=*rule; node++);
+		if(!*node) return(FALSE);
 	}
 
-	/* Needle was not found */
-	return(FALSE);
+	return(TRUE);
 }
 
 /* Check and score this selector against stylable node.
@@ -239,8 +299,6 @@ static gint _xfdashboard_css_selector_score_node(XfdashboardCssSelectorRule *inR
 {
 	gint					score;
 	gint					a, b, c;
-	const gchar				*classes;
-	const gchar				*pseudoClasses;
 	const gchar				*id;
 
 	g_return_val_if_fail(inRule, -1);
@@ -279,8 +337,6 @@ static gint _xfdashboard_css_selector_score_node(XfdashboardCssSelectorRule *inR
 
 	/* Get properties for given stylable */
 	id=xfdashboard_stylable_get_name(XFDASHBOARD_STYLABLE(inStylable));
-	classes=xfdashboard_stylable_get_classes(XFDASHBOARD_STYLABLE(inStylable));
-	pseudoClasses=xfdashboard_stylable_get_pseudo_classes(XFDASHBOARD_STYLABLE(inStylable));
 
 	/* Check and score type of selectors but ignore NULL or universal selectors */
 	if(inRule->type && inRule->type[0]!='*')
@@ -288,9 +344,15 @@ static gint _xfdashboard_css_selector_score_node(XfdashboardCssSelectorRule *inR
 		GType						ruleTypeID;
 		GType						nodeTypeID;
 
-		/* Get type of this rule */
-		ruleTypeID=g_type_from_name(inRule->type);
-		if(!ruleTypeID) return(-1);
+		/* Get type of this rule and remember it if it was not resolved yet */
+		ruleTypeID=inRule->typeID;
+		if(!ruleTypeID)
+		{
+			ruleTypeID=g_type_from_name(inRule->type);
+			if(!ruleTypeID) return(-1);
+
+			inRule->typeID=ruleTypeID;
+		}
 
 		/* Get type of other rule to check against and score it */
 		nodeTypeID=G_OBJECT_TYPE(inStylable);
@@ -316,82 +378,38 @@ static gint _xfdashboard_css_selector_score_node(XfdashboardCssSelectorRule *inR
 		a+=10;
 	}
 
-	/* Check and score classes */
-	if(inRule->classes)
+	/* Check and score classes. Each class from the selector's rule must
+	 * appear in the set of classes from the node, i.e. the selector's rule
+	 * class set is a subset of the node's class set.
+	 */
+	if(inRule->classCount>0)
 	{
-		gchar				*needle;
-		gint				numberMatches;
-
-		/* If node has no pseudo class return immediately */
-		if(!classes) return(-1);
-
-		/* Check that each class from the selector's rule appears in the
-		 * list of classes from the node, i.e. the selector's rule class list
-		 * is a subset of the node's class list
-		 */
-		numberMatches=0;
-		for(needle=inRule->classes; needle; needle=strchr(needle, '.'))
+		if(!_xfdashboard_css_selector_quarks_contains_all(xfdashboard_stylable_get_class_quarks(inStylable),
+															inRule->classQuarks,
+															inRule->classMask))
 		{
-			gint			needleLength;
-			gchar			*nextNeedle;
-
-			/* Move pointer of needle beyond class seperator '.' */
-			if(needle[0]=='.') needle++;
-
-			/* Get length of needle */
-			nextNeedle=strchr(needle, '.');
-			if(nextNeedle) needleLength=nextNeedle-needle;
-				else needleLength=strlen(needle);
-
-			/* If pseudo-class from the selector does not appear in the
-			 * list of pseudo-classes from the node, then this is not a
-			 * match
-			 */
-			if(!_xfdashboard_css_selector_list_contains(needle, needleLength, classes, '.')) return(-1);
-			numberMatches++;
+			return(-1);
 		}
 
 		/* Score matching class */
-		b=b+(10*numberMatches);
+		b=b+(10*inRule->classCount);
 	}
 
-	/* Check and score pseudo classes */
-	if(inRule->pseudoClasses)
+	/* Check and score pseudo classes. Each pseudo-class from the selector
+	 * must appear in the set of pseudo-classes from the node, i.e. the
+	 * selector pseudo-class set is a subset of the node's pseudo-class set.
+	 */
+	if(inRule->pseudoClassCount>0)
 	{
-		gchar				*needle;
-		gint				numberMatches;
-
-		/* If node has no pseudo class return immediately */
-		if(!pseudoClasses) return(-1);
-
-		/* Check that each pseudo-class from the selector appears in the
-		 * pseudo-classes from the node, i.e. the selector pseudo-class list
-		 * is a subset of the node's pseudo-class list
-		 */
-		numberMatches=0;
-		for(needle=inRule->pseudoClasses; needle; needle=strchr(needle, ':'))
+		if(!_xfdashboard_css_selector_quarks_contains_all(xfdashboard_stylable_get_pseudo_class_quarks(inStylable),
+															inRule->pseudoClassQuarks,
+															inRule->pseudoClassMask))
 		{
-			gint			needleLength;
-			gchar			*nextNeedle;
-
-			/* Move pointer of needle beyond pseudo-class seperator ':' */
-			if(needle[0]==':') needle++;
-
-			/* Get length of needle */
-			nextNeedle=strchr(needle, ':');
-			if(nextNeedle) needleLength=nextNeedle-needle;
-				else needleLength=strlen(needle);
-
-			/* If pseudo-class from the selector does not appear in the
-			 * list of pseudo-classes from the node, then this is not a
-			 * match
-			 */
-			if(!_xfdashboard_css_selector_list_contains(needle, needleLength, pseudoClasses, ':')) return(-1);
-			numberMatches++;
+			return(-1);
 		}
 
 		/* Score matching pseudo-class */
-		b=b+(10*numberMatches);
+		b=b+(10*inRule->pseudoClassCount);
 	}
 
 	/* Check and score parent */
@@ -793,6 +811,9 @@ static gboolean _xfdashboard_css_selector_parse(XfdashboardCssSelector *self, GS
 	/* Restore old scanner configuration */
 	ioScanner->config=oldScannerConfig;
 
+	/* Precompile parsed rules for matching */
+	if(success && self->priv->rule) _xfdashboard_css_selector_rule_compile(self->priv->rule);
+
 	/* Release allocated resources */
 	g_free(scannerConfig);
 
@@ -1052,6 +1073,131 @@ gchar* xfdashboard_css_selector_to_string(XfdashboardCssSelector *self)
 	return(selector);
 }
 
+/* Create new instance of CSS selector from its serialized form as created
+ * by xfdashboard_css_selector_to_variant() without parsing it again.
+ */
+XfdashboardCssSelector* xfdashboard_css_selector_new_from_variant(GVariant *inVariant)
+{
+	XfdashboardCssSelector			*selector;
+	XfdashboardCssSelectorRule		*rule;
+	XfdashboardCssSelectorRule		*childRule;
+	GVariantIter					*iter;
+	gint							priority;
+	const gchar						*type;
+	const gchar						*id;
+	const gchar						*classes;
+	const gchar						*pseudoClasses;
+	guint							parentRuleMode;
+	const gchar						*source;
+	gint							rulePriority;
+	guint							line;
+	guint							position;
+	guint							origLine;
+	guint							origPosition;
+
+	g_return_val_if_fail(inVariant, NULL);
+
+	/* Check that variant is a serialized selector */
+	if(!g_variant_is_of_type(inVariant, G_VARIANT_TYPE(XFDASHBOARD_CSS_SELECTOR_VARIANT_TYPE)))
+	{
+		g_warning(_("Cannot create selector from variant of type '%s'"),
+					g_variant_get_type_string(inVariant));
+		return(NULL);
+	}
+
+	/* Create selector instance */
+	g_variant_get(inVariant, "(ia(msmsmsmsumsiuuuu))", &priority, &iter);
+
+	selector=XFDASHBOARD_CSS_SELECTOR(g_object_new(XFDASHBOARD_TYPE_CSS_SELECTOR,
+													"priority", priority,
+													NULL));
+
+	/* Rebuild chain of rules. The rightmost rule comes first and each following
+	 * one is the parent rule of the rule before.
+	 */
+	childRule=NULL;
+	while(g_variant_iter_next(iter,
+								"(m&sm&sm&sm&sum&siuuuu)",
+								&type,
+								&id,
+								&classes,
+								&pseudoClasses,
+								&parentRuleMode,
+								&source,
+								&rulePriority,
+								&line,
+								&position,
+								&origLine,
+								&origPosition))
+	{
+		rule=_xfdashboard_css_selector_rule_new(source, rulePriority, origLine, origPosition);
+		rule->type=g_strdup(type);
+		rule->id=g_strdup(id);
+		rule->classes=g_strdup(classes);
+		rule->pseudoClasses=g_strdup(pseudoClasses);
+		rule->parentRuleMode=parentRuleMode;
+		rule->line=line;
+		rule->position=position;
+
+		if(!childRule) selector->priv->rule=rule;
+			else childRule->parentRule=rule;
+
+		childRule=rule;
+	}
+	g_variant_iter_free(iter);
+
+	/* A selector without any rule is invalid */
+	if(!selector->priv->rule)
+	{
+		g_warning(_("Cannot create selector from variant without any rule"));
+		g_object_unref(selector);
+		return(NULL);
+	}
+
+	/* Precompile rules for matching */
+	_xfdashboard_css_selector_rule_compile(selector->priv->rule);
+
+	/* Return created selector */
+	return(selector);
+}
+
+/* Get serialized form of selector which can be stored and used to recreate
+ * this selector with xfdashboard_css_selector_new_from_variant().
+ * The returned variant is floating.
+ */
+GVariant* xfdashboard_css_selector_to_variant(XfdashboardCssSelector *self)
+{
+	XfdashboardCssSelectorPrivate	*priv;
+	GVariantBuilder					builder;
+	XfdashboardCssSelectorRule		*rule;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_CSS_SELECTOR(self), NULL);
+
+	priv=self->priv;
+
+	/* Add each rule beginning at rightmost rule to its top-most parent rule */
+	g_variant_builder_init(&builder, G_VARIANT_TYPE("a(msmsmsmsumsiuuuu)"));
+	for(rule=priv->rule; rule; rule=rule->parentRule)
+	{
+		g_variant_builder_add(&builder,
+								"(msmsmsmsumsiuuuu)",
+								rule->type,
+								rule->id,
+								rule->classes,
+								rule->pseudoClasses,
+								(guint)rule->parentRuleMode,
+								rule->source,
+								rule->priority,
+								rule->line,
+								rule->position,
+								rule->origLine,
+								rule->origPosition);
+	}
+
+	/* Return serialized form of selector */
+	return(g_variant_new("(ia(msmsmsmsumsiuuuu))", priv->priority, &builder));
+}
+
 /* Check and score this selector against a stylable node.
  * A score below 0 means that they did not match.
  */
@@ -90,7 +90,10 @@ XfdashboardCssSelector* xfdashboard_css_selector_new_from_scanner_with_priority(
 																				XfdashboardCssSelectorParseFinishCallback inFinishCallback,
 																				gpointer inUserData);
 
+XfdashboardCssSelector* xfdashboard_css_selector_new_from_variant(GVariant *inVariant);
+
 gchar* xfdashboard_css_selector_to_string(XfdashboardCssSelector *self);
+GVariant* xfdashboard_css_selector_to_variant(XfdashboardCssSelector *self);
 
 gint xfdashboard_css_selector_score(XfdashboardCssSelector *self, XfdashboardStylable *inStylable);
 
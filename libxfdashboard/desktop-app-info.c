@@ -68,6 +68,13 @@ struct _XfdashboardDesktopAppInfoPrivate
 
 	gboolean			needKeywords;
 	GList				*keywords;
+
+	gboolean			hasSnapshot;
+	gchar				*snapshotName;
+	gchar				*snapshotComment;
+	gchar				*snapshotIconName;
+	gchar				*snapshotCommand;
+	gboolean			snapshotVisible;
 };
 
 /* Properties */
@@ -96,6 +103,8 @@ enum
 static guint XfdashboardDesktopAppInfoSignals[SIGNAL_LAST]={ 0, };
 
 /* IMPLEMENTATION: Private variables and methods */
+#define XFDASHBOARD_DESKTOP_APP_INFO_VARIANT_TYPE			"(ssmsmsmsmsbasa(smsms))"
+
 typedef struct
 {
 	gchar	*display;
@@ -103,6 +112,125 @@ typedef struct
 	gchar	*desktopFile;
 } XfdashboardDesktopAppInfoChildSetupData;
 
+/* Forward declarations */
+static void _xfdashboard_desktop_app_info_on_item_changed(XfdashboardDesktopAppInfo *self, gpointer inUserData);
+
+/* Release data of desktop app info which was restored from a snapshot */
+static void _xfdashboard_desktop_app_info_clear_snapshot(XfdashboardDesktopAppInfo *self)
+{
+	XfdashboardDesktopAppInfoPrivate		*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(self));
+
+	priv=self->priv;
+
+	if(priv->snapshotName)
+	{
+		g_free(priv->snapshotName);
+		priv->snapshotName=NULL;
+	}
+
+	if(priv->snapshotComment)
+	{
+		g_free(priv->snapshotComment);
+		priv->snapshotComment=NULL;
+	}
+
+	if(priv->snapshotIconName)
+	{
+		g_free(priv->snapshotIconName);
+		priv->snapshotIconName=NULL;
+	}
+
+	if(priv->snapshotCommand)
+	{
+		g_free(priv->snapshotCommand);
+		priv->snapshotCommand=NULL;
+	}
+
+	priv->snapshotVisible=FALSE;
+	priv->hasSnapshot=FALSE;
+}
+
+/* Load menu item of desktop app info which was restored from a snapshot if
+ * not already done. It is only needed if some information is requested which
+ * is not stored in snapshot, e.g. when launching application.
+ */
+static gboolean _xfdashboard_desktop_app_info_ensure_item(XfdashboardDesktopAppInfo *self)
+{
+	XfdashboardDesktopAppInfoPrivate		*priv;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(self), FALSE);
+
+	priv=self->priv;
+
+	if(!priv->item &&
+		priv->hasSnapshot &&
+		priv->file)
+	{
+		priv->item=garcon_menu_item_new(priv->file);
+		if(priv->item)
+		{
+			priv->itemChangedID=g_signal_connect_swapped(priv->item,
+															"changed",
+															G_CALLBACK(_xfdashboard_desktop_app_info_on_item_changed),
+															self);
+		}
+
+		XFDASHBOARD_DEBUG(self, APPLICATIONS,
+							"Loaded menu item on demand for desktop ID '%s' restored from snapshot",
+							priv->desktopID);
+
+		/* Menu item is loaded now so it supersedes the snapshot data */
+		_xfdashboard_desktop_app_info_clear_snapshot(self);
+	}
+
+	return(priv->item!=NULL);
+}
+
+/* Get information either from menu item or, if desktop app info was restored
+ * from a snapshot and menu item was not loaded yet, from snapshot.
+ */
+static const gchar* _xfdashboard_desktop_app_info_get_item_name(XfdashboardDesktopAppInfo *self)
+{
+	XfdashboardDesktopAppInfoPrivate		*priv=self->priv;
+
+	if(priv->item) return(garcon_menu_item_get_name(priv->item));
+	return(priv->snapshotName);
+}
+
+static const gchar* _xfdashboard_desktop_app_info_get_item_comment(XfdashboardDesktopAppInfo *self)
+{
+	XfdashboardDesktopAppInfoPrivate		*priv=self->priv;
+
+	if(priv->item) return(garcon_menu_item_get_comment(priv->item));
+	return(priv->snapshotComment);
+}
+
+static const gchar* _xfdashboard_desktop_app_info_get_item_icon_name(XfdashboardDesktopAppInfo *self)
+{
+	XfdashboardDesktopAppInfoPrivate		*priv=self->priv;
+
+	if(priv->item) return(garcon_menu_item_get_icon_name(priv->item));
+	return(priv->snapshotIconName);
+}
+
+static const gchar* _xfdashboard_desktop_app_info_get_item_command(XfdashboardDesktopAppInfo *self)
+{
+	XfdashboardDesktopAppInfoPrivate		*priv=self->priv;
+
+	if(priv->item) return(garcon_menu_item_get_command(priv->item));
+	return(priv->snapshotCommand);
+}
+
+static gboolean _xfdashboard_desktop_app_info_get_item_visible(XfdashboardDesktopAppInfo *self)
+{
+	XfdashboardDesktopAppInfoPrivate		*priv=self->priv;
+
+	if(priv->item) return(garcon_menu_element_get_visible(GARCON_MENU_ELEMENT(priv->item)));
+	return(priv->hasSnapshot && priv->snapshotVisible);
+}
+
 /* Load secondary source file if not already done.
  * Note: It is called secondary source although it is the same file as used
  * for GarconMenuItem. But it is not the same source because the file is loaded
@@ -188,13 +316,13 @@ static void _xfdashboard_desktop_app_info_update_binary_executable(XfdashboardDe
 		priv->binaryExecutable=NULL;
 	}
 
-	if(priv->item)
+	if(_xfdashboard_desktop_app_info_get_item_command(self))
 	{
 		const gchar						*command;
 		const gchar						*commandStart;
 		const gchar						*commandEnd;
 
-		command=garcon_menu_item_get_command(priv->item);
+		command=_xfdashboard_desktop_app_info_get_item_command(self);
 
 		while(*command==' ') command++;
 		commandStart=command;
@@ -567,7 +695,9 @@ static void _xfdashboard_desktop_app_info_set_file(XfdashboardDesktopAppInfo *se
 		}
 		if(inFile) priv->file=g_object_ref(inFile);
 
-		/* Replace current menu item with new one */
+		/* Replace current menu item with new one and forget about any
+		 * snapshot data as it belongs to the old file.
+		 */
 		if(priv->item)
 		{
 			if(priv->itemChangedID)
@@ -580,6 +710,8 @@ static void _xfdashboard_desktop_app_info_set_file(XfdashboardDesktopAppInfo *se
 			priv->item=NULL;
 		}
 
+		_xfdashboard_desktop_app_info_clear_snapshot(self);
+
 		if(priv->file)
 		{
 			priv->item=garcon_menu_item_new(priv->file);
@@ -902,6 +1034,20 @@ static gboolean _xfdashboard_desktop_app_info_launch_appinfo_internal(Xfdashboar
 	argv=NULL;
 	error=NULL;
 
+	/* Load menu item if desktop app info was restored from a snapshot */
+	if(!_xfdashboard_desktop_app_info_ensure_item(self))
+	{
+		/* Set error */
+		g_set_error(outError,
+						G_IO_ERROR,
+						G_IO_ERROR_FAILED,
+						_("Could not load desktop file for desktop ID '%s'"),
+						priv->desktopID);
+
+		/* Return error state */
+		return(FALSE);
+	}
+
 	/* Get command-line with expanded macros */
 	expanded=g_string_new(NULL);
 	if(!expanded ||
@@ -1169,12 +1315,28 @@ static gboolean _xfdashboard_desktop_app_info_gappinfo_equal(GAppInfo *inLeft, G
 	left=XFDASHBOARD_DESKTOP_APP_INFO(inLeft);
 	right=XFDASHBOARD_DESKTOP_APP_INFO(inRight);
 
-	/* If one of both instance do not have a menu item return FALSE */
-	if(!left->priv->item || !right->priv->item) return(FALSE);
+	/* If both instances have a menu item return result of check if menu item
+	 * of both GAppInfos are equal.
+	 */
+	if(left->priv->item && right->priv->item)
+	{
+		return(garcon_menu_element_equal(GARCON_MENU_ELEMENT(left->priv->item),
+											GARCON_MENU_ELEMENT(right->priv->item)));
+	}
+
+	/* If any instance was restored from a snapshot and has not loaded its menu
+	 * item yet, compare the desktop files like garcon does for menu items.
+	 */
+	if((left->priv->item || left->priv->hasSnapshot) &&
+		(right->priv->item || right->priv->hasSnapshot) &&
+		left->priv->file &&
+		right->priv->file)
+	{
+		return(g_file_equal(left->priv->file, right->priv->file));
+	}
 
-	/* Return result of check if menu item of both GAppInfos are equal */
-	return(garcon_menu_element_equal(GARCON_MENU_ELEMENT(left->priv->item),
-										GARCON_MENU_ELEMENT(right->priv->item)));
+	/* If one of both instance do not have a menu item return FALSE */
+	return(FALSE);
 }
 
 /* Get ID of GAppInfo */
@@ -1196,36 +1358,26 @@ static const gchar* _xfdashboard_desktop_app_info_gappinfo_get_id(GAppInfo *inAp
 static const gchar* _xfdashboard_desktop_app_info_gappinfo_get_name(GAppInfo *inAppInfo)
 {
 	XfdashboardDesktopAppInfo			*self;
-	XfdashboardDesktopAppInfoPrivate	*priv;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo), NULL);
 
 	self=XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
-	priv=self->priv;
-
-	/* If desktop app info has no item return NULL here */
-	if(!priv->item) return(NULL);
 
 	/* Return name of menu item */
-	return(garcon_menu_item_get_name(priv->item));
+	return(_xfdashboard_desktop_app_info_get_item_name(self));
 }
 
 /* Get description of GAppInfo */
 static const gchar* _xfdashboard_desktop_app_info_gappinfo_get_description(GAppInfo *inAppInfo)
 {
 	XfdashboardDesktopAppInfo			*self;
-	XfdashboardDesktopAppInfoPrivate	*priv;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo), NULL);
 
 	self=XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
-	priv=self->priv;
-
-	/* If desktop app info has no item return NULL here */
-	if(!priv->item) return(NULL);
 
 	/* Return comment of menu item as description */
-	return(garcon_menu_item_get_comment(priv->item));
+	return(_xfdashboard_desktop_app_info_get_item_comment(self));
 }
 
 /* Get path to executable binary of GAppInfo */
@@ -1247,32 +1399,27 @@ static const gchar* _xfdashboard_desktop_app_info_gappinfo_get_executable(GAppIn
 static GIcon* _xfdashboard_desktop_app_info_gappinfo_get_icon(GAppInfo *inAppInfo)
 {
 	XfdashboardDesktopAppInfo			*self;
-	XfdashboardDesktopAppInfoPrivate	*priv;
 	GIcon								*icon;
 	const gchar							*iconFilename;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo), NULL);
 
 	self=XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
-	priv=self->priv;
 	icon=NULL;
 
 	/* Create icon from path of menu item */
-	if(priv->item)
+	iconFilename=_xfdashboard_desktop_app_info_get_item_icon_name(self);
+	if(iconFilename)
 	{
-		iconFilename=garcon_menu_item_get_icon_name(priv->item);
-		if(iconFilename)
-		{
-			if(!g_path_is_absolute(iconFilename)) icon=g_themed_icon_new(iconFilename);
-				else
-				{
-					GFile						*file;
+		if(!g_path_is_absolute(iconFilename)) icon=g_themed_icon_new(iconFilename);
+			else
+			{
+				GFile							*file;
 
-					file=g_file_new_for_path(iconFilename);
-					icon=g_file_icon_new(file);
-					g_object_unref(file);
-				}
-		}
+				file=g_file_new_for_path(iconFilename);
+				icon=g_file_icon_new(file);
+				g_object_unref(file);
+			}
 	}
 
 	/* Return icon created */
@@ -1283,27 +1430,22 @@ static GIcon* _xfdashboard_desktop_app_info_gappinfo_get_icon(GAppInfo *inAppInf
 static gboolean _xfdashboard_desktop_app_info_gappinfo_supports_uris(GAppInfo *inAppInfo)
 {
 	XfdashboardDesktopAppInfo			*self;
-	XfdashboardDesktopAppInfoPrivate	*priv;
 	gboolean							result;
 	const gchar							*command;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo), FALSE);
 
 	self=XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
-	priv=self->priv;
 	result=FALSE;
 
 	/* Check if command at menu item contains "%u" or "%U"
 	 * indicating URIs as command-line parameters.
 	 */
-	if(priv->item)
+	command=_xfdashboard_desktop_app_info_get_item_command(self);
+	if(command)
 	{
-		command=garcon_menu_item_get_command(priv->item);
-		if(command)
-		{
-			if(!result && strstr(command, "%u")) result=TRUE;
-			if(!result && strstr(command, "%U")) result=TRUE;
-		}
+		if(!result && strstr(command, "%u")) result=TRUE;
+		if(!result && strstr(command, "%U")) result=TRUE;
 	}
 
 	/* Return result of check */
@@ -1314,27 +1456,22 @@ static gboolean _xfdashboard_desktop_app_info_gappinfo_supports_uris(GAppInfo *i
 static gboolean _xfdashboard_desktop_app_info_gappinfo_supports_files(GAppInfo *inAppInfo)
 {
 	XfdashboardDesktopAppInfo			*self;
-	XfdashboardDesktopAppInfoPrivate	*priv;
 	gboolean							result;
 	const gchar							*command;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo), FALSE);
 
 	self=XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
-	priv=self->priv;
 	result=FALSE;
 
 	/* Check if command at menu item contains "%f" or "%F"
 	 * indicating file paths as command-line parameters.
 	 */
-	if(priv->item)
+	command=_xfdashboard_desktop_app_info_get_item_command(self);
+	if(command)
 	{
-		command=garcon_menu_item_get_command(priv->item);
-		if(command)
-		{
-			if(!result && strstr(command, "%f")) result=TRUE;
-			if(!result && strstr(command, "%F")) result=TRUE;
-		}
+		if(!result && strstr(command, "%f")) result=TRUE;
+		if(!result && strstr(command, "%F")) result=TRUE;
 	}
 
 	/* Return result of check */
@@ -1348,7 +1485,6 @@ static gboolean _xfdashboard_desktop_app_info_gappinfo_launch(GAppInfo *inAppInf
 																GError **outError)
 {
 	XfdashboardDesktopAppInfo			*self;
-	XfdashboardDesktopAppInfoPrivate	*priv;
 	GList								*iter;
 	GList								*uris;
 	gchar								*uri;
@@ -1359,7 +1495,6 @@ static gboolean _xfdashboard_desktop_app_info_gappinfo_launch(GAppInfo *inAppInf
 	g_return_val_if_fail(outError && *outError==NULL, FALSE);
 
 	self=XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
-	priv=self->priv;
 	uris=NULL;
 
 	/* Create list of URIs for files */
@@ -1370,9 +1505,14 @@ static gboolean _xfdashboard_desktop_app_info_gappinfo_launch(GAppInfo *inAppInf
 	}
 	uris=g_list_reverse(uris);
 
+	/* Load menu item if desktop app info was restored from a snapshot before
+	 * command is fetched as it would release the snapshot data.
+	 */
+	_xfdashboard_desktop_app_info_ensure_item(self);
+
 	/* Call function to launch application of XfdashboardDesktopAppInfo with URIs */
 	result=_xfdashboard_desktop_app_info_launch_appinfo_internal(self,
-																	garcon_menu_item_get_command(priv->item),
+																	_xfdashboard_desktop_app_info_get_item_command(self),
 																	uris,
 																	inContext,
 																	outError);
@@ -1391,7 +1531,6 @@ static gboolean _xfdashboard_desktop_app_info_gappinfo_launch_uris(GAppInfo *inA
 																	GError **outError)
 {
 	XfdashboardDesktopAppInfo			*self;
-	XfdashboardDesktopAppInfoPrivate	*priv;
 	gboolean							result;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo), FALSE);
@@ -1399,11 +1538,15 @@ static gboolean _xfdashboard_desktop_app_info_gappinfo_launch_uris(GAppInfo *inA
 	g_return_val_if_fail(outError && *outError==NULL, FALSE);
 
 	self=XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
-	priv=self->priv;
+
+	/* Load menu item if desktop app info was restored from a snapshot before
+	 * command is fetched as it would release the snapshot data.
+	 */
+	_xfdashboard_desktop_app_info_ensure_item(self);
 
 	/* Call function to launch application of XfdashboardDesktopAppInfo with URIs */
 	result=_xfdashboard_desktop_app_info_launch_appinfo_internal(self,
-																	garcon_menu_item_get_command(priv->item),
+																	_xfdashboard_desktop_app_info_get_item_command(self),
 																	inURIs,
 																	inContext,
 																	outError);
@@ -1415,54 +1558,39 @@ static gboolean _xfdashboard_desktop_app_info_gappinfo_launch_uris(GAppInfo *inA
 static gboolean _xfdashboard_desktop_app_info_gappinfo_should_show(GAppInfo *inAppInfo)
 {
 	XfdashboardDesktopAppInfo			*self;
-	XfdashboardDesktopAppInfoPrivate	*priv;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo), FALSE);
 
 	self=XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
-	priv=self->priv;
-
-	/* If desktop app info has no item return FALSE here */
-	if(!priv->item) return(FALSE);
 
 	/* Check if menu item is visible and therefore can be shown */
-	return(garcon_menu_element_get_visible(GARCON_MENU_ELEMENT(priv->item)));
+	return(_xfdashboard_desktop_app_info_get_item_visible(self));
 }
 
 /* Get command-line of GAppInfo with which the application will be started */
 static const gchar* _xfdashboard_desktop_app_info_gappinfo_get_commandline(GAppInfo *inAppInfo)
 {
 	XfdashboardDesktopAppInfo			*self;
-	XfdashboardDesktopAppInfoPrivate	*priv;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo), NULL);
 
 	self=XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
-	priv=self->priv;
-
-	/* If desktop app info has no item return NULL here */
-	if(!priv->item) return(NULL);
 
 	/* Return command of menu item */
-	return(garcon_menu_item_get_command(priv->item));
+	return(_xfdashboard_desktop_app_info_get_item_command(self));
 }
 
 /* Get display name of GAppInfo */
 static const gchar* _xfdashboard_desktop_app_info_gappinfo_get_display_name(GAppInfo *inAppInfo)
 {
 	XfdashboardDesktopAppInfo			*self;
-	XfdashboardDesktopAppInfoPrivate	*priv;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(inAppInfo), NULL);
 
 	self=XFDASHBOARD_DESKTOP_APP_INFO(inAppInfo);
-	priv=self->priv;
-
-	/* If desktop app info has no item return NULL here */
-	if(!priv->item) return(NULL);
 
 	/* Return name of menu item */
-	return(garcon_menu_item_get_name(priv->item));
+	return(_xfdashboard_desktop_app_info_get_item_name(self));
 }
 
 /* Interface initialization
@@ -1515,6 +1643,8 @@ static void _xfdashboard_desktop_app_info_dispose(GObject *inObject)
 		priv->binaryExecutable=NULL;
 	}
 
+	_xfdashboard_desktop_app_info_clear_snapshot(self);
+
 	if(priv->item)
 	{
 		if(priv->itemChangedID)
@@ -1675,6 +1805,12 @@ static void xfdashboard_desktop_app_info_init(XfdashboardDesktopAppInfo *self)
 	priv->needActions=TRUE;
 	priv->keywords=NULL;
 	priv->needKeywords=TRUE;
+	priv->hasSnapshot=FALSE;
+	priv->snapshotName=NULL;
+	priv->snapshotComment=NULL;
+	priv->snapshotIconName=NULL;
+	priv->snapshotCommand=NULL;
+	priv->snapshotVisible=FALSE;
 }
 
 /* IMPLEMENTATION: Public API */
@@ -1780,6 +1916,118 @@ GAppInfo* xfdashboard_desktop_app_info_new_from_menu_item(GarconMenuItem *inMenu
 	return(G_APP_INFO(instance));
 }
 
+/* Create new instance from its serialized form as created by
+ * xfdashboard_desktop_app_info_to_variant(). The desktop file is not loaded
+ * until information is requested which is not stored in serialized form.
+ */
+GAppInfo* xfdashboard_desktop_app_info_new_from_variant(GVariant *inVariant)
+{
+	XfdashboardDesktopAppInfo			*instance;
+	XfdashboardDesktopAppInfoPrivate	*priv;
+	const gchar							*desktopID;
+	const gchar							*path;
+	const gchar							*name;
+	const gchar							*comment;
+	const gchar							*iconName;
+	const gchar							*command;
+	gboolean							visible;
+	GVariant							*keywords;
+	GVariant							*actions;
+	GVariantIter						iter;
+	const gchar							*keyword;
+	const gchar							*actionName;
+	const gchar							*actionIconName;
+	const gchar							*actionCommand;
+	XfdashboardDesktopAppInfoAction		*action;
+
+	g_return_val_if_fail(inVariant, NULL);
+
+	/* Check that variant is a serialized desktop app info */
+	if(!g_variant_is_of_type(inVariant, G_VARIANT_TYPE(XFDASHBOARD_DESKTOP_APP_INFO_VARIANT_TYPE)))
+	{
+		g_warning(_("Cannot create desktop app info from variant of type '%s'"),
+					g_variant_get_type_string(inVariant));
+		return(NULL);
+	}
+
+	g_variant_get(inVariant,
+					"(&s&sm&sm&sm&sm&sb@as@a(smsms))",
+					&desktopID,
+					&path,
+					&name,
+					&comment,
+					&iconName,
+					&command,
+					&visible,
+					&keywords,
+					&actions);
+
+	/* A desktop app info without desktop file cannot be restored */
+	if(!*path)
+	{
+		g_variant_unref(keywords);
+		g_variant_unref(actions);
+		return(NULL);
+	}
+
+	/* Create this class instance but do not use g_object_set to set the file
+	 * to prevent the property setter function _xfdashboard_desktop_app_info_set_file
+	 * to be called which would load the menu item from desktop file.
+	 */
+	instance=XFDASHBOARD_DESKTOP_APP_INFO(g_object_new(XFDASHBOARD_TYPE_DESKTOP_APP_INFO,
+														"desktop-id", *desktopID ? desktopID : NULL,
+														NULL));
+	priv=instance->priv;
+
+	priv->file=g_file_new_for_path(path);
+
+	priv->hasSnapshot=TRUE;
+	priv->snapshotName=g_strdup(name);
+	priv->snapshotComment=g_strdup(comment);
+	priv->snapshotIconName=g_strdup(iconName);
+	priv->snapshotCommand=g_strdup(command);
+	priv->snapshotVisible=visible;
+
+	/* Restore keywords and application actions */
+	g_variant_iter_init(&iter, keywords);
+	while(g_variant_iter_next(&iter, "&s", &keyword))
+	{
+		priv->keywords=g_list_prepend(priv->keywords, g_strdup(keyword));
+	}
+	priv->keywords=g_list_reverse(priv->keywords);
+	priv->needKeywords=FALSE;
+
+	g_variant_iter_init(&iter, actions);
+	while(g_variant_iter_next(&iter, "(&sm&sm&s)", &actionName, &actionIconName, &actionCommand))
+	{
+		action=XFDASHBOARD_DESKTOP_APP_INFO_ACTION
+				(
+					g_object_new(XFDASHBOARD_TYPE_DESKTOP_APP_INFO_ACTION,
+									"name", actionName,
+									"icon-name", actionIconName,
+									"command", actionCommand,
+									NULL)
+				);
+		priv->actions=g_list_prepend(priv->actions, action);
+	}
+	priv->actions=g_list_reverse(priv->actions);
+	priv->needActions=FALSE;
+
+	/* Get path to executable file for this application */
+	_xfdashboard_desktop_app_info_update_binary_executable(instance);
+
+	/* Desktop app info was valid when it was serialized and it is inited now */
+	priv->inited=TRUE;
+	priv->isValid=TRUE;
+
+	/* Release allocated resources */
+	g_variant_unref(keywords);
+	g_variant_unref(actions);
+
+	/* Return created instance */
+	return(G_APP_INFO(instance));
+}
+
 /* Determine if desktop app info is valid */
 gboolean xfdashboard_desktop_app_info_is_valid(XfdashboardDesktopAppInfo *self)
 {
@@ -1816,6 +2064,9 @@ gboolean xfdashboard_desktop_app_info_reload(XfdashboardDesktopAppInfo *self)
 		priv->secondarySource=NULL;
 	}
 
+	/* Load menu item if desktop app info was restored from a snapshot */
+	_xfdashboard_desktop_app_info_ensure_item(self);
+
 	/* Reload menu item */
 	if(priv->item)
 	{
@@ -1975,3 +2226,245 @@ GList* xfdashboard_desktop_app_info_get_keywords(XfdashboardDesktopAppInfo *self
 	/* Return the list of keywords */
 	return(self->priv->keywords);
 }
+
+/* Parse desktop file into the serialized form of a desktop app info as created
+ * by xfdashboard_desktop_app_info_to_variant() without loading a menu item.
+ * The rules to determine if desktop file is valid and if application is visible
+ * follow the ones of garcon. This function does not create any object and is
+ * safe to be called from any thread. The returned variant is floating.
+ */
+GVariant* xfdashboard_desktop_app_info_parse_file(const gchar *inDesktopID,
+													const gchar *inPath,
+													GError **outError)
+{
+	GKeyFile							*keyfile;
+	gchar								*name;
+	gchar								*comment;
+	gchar								*iconName;
+	gchar								*command;
+	gboolean							visible;
+	const gchar							*environment;
+	gchar								**strings;
+	gchar								**iter;
+	GVariantBuilder						keywordsBuilder;
+	GVariantBuilder						actionsBuilder;
+	GVariant							*variant;
+	GError								*error;
+
+	g_return_val_if_fail(inPath && *inPath, NULL);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, NULL);
+
+	error=NULL;
+
+	/* Load desktop file */
+	keyfile=g_key_file_new();
+	if(!g_key_file_load_from_file(keyfile, inPath, G_KEY_FILE_NONE, &error))
+	{
+		/* Propagate error */
+		g_propagate_error(outError, error);
+
+		/* Release allocated resources */
+		g_key_file_unref(keyfile);
+
+		return(NULL);
+	}
+
+	/* Desktop file is only valid if it has a name and a command to execute */
+	name=g_key_file_get_locale_string(keyfile, G_KEY_FILE_DESKTOP_GROUP, G_KEY_FILE_DESKTOP_KEY_NAME, NULL, NULL);
+	command=g_key_file_get_string(keyfile, G_KEY_FILE_DESKTOP_GROUP, G_KEY_FILE_DESKTOP_KEY_EXEC, NULL);
+	if(!name ||
+		!command ||
+		!g_utf8_validate(name, -1, NULL))
+	{
+		/* Set error */
+		g_set_error(outError,
+						G_IO_ERROR,
+						G_IO_ERROR_INVALID_DATA,
+						_("Desktop file %s for desktop ID '%s' is not a valid application"),
+						inPath,
+						inDesktopID);
+
+		/* Release allocated resources */
+		if(name) g_free(name);
+		if(command) g_free(command);
+		g_key_file_unref(keyfile);
+
+		return(NULL);
+	}
+
+	comment=g_key_file_get_locale_string(keyfile, G_KEY_FILE_DESKTOP_GROUP, G_KEY_FILE_DESKTOP_KEY_COMMENT, NULL, NULL);
+	iconName=g_key_file_get_locale_string(keyfile, G_KEY_FILE_DESKTOP_GROUP, G_KEY_FILE_DESKTOP_KEY_ICON, NULL, NULL);
+
+	/* Determine visibility by "Hidden", "NoDisplay", "OnlyShowIn", "NotShowIn"
+	 * and "TryExec" keys. "Hidden" is used to delete a desktop file of system,
+	 * e.g. by a desktop file with same desktop ID in user's data directory.
+	 */
+	visible=!g_key_file_get_boolean(keyfile, G_KEY_FILE_DESKTOP_GROUP, G_KEY_FILE_DESKTOP_KEY_HIDDEN, NULL) &&
+			!g_key_file_get_boolean(keyfile, G_KEY_FILE_DESKTOP_GROUP, G_KEY_FILE_DESKTOP_KEY_NO_DISPLAY, NULL);
+
+	environment=garcon_get_environment();
+	if(visible && environment)
+	{
+		strings=g_key_file_get_string_list(keyfile, G_KEY_FILE_DESKTOP_GROUP, G_KEY_FILE_DESKTOP_KEY_ONLY_SHOW_IN, NULL, NULL);
+		if(strings)
+		{
+			visible=g_strv_contains((const gchar * const *)strings, environment);
+			g_strfreev(strings);
+		}
+			else
+			{
+				strings=g_key_file_get_string_list(keyfile, G_KEY_FILE_DESKTOP_GROUP, G_KEY_FILE_DESKTOP_KEY_NOT_SHOW_IN, NULL, NULL);
+				if(strings)
+				{
+					visible=!g_strv_contains((const gchar * const *)strings, environment);
+					g_strfreev(strings);
+				}
+			}
+	}
+
+	if(visible)
+	{
+		gchar							*tryExec;
+		gchar							*program;
+
+		tryExec=g_key_file_get_string(keyfile, G_KEY_FILE_DESKTOP_GROUP, G_KEY_FILE_DESKTOP_KEY_TRY_EXEC, NULL);
+		if(tryExec &&
+			g_shell_parse_argv(tryExec, NULL, &strings, NULL))
+		{
+			program=g_find_program_in_path(strings[0]);
+			visible=(program!=NULL);
+
+			if(program) g_free(program);
+			g_strfreev(strings);
+		}
+		if(tryExec) g_free(tryExec);
+	}
+
+	/* Get keywords */
+	g_variant_builder_init(&keywordsBuilder, G_VARIANT_TYPE("as"));
+
+	strings=g_key_file_get_string_list(keyfile, G_KEY_FILE_DESKTOP_GROUP, "Keywords", NULL, NULL);
+	if(strings)
+	{
+		for(iter=strings; *iter; iter++)
+		{
+			g_variant_builder_add(&keywordsBuilder, "s", *iter);
+		}
+		g_strfreev(strings);
+	}
+
+	/* Get application actions in order of "Actions" key but skip actions
+	 * without name as it is the only required key of an action.
+	 */
+	g_variant_builder_init(&actionsBuilder, G_VARIANT_TYPE("a(smsms)"));
+
+	strings=g_key_file_get_string_list(keyfile, G_KEY_FILE_DESKTOP_GROUP, G_KEY_FILE_DESKTOP_KEY_ACTIONS, NULL, NULL);
+	if(strings)
+	{
+		for(iter=strings; *iter; iter++)
+		{
+			gchar						*actionGroup;
+			gchar						*actionName;
+			gchar						*actionIconName;
+			gchar						*actionCommand;
+
+			actionGroup=g_strdup_printf("Desktop Action %s", *iter);
+
+			actionName=g_key_file_get_locale_string(keyfile, actionGroup, G_KEY_FILE_DESKTOP_KEY_NAME, NULL, NULL);
+			if(actionName)
+			{
+				actionIconName=g_key_file_get_string(keyfile, actionGroup, G_KEY_FILE_DESKTOP_KEY_ICON, NULL);
+				actionCommand=g_key_file_get_string(keyfile, actionGroup, G_KEY_FILE_DESKTOP_KEY_EXEC, NULL);
+
+				g_variant_builder_add(&actionsBuilder, "(smsms)", actionName, actionIconName, actionCommand);
+
+				if(actionCommand) g_free(actionCommand);
+				if(actionIconName) g_free(actionIconName);
+				g_free(actionName);
+			}
+
+			g_free(actionGroup);
+		}
+		g_strfreev(strings);
+	}
+
+	/* Build serialized form of desktop app info */
+	variant=g_variant_new(XFDASHBOARD_DESKTOP_APP_INFO_VARIANT_TYPE,
+							inDesktopID ? inDesktopID : "",
+							inPath,
+							name,
+							comment,
+							iconName,
+							command,
+							visible,
+							&keywordsBuilder,
+							&actionsBuilder);
+
+	/* Release allocated resources */
+	if(iconName) g_free(iconName);
+	if(comment) g_free(comment);
+	g_free(command);
+	g_free(name);
+	g_key_file_unref(keyfile);
+
+	/* Return serialized form */
+	return(variant);
+}
+
+/* Get serialized form of desktop app info containing all information needed
+ * to show and search this application without loading its desktop file. It
+ * can be used to recreate this desktop app info with
+ * xfdashboard_desktop_app_info_new_from_variant(). The returned variant is floating.
+ */
+GVariant* xfdashboard_desktop_app_info_to_variant(XfdashboardDesktopAppInfo *self)
+{
+	XfdashboardDesktopAppInfoPrivate	*priv;
+	GVariantBuilder						keywordsBuilder;
+	GVariantBuilder						actionsBuilder;
+	GList								*iter;
+	XfdashboardDesktopAppInfoAction		*action;
+	gchar								*path;
+	GVariant							*variant;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_DESKTOP_APP_INFO(self), NULL);
+
+	priv=self->priv;
+
+	/* Update list of keywords and application actions */
+	_xfdashboard_desktop_app_info_update_keywords(self);
+	_xfdashboard_desktop_app_info_update_actions(self);
+
+	/* Build serialized form of desktop app info */
+	g_variant_builder_init(&keywordsBuilder, G_VARIANT_TYPE("as"));
+	for(iter=priv->keywords; iter; iter=g_list_next(iter))
+	{
+		g_variant_builder_add(&keywordsBuilder, "s", (const gchar*)iter->data);
+	}
+
+	g_variant_builder_init(&actionsBuilder, G_VARIANT_TYPE("a(smsms)"));
+	for(iter=priv->actions; iter; iter=g_list_next(iter))
+	{
+		action=XFDASHBOARD_DESKTOP_APP_INFO_ACTION(iter->data);
+		g_variant_builder_add(&actionsBuilder,
+								"(smsms)",
+								xfdashboard_desktop_app_info_action_get_name(action),
+								xfdashboard_desktop_app_info_action_get_icon_name(action),
+								xfdashboard_desktop_app_info_action_get_command(action));
+	}
+
+	path=priv->file ? g_file_get_path(priv->file) : NULL;
+	variant=g_variant_new(XFDASHBOARD_DESKTOP_APP_INFO_VARIANT_TYPE,
+							priv->desktopID ? priv->desktopID : "",
+							path ? path : "",
+							_xfdashboard_desktop_app_info_get_item_name(self),
+							_xfdashboard_desktop_app_info_get_item_comment(self),
+							_xfdashboard_desktop_app_info_get_item_icon_name(self),
+							_xfdashboard_desktop_app_info_get_item_command(self),
+							_xfdashboard_desktop_app_info_get_item_visible(self),
+							&keywordsBuilder,
+							&actionsBuilder);
+	if(path) g_free(path);
+
+	/* Return serialized form */
+	return(variant);
+}
@@ -73,6 +73,7 @@ GAppInfo* xfdashboard_desktop_app_info_new_from_desktop_id(const gchar *inDeskto
 GAppInfo* xfdashboard_desktop_app_info_new_from_path(const gchar *inPath);
 GAppInfo* xfdashboard_desktop_app_info_new_from_file(GFile *inFile);
 GAppInfo* xfdashboard_desktop_app_info_new_from_menu_item(GarconMenuItem *inMenuItem);
+GAppInfo* xfdashboard_desktop_app_info_new_from_variant(GVariant *inVariant);
 
 gboolean xfdashboard_desktop_app_info_is_valid(XfdashboardDesktopAppInfo *self);
 
@@ -91,6 +92,11 @@ gboolean xfdashboard_desktop_app_info_launch_action_by_name(XfdashboardDesktopAp
 
 GList* xfdashboard_desktop_app_info_get_keywords(XfdashboardDesktopAppInfo *self);
 
+GVariant* xfdashboard_desktop_app_info_parse_file(const gchar *inDesktopID,
+													const gchar *inPath,
+													GError **outError);
+GVariant* xfdashboard_desktop_app_info_to_variant(XfdashboardDesktopAppInfo *self);
+
 G_END_DECLS
 
 #endif	/* __LIBXFDASHBOARD_DESKTOP_APP_INFO__ */
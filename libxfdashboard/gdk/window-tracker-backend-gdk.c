@@ -395,7 +395,6 @@ static XfdashboardWindowTrackerWindow* _xfdashboard_window_tracker_backend_gdk_w
 	XfdashboardWindowTrackerBackendGDKPrivate	*priv;
 	GdkWindow									*stageGdkWindow;
 	Window										stageXWindow;
-	WnckWindow									*wnckWindow;
 	XfdashboardWindowTrackerWindow				*window;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_BACKEND_GDK(inBackend), NULL);
@@ -404,18 +403,17 @@ static XfdashboardWindowTrackerWindow* _xfdashboard_window_tracker_backend_gdk_w
 	self=XFDASHBOARD_WINDOW_TRACKER_BACKEND_GDK(inBackend);
 	priv=self->priv;
 
-	/* Get stage window and translate to needed window type */
+	/* Get stage window */
 	stageGdkWindow=clutter_gdk_get_stage_window(inStage);
 	stageXWindow=gdk_x11_window_get_xid(stageGdkWindow);
-	wnckWindow=wnck_window_get(stageXWindow);
 
-	/* Get or create window object for wnck background window */
-	window=xfdashboard_window_tracker_x11_get_window_for_wnck(priv->windowTracker, wnckWindow);
+	/* Look up window object for stage X window */
+	window=xfdashboard_window_tracker_x11_get_window_for_xid(priv->windowTracker, stageXWindow);
 	XFDASHBOARD_DEBUG(self, WINDOWS,
-						"Resolved stage wnck window %s@%p of stage %s@%p to window object %s@%p",
-						G_OBJECT_TYPE_NAME(wnckWindow), wnckWindow,
+						"Resolved stage X window %lu of stage %s@%p to window object %s@%p",
+						(gulong)stageXWindow,
 						G_OBJECT_TYPE_NAME(inStage), inStage,
-						G_OBJECT_TYPE_NAME(window), window);
+						window ? G_OBJECT_TYPE_NAME(window) : "<nil>", window);
 
 	return(window);
 }
@@ -0,0 +1,394 @@
+/*
+ * image-downscale: Fast box filter to downscale 32-bit images
+ * 
+ * Copyright 2012-2017 Stephan Haller <nomad@froevel.de>
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ * 
+ * 
+ */
+
+/* Images are downscaled by halving them with a 2x2 box filter as long as
+ * the halved image is still at least as large as the requested size, followed
+ * by a final box filter pass to the requested size. Halving is done with
+ * AVX2 (if supported by CPU at runtime), SSE2 or NEON instructions if they
+ * are available. All pixels are expected to be 32 bits wide and channels
+ * are filtered independently of their order.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <libxfdashboard/image-downscale.h>
+
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define XFDASHBOARD_IMAGE_DOWNSCALE_HAVE_AVX2	1
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+#include <libxfdashboard/debug.h>
+
+
+/* IMPLEMENTATION: Private variables and methods */
+typedef void (*XfdashboardImageDownscaleHalveRowFunc)(const guint8 *inRow0,
+														const guint8 *inRow1,
+														guint8 *outRow,
+														gint inWidth);
+
+static XfdashboardImageDownscaleHalveRowFunc	_xfdashboard_image_downscale_halve_row=NULL;
+
+/* Average 2x2 pixels for each pixel in the remaining pixels of a row */
+static void _xfdashboard_image_downscale_halve_row_c(const guint8 *inRow0,
+														const guint8 *inRow1,
+														guint8 *outRow,
+														gint inWidth)
+{
+	gint								x;
+	gint								channel;
+
+	for(x=0; x<inWidth; x++)
+	{
+		for(channel=0; channel<4; channel++)
+		{
+			outRow[channel]=(inRow0[channel]+inRow0[channel+4]+inRow1[channel]+inRow1[channel+4]+2)>>2;
+		}
+
+		inRow0+=8;
+		inRow1+=8;
+		outRow+=4;
+	}
+}
+
+#if defined(__SSE2__)
+/* Separate eight pixels into even and odd pixels with SSE2 instructions */
+static void _xfdashboard_image_downscale_split_sse2(const guint8 *inRow, __m128i *outEven, __m128i *outOdd)
+{
+	__m128i								a, b;
+
+	a=_mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)inRow), _MM_SHUFFLE(3, 1, 2, 0));
+	b=_mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)(inRow+16)), _MM_SHUFFLE(3, 1, 2, 0));
+	*outEven=_mm_unpacklo_epi64(a, b);
+	*outOdd=_mm_unpackhi_epi64(a, b);
+}
+
+/* Average 2x2 pixels for each pixel of a row with SSE2 instructions, four pixels at once.
+ * Channels are summed up in 16 bits to round exactly like the C implementation.
+ */
+static void _xfdashboard_image_downscale_halve_row_sse2(const guint8 *inRow0,
+														const guint8 *inRow1,
+														guint8 *outRow,
+														gint inWidth)
+{
+	__m128i								even0, odd0, even1, odd1;
+	__m128i								low, high;
+	__m128i								zero, round;
+	gint								x;
+
+	zero=_mm_setzero_si128();
+	round=_mm_set1_epi16(2);
+
+	for(x=0; x+4<=inWidth; x+=4)
+	{
+		/* Separate even and odd pixels of both rows */
+		_xfdashboard_image_downscale_split_sse2(inRow0, &even0, &odd0);
+		_xfdashboard_image_downscale_split_sse2(inRow1, &even1, &odd1);
+
+		/* Sum up 2x2 pixels, round and divide by four */
+		low=_mm_add_epi16(_mm_add_epi16(_mm_unpacklo_epi8(even0, zero), _mm_unpacklo_epi8(odd0, zero)),
+							_mm_add_epi16(_mm_unpacklo_epi8(even1, zero), _mm_unpacklo_epi8(odd1, zero)));
+		high=_mm_add_epi16(_mm_add_epi16(_mm_unpackhi_epi8(even0, zero), _mm_unpackhi_epi8(odd0, zero)),
+							_mm_add_epi16(_mm_unpackhi_epi8(even1, zero), _mm_unpackhi_epi8(odd1, zero)));
+		low=_mm_srli_epi16(_mm_add_epi16(low, round), 2);
+		high=_mm_srli_epi16(_mm_add_epi16(high, round), 2);
+		_mm_storeu_si128((__m128i*)outRow, _mm_packus_epi16(low, high));
+
+		inRow0+=32;
+		inRow1+=32;
+		outRow+=16;
+	}
+
+	/* Handle remaining pixels */
+	_xfdashboard_image_downscale_halve_row_c(inRow0, inRow1, outRow, inWidth-x);
+}
+#endif
+
+#ifdef XFDASHBOARD_IMAGE_DOWNSCALE_HAVE_AVX2
+/* Separate sixteen pixels into even and odd pixels with AVX2 instructions.
+ * Even and odd pixels are separated in each lane and gathered across lanes.
+ */
+__attribute__((target("avx2")))
+static void _xfdashboard_image_downscale_split_avx2(const guint8 *inRow, __m256i *outEven, __m256i *outOdd)
+{
+	__m256i								a, b;
+
+	a=_mm256_shuffle_epi32(_mm256_loadu_si256((const __m256i*)inRow), _MM_SHUFFLE(3, 1, 2, 0));
+	b=_mm256_shuffle_epi32(_mm256_loadu_si256((const __m256i*)(inRow+32)), _MM_SHUFFLE(3, 1, 2, 0));
+	*outEven=_mm256_permute4x64_epi64(_mm256_unpacklo_epi64(a, b), _MM_SHUFFLE(3, 1, 2, 0));
+	*outOdd=_mm256_permute4x64_epi64(_mm256_unpackhi_epi64(a, b), _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+/* Average 2x2 pixels for each pixel of a row with AVX2 instructions, eight pixels at once.
+ * Channels are summed up in 16 bits to round exactly like the C implementation.
+ */
+__attribute__((target("avx2")))
+static void _xfdashboard_image_downscale_halve_row_avx2(const guint8 *inRow0,
+														const guint8 *inRow1,
+														guint8 *outRow,
+														gint inWidth)
+{
+	__m256i								even0, odd0, even1, odd1;
+	__m256i								low, high;
+	__m256i								zero, round;
+	gint								x;
+
+	zero=_mm256_setzero_si256();
+	round=_mm256_set1_epi16(2);
+
+	for(x=0; x+8<=inWidth; x+=8)
+	{
+		/* Separate even and odd pixels of both rows */
+		_xfdashboard_image_downscale_split_avx2(inRow0, &even0, &odd0);
+		_xfdashboard_image_downscale_split_avx2(inRow1, &even1, &odd1);
+
+		/* Sum up 2x2 pixels, round and divide by four. Unpacking and packing
+		 * both work in each lane, so order of pixels is kept.
+		 */
+		low=_mm256_add_epi16(_mm256_add_epi16(_mm256_unpacklo_epi8(even0, zero), _mm256_unpacklo_epi8(odd0, zero)),
+								_mm256_add_epi16(_mm256_unpacklo_epi8(even1, zero), _mm256_unpacklo_epi8(odd1, zero)));
+		high=_mm256_add_epi16(_mm256_add_epi16(_mm256_unpackhi_epi8(even0, zero), _mm256_unpackhi_epi8(odd0, zero)),
+								_mm256_add_epi16(_mm256_unpackhi_epi8(even1, zero), _mm256_unpackhi_epi8(odd1, zero)));
+		low=_mm256_srli_epi16(_mm256_add_epi16(low, round), 2);
+		high=_mm256_srli_epi16(_mm256_add_epi16(high, round), 2);
+		_mm256_storeu_si256((__m256i*)outRow, _mm256_packus_epi16(low, high));
+
+		inRow0+=64;
+		inRow1+=64;
+		outRow+=32;
+	}
+
+	/* Handle remaining pixels */
+	_xfdashboard_image_downscale_halve_row_c(inRow0, inRow1, outRow, inWidth-x);
+}
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+/* Average 2x2 pixels for each pixel of a row with NEON instructions, four pixels at once.
+ * Channels are summed up in 16 bits to round exactly like the C implementation.
+ */
+static void _xfdashboard_image_downscale_halve_row_neon(const guint8 *inRow0,
+														const guint8 *inRow1,
+														guint8 *outRow,
+														gint inWidth)
+{
+	uint32x4x2_t						row0, row1;
+	uint8x16_t							even0, odd0, even1, odd1;
+	uint16x8_t							low, high;
+	gint								x;
+
+	for(x=0; x+4<=inWidth; x+=4)
+	{
+		/* Load eight pixels of each row separated into even and odd pixels */
+		row0=vld2q_u32((const uint32_t*)inRow0);
+		row1=vld2q_u32((const uint32_t*)inRow1);
+
+		even0=vreinterpretq_u8_u32(row0.val[0]);
+		odd0=vreinterpretq_u8_u32(row0.val[1]);
+		even1=vreinterpretq_u8_u32(row1.val[0]);
+		odd1=vreinterpretq_u8_u32(row1.val[1]);
+
+		/* Sum up 2x2 pixels, then round and divide by four while narrowing */
+		low=vaddq_u16(vaddl_u8(vget_low_u8(even0), vget_low_u8(odd0)),
+						vaddl_u8(vget_low_u8(even1), vget_low_u8(odd1)));
+		high=vaddq_u16(vaddl_u8(vget_high_u8(even0), vget_high_u8(odd0)),
+						vaddl_u8(vget_high_u8(even1), vget_high_u8(odd1)));
+		vst1q_u8(outRow, vcombine_u8(vrshrn_n_u16(low, 2), vrshrn_n_u16(high, 2)));
+
+		inRow0+=32;
+		inRow1+=32;
+		outRow+=16;
+	}
+
+	/* Handle remaining pixels */
+	_xfdashboard_image_downscale_halve_row_c(inRow0, inRow1, outRow, inWidth-x);
+}
+#endif
+
+/* Select fastest implementation to halve rows supported by CPU */
+static XfdashboardImageDownscaleHalveRowFunc _xfdashboard_image_downscale_get_halve_row_func(void)
+{
+	if(G_UNLIKELY(!_xfdashboard_image_downscale_halve_row))
+	{
+		_xfdashboard_image_downscale_halve_row=_xfdashboard_image_downscale_halve_row_c;
+
+#if defined(__SSE2__)
+		_xfdashboard_image_downscale_halve_row=_xfdashboard_image_downscale_halve_row_sse2;
+#endif
+
+#ifdef XFDASHBOARD_IMAGE_DOWNSCALE_HAVE_AVX2
+		__builtin_cpu_init();
+		if(__builtin_cpu_supports("avx2"))
+		{
+			_xfdashboard_image_downscale_halve_row=_xfdashboard_image_downscale_halve_row_avx2;
+		}
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+		_xfdashboard_image_downscale_halve_row=_xfdashboard_image_downscale_halve_row_neon;
+#endif
+	}
+
+	return(_xfdashboard_image_downscale_halve_row);
+}
+
+/* Halve image with a 2x2 box filter. Destination may be the same as source. */
+static void _xfdashboard_image_downscale_halve(const guint8 *inSource,
+												gint inSourceWidth,
+												gint inSourceHeight,
+												gint inSourceStride,
+												guint8 *outDestination,
+												gint inDestinationStride)
+{
+	XfdashboardImageDownscaleHalveRowFunc	halveRow;
+	gint									y;
+
+	halveRow=_xfdashboard_image_downscale_get_halve_row_func();
+	for(y=0; y<inSourceHeight/2; y++)
+	{
+		halveRow(inSource+((2*y)*inSourceStride),
+					inSource+((2*y+1)*inSourceStride),
+					outDestination+(y*inDestinationStride),
+					inSourceWidth/2);
+	}
+}
+
+/* Downscale image with a box filter to any size not larger than source image */
+static void _xfdashboard_image_downscale_box(const guint8 *inSource,
+												gint inSourceWidth,
+												gint inSourceHeight,
+												gint inSourceStride,
+												guint8 *outDestination,
+												gint inDestinationWidth,
+												gint inDestinationHeight,
+												gint inDestinationStride)
+{
+	gint									x, y;
+	gint									sx, sy;
+	gint									x1, x2, y1, y2;
+	gint									channel;
+	guint									sum[4];
+	guint									count;
+	const guint8							*pixel;
+	guint8									*target;
+
+	for(y=0; y<inDestinationHeight; y++)
+	{
+		y1=(y*inSourceHeight)/inDestinationHeight;
+		y2=MAX(y1+1, ((y+1)*inSourceHeight)/inDestinationHeight);
+
+		target=outDestination+(y*inDestinationStride);
+		for(x=0; x<inDestinationWidth; x++)
+		{
+			x1=(x*inSourceWidth)/inDestinationWidth;
+			x2=MAX(x1+1, ((x+1)*inSourceWidth)/inDestinationWidth);
+
+			/* Sum up all source pixels covered by destination pixel */
+			sum[0]=sum[1]=sum[2]=sum[3]=0;
+			for(sy=y1; sy<y2; sy++)
+			{
+				pixel=inSource+(sy*inSourceStride)+(x1*4);
+				for(sx=x1; sx<x2; sx++)
+				{
+					for(channel=0; channel<4; channel++) sum[channel]+=pixel[channel];
+					pixel+=4;
+				}
+			}
+
+			/* Set average as destination pixel */
+			count=(y2-y1)*(x2-x1);
+			for(channel=0; channel<4; channel++) target[channel]=(sum[channel]+(count/2))/count;
+			target+=4;
+		}
+	}
+}
+
+
+/* IMPLEMENTATION: Internal API */
+
+/* Downscale 32-bit image to requested size which must not be larger than the
+ * source image. Returns FALSE if image could not be downscaled.
+ */
+gboolean xfdashboard_image_downscale(const guint8 *inSource,
+										gint inSourceWidth,
+										gint inSourceHeight,
+										gint inSourceStride,
+										guint8 *outDestination,
+										gint inDestinationWidth,
+										gint inDestinationHeight,
+										gint inDestinationStride)
+{
+	guint8									*buffer;
+	gint									bufferStride;
+	gint									width;
+	gint									height;
+
+	g_return_val_if_fail(inSource, FALSE);
+	g_return_val_if_fail(outDestination, FALSE);
+	g_return_val_if_fail(inDestinationWidth>0 && inDestinationWidth<=inSourceWidth, FALSE);
+	g_return_val_if_fail(inDestinationHeight>0 && inDestinationHeight<=inSourceHeight, FALSE);
+
+	/* If image does not need to be halved at least once, downscale it directly */
+	if((inSourceWidth/2)<inDestinationWidth || (inSourceHeight/2)<inDestinationHeight)
+	{
+		_xfdashboard_image_downscale_box(inSource, inSourceWidth, inSourceHeight, inSourceStride,
+											outDestination, inDestinationWidth, inDestinationHeight, inDestinationStride);
+		return(TRUE);
+	}
+
+	/* Halve image into work buffer and keep halving it in place as long as
+	 * it does not get smaller than requested size.
+	 */
+	width=inSourceWidth/2;
+	height=inSourceHeight/2;
+	bufferStride=width*4;
+	buffer=g_try_malloc(bufferStride*height);
+	if(!buffer) return(FALSE);
+
+	_xfdashboard_image_downscale_halve(inSource, inSourceWidth, inSourceHeight, inSourceStride, buffer, bufferStride);
+	while((width/2)>=inDestinationWidth && (height/2)>=inDestinationHeight)
+	{
+		_xfdashboard_image_downscale_halve(buffer, width, height, bufferStride, buffer, bufferStride);
+		width/=2;
+		height/=2;
+	}
+
+	/* Downscale halved image to requested size */
+	_xfdashboard_image_downscale_box(buffer, width, height, bufferStride,
+										outDestination, inDestinationWidth, inDestinationHeight, inDestinationStride);
+
+	/* Release allocated resources */
+	g_free(buffer);
+
+	return(TRUE);
+}
@@ -0,0 +1,47 @@
+/*
+ * image-downscale: Fast box filter to downscale 32-bit images
+ * 
+ * Copyright 2012-2017 Stephan Haller <nomad@froevel.de>
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+ * MA 02110-1301, USA.
+ * 
+ * 
+ */
+
+#ifndef __LIBXFDASHBOARD_IMAGE_DOWNSCALE__
+#define __LIBXFDASHBOARD_IMAGE_DOWNSCALE__
+
+#if !defined(LIBXFDASHBOARD_COMPILATION)
+#error "This header is private to libxfdashboard and must not be included outside of it."
+#endif
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+G_GNUC_INTERNAL
+gboolean xfdashboard_image_downscale(const guint8 *inSource,
+										gint inSourceWidth,
+										gint inSourceHeight,
+										gint inSourceStride,
+										guint8 *outDestination,
+										gint inDestinationWidth,
+										gint inDestinationHeight,
+										gint inDestinationStride);
+
+G_END_DECLS
+
+#endif	/* __LIBXFDASHBOARD_IMAGE_DOWNSCALE__ */
@@ -28,6 +28,7 @@
 
 #include <libxfdashboard/action-button.h>
 #include <libxfdashboard/actor.h>
+#include <libxfdashboard/actor-pool.h>
 #include <libxfdashboard/application-button.h>
 #include <libxfdashboard/application-database.h>
 #include <libxfdashboard/application.h>
@@ -66,6 +66,8 @@ struct _XfdashboardLiveWorkspacePrivate
 	ClutterActor							*backgroundImageLayer;
 	ClutterActor							*actorTitle;
 	ClutterAction							*clickAction;
+
+	gboolean								isWindowsUpdate;
 };
 
 /* Properties */
@@ -301,9 +303,12 @@ static ClutterActor* _xfdashboard_live_workspace_create_and_add_window_actor(Xfd
 	 * will be on top of all other windows. We need to respect window stacking.
 	 * Therefore we iterate through list of windows in reversed stacking order
 	 * and find the last window we have an actor for before we the window requested.
+	 * While window tracker reports a batch of opened windows skip this lookup
+	 * as all window actors will be restacked once when the batch ends.
 	 */
 	lastWindowActor=NULL;
-	windows=xfdashboard_window_tracker_get_windows_stacked(priv->windowTracker);
+	windows=NULL;
+	if(!priv->isWindowsUpdate) windows=xfdashboard_window_tracker_get_windows_stacked(priv->windowTracker);
 	for(windows=g_list_last(windows) ; windows; windows=g_list_previous(windows))
 	{
 		/* Get window from list */
@@ -479,6 +484,31 @@ static void _xfdashboard_live_workspace_on_window_stacking_changed(XfdashboardLi
 	}
 }
 
+/* A batch of opened windows begins */
+static void _xfdashboard_live_workspace_on_windows_update_begin(XfdashboardLiveWorkspace *self,
+																gpointer inUserData)
+{
+	g_return_if_fail(XFDASHBOARD_IS_LIVE_WORKSPACE(self));
+
+	self->priv->isWindowsUpdate=TRUE;
+}
+
+/* A batch of opened windows ended so restack all window actors once */
+static void _xfdashboard_live_workspace_on_windows_update_end(XfdashboardLiveWorkspace *self,
+																gpointer inUserData)
+{
+	XfdashboardLiveWorkspacePrivate		*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_LIVE_WORKSPACE(self));
+
+	priv=self->priv;
+
+	if(!priv->isWindowsUpdate) return;
+
+	priv->isWindowsUpdate=FALSE;
+	_xfdashboard_live_workspace_on_window_stacking_changed(self, NULL);
+}
+
 /* A window's state has changed */
 static void _xfdashboard_live_workspace_on_window_state_changed(XfdashboardLiveWorkspace *self,
 																XfdashboardWindowTrackerWindow *inWindow,
@@ -1074,6 +1104,7 @@ static void xfdashboard_live_workspace_init(XfdashboardLiveWorkspace *self)
 	priv->monitor=NULL;
 	priv->showWorkspaceName=FALSE;
 	priv->workspaceNamePadding=0.0f;
+	priv->isWindowsUpdate=FALSE;
 
 	/* Set up this actor */
 	clutter_actor_set_reactive(CLUTTER_ACTOR(self), TRUE);
@@ -1120,6 +1151,14 @@ static void xfdashboard_live_workspace_init(XfdashboardLiveWorkspace *self)
 								"window-stacking-changed",
 								G_CALLBACK(_xfdashboard_live_workspace_on_window_stacking_changed),
 								self);
+	g_signal_connect_swapped(priv->windowTracker,
+								"windows-update-begin",
+								G_CALLBACK(_xfdashboard_live_workspace_on_windows_update_begin),
+								self);
+	g_signal_connect_swapped(priv->windowTracker,
+								"windows-update-end",
+								G_CALLBACK(_xfdashboard_live_workspace_on_windows_update_end),
+								self);
 	g_signal_connect_swapped(priv->windowTracker,
 								"workspace-name-changed",
 								G_CALLBACK(_xfdashboard_live_workspace_on_workspace_name_changed),
@@ -48,6 +48,9 @@ struct _XfdashboardSearchProviderPrivate
 {
 	/* Properties related */
 	gchar					*providerID;
+
+	/* Instance related */
+	XfdashboardActorPool	*actorPool;
 };
 
 /* Properties */
@@ -74,6 +77,45 @@ static GParamSpec* XfdashboardSearchProviderProperties[PROP_LAST]={ 0, };
 						G_OBJECT_TYPE_NAME(self),                              \
 						vfunc);
 
+/* Data of a synchronous search performed in a worker thread */
+typedef struct _XfdashboardSearchProviderThreadedSearchData		XfdashboardSearchProviderThreadedSearchData;
+struct _XfdashboardSearchProviderThreadedSearchData
+{
+	gchar							**searchTerms;
+	XfdashboardSearchResultSet		*previousResultSet;
+	XfdashboardSearchResultSet		*resultSet;
+};
+
+static void _xfdashboard_search_provider_threaded_search_data_free(XfdashboardSearchProviderThreadedSearchData *inData)
+{
+	g_return_if_fail(inData);
+
+	/* Release allocated resources */
+	if(inData->searchTerms) g_strfreev(inData->searchTerms);
+	if(inData->previousResultSet) g_object_unref(inData->previousResultSet);
+	if(inData->resultSet) g_object_unref(inData->resultSet);
+	g_free(inData);
+}
+
+/* Perform synchronous search of a thread-safe search provider in a worker thread */
+static void _xfdashboard_search_provider_threaded_search(GSimpleAsyncResult *inResult,
+															GObject *inObject,
+															GCancellable *inCancellable)
+{
+	XfdashboardSearchProviderThreadedSearchData		*data;
+
+G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+	data=(XfdashboardSearchProviderThreadedSearchData*)g_simple_async_result_get_op_res_gpointer(inResult);
+G_GNUC_END_IGNORE_DEPRECATIONS
+
+	/* Do not perform search if it was cancelled in the meantime */
+	if(g_cancellable_is_cancelled(inCancellable)) return;
+
+	data->resultSet=xfdashboard_search_provider_get_result_set(XFDASHBOARD_SEARCH_PROVIDER(inObject),
+																(const gchar**)data->searchTerms,
+																data->previousResultSet);
+}
+
 /* Set search provider ID */
 static void _xfdashboard_search_provider_set_id(XfdashboardSearchProvider *self, const gchar *inID)
 {
@@ -104,6 +146,12 @@ static void _xfdashboard_search_provider_dispose(GObject *inObject)
 	XfdashboardSearchProviderPrivate	*priv=self->priv;
 
 	/* Release allocated resources */
+	if(priv->actorPool)
+	{
+		g_object_unref(priv->actorPool);
+		priv->actorPool=NULL;
+	}
+
 	if(priv->providerID)
 	{
 		g_free(priv->providerID);
@@ -191,6 +239,7 @@ static void xfdashboard_search_provider_init(XfdashboardSearchProvider *self)
 
 	/* Set up default values */
 	priv->providerID=NULL;
+	priv->actorPool=NULL;
 }
 
 /* IMPLEMENTATION: Public API */
@@ -288,6 +337,149 @@ XfdashboardSearchResultSet* xfdashboard_search_provider_get_result_set(Xfdashboa
 	return(NULL);
 }
 
+/* Check if synchronous search of search provider can be performed in a worker
+ * thread, i.e. get_result_set() does not access any state which is modified
+ * in main thread while searching.
+ */
+gboolean xfdashboard_search_provider_is_thread_safe(XfdashboardSearchProvider *self)
+{
+	XfdashboardSearchProviderClass	*klass;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_SEARCH_PROVIDER(self), FALSE);
+
+	klass=XFDASHBOARD_SEARCH_PROVIDER_GET_CLASS(self);
+
+	/* Ask search provider if it is thread-safe */
+	if(klass->is_thread_safe)
+	{
+		return(klass->is_thread_safe(self));
+	}
+
+	/* If we get here the virtual function was not overridden,
+	 * so the search provider is not thread-safe.
+	 */
+	return(FALSE);
+}
+
+/* Get result set for list of search terms from search provider asynchronously. The
+ * callback is called when the result set is available or the search was cancelled
+ * and must call xfdashboard_search_provider_get_result_set_finish() to get the
+ * result set. If the search provider does not implement an asynchronous search,
+ * the synchronous search is performed in a worker thread if the search provider
+ * is thread-safe or in main thread otherwise. In both cases its result is passed
+ * to the callback in main loop.
+ */
+void xfdashboard_search_provider_get_result_set_async(XfdashboardSearchProvider *self,
+														const gchar **inSearchTerms,
+														XfdashboardSearchResultSet *inPreviousResultSet,
+														GCancellable *inCancellable,
+														GAsyncReadyCallback inCallback,
+														gpointer inUserData)
+{
+	XfdashboardSearchProviderClass					*klass;
+	GSimpleAsyncResult								*result;
+	XfdashboardSearchProviderThreadedSearchData		*data;
+
+	g_return_if_fail(XFDASHBOARD_IS_SEARCH_PROVIDER(self));
+	g_return_if_fail(inSearchTerms);
+	g_return_if_fail(!inPreviousResultSet || XFDASHBOARD_IS_SEARCH_RESULT_SET(inPreviousResultSet));
+	g_return_if_fail(!inCancellable || G_IS_CANCELLABLE(inCancellable));
+
+	klass=XFDASHBOARD_SEARCH_PROVIDER_GET_CLASS(self);
+
+	/* Start asynchronous search at search provider */
+	if(klass->get_result_set_async)
+	{
+		klass->get_result_set_async(self, inSearchTerms, inPreviousResultSet, inCancellable, inCallback, inUserData);
+		return;
+	}
+
+	/* If we get here the search provider only supports synchronous searches.
+	 * Copy search terms as the search may be performed in another thread.
+	 */
+	data=g_new0(XfdashboardSearchProviderThreadedSearchData, 1);
+	data->searchTerms=g_strdupv((gchar**)inSearchTerms);
+	if(inPreviousResultSet) data->previousResultSet=g_object_ref(inPreviousResultSet);
+
+G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+	result=g_simple_async_result_new(G_OBJECT(self),
+										inCallback,
+										inUserData,
+										xfdashboard_search_provider_get_result_set_async);
+	g_simple_async_result_set_check_cancellable(result, inCancellable);
+	g_simple_async_result_set_op_res_gpointer(result, data, (GDestroyNotify)_xfdashboard_search_provider_threaded_search_data_free);
+
+	/* If search provider is thread-safe perform the search in a worker thread
+	 * so that searches at all thread-safe search providers run in parallel.
+	 */
+	if(xfdashboard_search_provider_is_thread_safe(self))
+	{
+		g_simple_async_result_run_in_thread(result,
+											_xfdashboard_search_provider_threaded_search,
+											G_PRIORITY_DEFAULT,
+											inCancellable);
+		g_object_unref(result);
+		return;
+	}
+
+	/* Otherwise perform the search now but complete it asynchronously.
+	 * A cancelled search is not performed at all.
+	 */
+	if(!g_cancellable_is_cancelled(inCancellable))
+	{
+		data->resultSet=xfdashboard_search_provider_get_result_set(self, inSearchTerms, inPreviousResultSet);
+	}
+
+	g_simple_async_result_complete_in_idle(result);
+	g_object_unref(result);
+G_GNUC_END_IGNORE_DEPRECATIONS
+}
+
+/* Finish asynchronous search and return result set. The returned result set
+ * must be freed with g_object_unref(). NULL is returned if search provider
+ * has no result or if an error occured, e.g. the search was cancelled, in which
+ * case the error is set.
+ */
+XfdashboardSearchResultSet* xfdashboard_search_provider_get_result_set_finish(XfdashboardSearchProvider *self,
+																				GAsyncResult *inResult,
+																				GError **outError)
+{
+	XfdashboardSearchProviderClass					*klass;
+	XfdashboardSearchProviderThreadedSearchData		*data;
+	XfdashboardSearchResultSet						*resultSet;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_SEARCH_PROVIDER(self), NULL);
+	g_return_val_if_fail(G_IS_ASYNC_RESULT(inResult), NULL);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, NULL);
+
+	klass=XFDASHBOARD_SEARCH_PROVIDER_GET_CLASS(self);
+
+	/* Get result set of synchronous search completed asynchronously */
+G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+	if(g_simple_async_result_is_valid(inResult, G_OBJECT(self), xfdashboard_search_provider_get_result_set_async))
+	{
+		if(g_simple_async_result_propagate_error(G_SIMPLE_ASYNC_RESULT(inResult), outError)) return(NULL);
+
+		data=(XfdashboardSearchProviderThreadedSearchData*)g_simple_async_result_get_op_res_gpointer(G_SIMPLE_ASYNC_RESULT(inResult));
+
+		resultSet=NULL;
+		if(data && data->resultSet) resultSet=g_object_ref(data->resultSet);
+
+		return(resultSet);
+	}
+G_GNUC_END_IGNORE_DEPRECATIONS
+
+	/* Get result set of asynchronous search of search provider */
+	if(klass->get_result_set_finish)
+	{
+		return(klass->get_result_set_finish(self, inResult, outError));
+	}
+
+	/* If we get here the virtual function was not overridden */
+	XFDASHBOARD_SEARCH_PROVIDER_WARN_NOT_IMPLEMENTED(self, "get_result_set_finish");
+	return(NULL);
+}
+
 /* Returns an actor for requested result item */
 ClutterActor* xfdashboard_search_provider_create_result_actor(XfdashboardSearchProvider *self,
 																GVariant *inResultItem)
@@ -310,6 +502,25 @@ ClutterActor* xfdashboard_search_provider_create_result_actor(XfdashboardSearchP
 	return(NULL);
 }
 
+/* Get pool of result actors which can be recycled. Search providers may take
+ * actors from this pool in their create_result_actor function and register
+ * newly created ones at it. Result containers release actors of removed
+ * result items into this pool instead of destroying them.
+ */
+XfdashboardActorPool* xfdashboard_search_provider_get_actor_pool(XfdashboardSearchProvider *self)
+{
+	XfdashboardSearchProviderPrivate	*priv;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_SEARCH_PROVIDER(self), NULL);
+
+	priv=self->priv;
+
+	/* Create pool on first use */
+	if(!priv->actorPool) priv->actorPool=xfdashboard_actor_pool_new();
+
+	return(priv->actorPool);
+}
+
 /* Launch search in external service or application the search provider relies on
  * with provided list of search terms.
  */
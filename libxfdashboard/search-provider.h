@@ -29,7 +29,9 @@
 #endif
 
 #include <clutter/clutter.h>
+#include <gio/gio.h>
 
+#include <libxfdashboard/actor-pool.h>
 #include <libxfdashboard/search-result-set.h>
 
 G_BEGIN_DECLS
@@ -71,6 +73,16 @@ struct _XfdashboardSearchProviderClass
 	XfdashboardSearchResultSet* (*get_result_set)(XfdashboardSearchProvider *self,
 													const gchar **inSearchTerms,
 													XfdashboardSearchResultSet *inPreviousResultSet);
+	gboolean (*is_thread_safe)(XfdashboardSearchProvider *self);
+	void (*get_result_set_async)(XfdashboardSearchProvider *self,
+									const gchar **inSearchTerms,
+									XfdashboardSearchResultSet *inPreviousResultSet,
+									GCancellable *inCancellable,
+									GAsyncReadyCallback inCallback,
+									gpointer inUserData);
+	XfdashboardSearchResultSet* (*get_result_set_finish)(XfdashboardSearchProvider *self,
+															GAsyncResult *inResult,
+															GError **outError);
 
 	ClutterActor* (*create_result_actor)(XfdashboardSearchProvider *self,
 											GVariant *inResultItem);
@@ -96,10 +108,22 @@ const gchar* xfdashboard_search_provider_get_icon(XfdashboardSearchProvider *sel
 XfdashboardSearchResultSet* xfdashboard_search_provider_get_result_set(XfdashboardSearchProvider *self,
 																		const gchar **inSearchTerms,
 																		XfdashboardSearchResultSet *inPreviousResultSet);
+gboolean xfdashboard_search_provider_is_thread_safe(XfdashboardSearchProvider *self);
+void xfdashboard_search_provider_get_result_set_async(XfdashboardSearchProvider *self,
+														const gchar **inSearchTerms,
+														XfdashboardSearchResultSet *inPreviousResultSet,
+														GCancellable *inCancellable,
+														GAsyncReadyCallback inCallback,
+														gpointer inUserData);
+XfdashboardSearchResultSet* xfdashboard_search_provider_get_result_set_finish(XfdashboardSearchProvider *self,
+																				GAsyncResult *inResult,
+																				GError **outError);
 
 ClutterActor* xfdashboard_search_provider_create_result_actor(XfdashboardSearchProvider *self,
 																GVariant *inResultItem);
 
+XfdashboardActorPool* xfdashboard_search_provider_get_actor_pool(XfdashboardSearchProvider *self);
+
 gboolean xfdashboard_search_provider_launch_search(XfdashboardSearchProvider *self,
 													const gchar **inSearchTerms);
 
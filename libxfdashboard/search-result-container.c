@@ -500,6 +500,53 @@ static ClutterActor* _xfdashboard_search_result_container_result_item_actor_new(
 	return(actor);
 }
 
+/* Undo set up of actor for result item and put it into actor pool of search
+ * provider. Returns FALSE if actor could not be recycled and must be destroyed.
+ */
+static gboolean _xfdashboard_search_result_container_result_item_actor_release(XfdashboardSearchResultContainer *self,
+																				ClutterActor *inActor)
+{
+	XfdashboardSearchResultContainerPrivate		*priv;
+	GList										*actions;
+	GList										*actionsIter;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_SEARCH_RESULT_CONTAINER(self), FALSE);
+	g_return_val_if_fail(CLUTTER_IS_ACTOR(inActor), FALSE);
+
+	priv=self->priv;
+
+	/* Remove click action added by this container and unset this container
+	 * as source at drag actions as actor may be reused by another container.
+	 */
+	actions=clutter_actor_get_actions(inActor);
+	for(actionsIter=actions; actionsIter; actionsIter=g_list_next(actionsIter))
+	{
+		if(XFDASHBOARD_IS_CLICK_ACTION(actionsIter->data) &&
+			g_signal_handlers_disconnect_by_func(actionsIter->data, _xfdashboard_search_result_container_on_result_item_actor_clicked, self)>0)
+		{
+			clutter_actor_remove_action(inActor, CLUTTER_ACTION(actionsIter->data));
+		}
+
+		if(XFDASHBOARD_IS_DRAG_ACTION(actionsIter->data) &&
+			xfdashboard_drag_action_get_source(XFDASHBOARD_DRAG_ACTION(actionsIter->data))==CLUTTER_ACTOR(self))
+		{
+			g_object_set(actionsIter->data, "source", NULL, NULL);
+		}
+	}
+	if(actions) g_list_free(actions);
+
+	/* Remove style classes set by this container */
+	if(XFDASHBOARD_IS_STYLABLE(inActor))
+	{
+		xfdashboard_stylable_remove_class(XFDASHBOARD_STYLABLE(inActor), "view-mode-list");
+		xfdashboard_stylable_remove_class(XFDASHBOARD_STYLABLE(inActor), "view-mode-icon");
+		xfdashboard_stylable_remove_class(XFDASHBOARD_STYLABLE(inActor), "result-item");
+	}
+
+	/* Put actor into pool of search provider */
+	return(xfdashboard_actor_pool_release(xfdashboard_search_provider_get_actor_pool(priv->provider), inActor));
+}
+
 /* Sets provider this result container is for */
 static void _xfdashboard_search_result_container_set_provider(XfdashboardSearchResultContainer *self,
 																XfdashboardSearchProvider *inProvider)
@@ -535,20 +582,88 @@ static void _xfdashboard_search_result_container_set_provider(XfdashboardSearchR
 	_xfdashboard_search_result_container_update_title(self);
 }
 
-/* Update result items in container */
+/* Remove actor of a result item from container */
+static void _xfdashboard_search_result_container_remove_result_item_actor(XfdashboardSearchResultContainer *self,
+																			GVariant *inResultItem,
+																			ClutterActor *inActor)
+{
+	XfdashboardSearchResultContainerPrivate		*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_SEARCH_RESULT_CONTAINER(self));
+	g_return_if_fail(inResultItem);
+
+	priv=self->priv;
+
+	/* Check if item has really an actor */
+	if(!CLUTTER_IS_ACTOR(inActor))
+	{
+		gchar		*resultItemText;
+
+		resultItemText=g_variant_print(inResultItem, TRUE);
+		g_critical(_("Failed to remove actor for result item %s of provider %s: Actor of type %s is not derived from class %s"),
+					resultItemText,
+					G_OBJECT_TYPE_NAME(priv->provider),
+					G_IS_OBJECT(inActor) ? G_OBJECT_TYPE_NAME(inActor) : "<unknown>",
+					g_type_name(CLUTTER_TYPE_ACTOR));
+		g_free(resultItemText);
+
+		return;
+	}
+
+	/* Move selection away from actor as it may not be destroyed */
+	if(inActor==priv->selectedItem)
+	{
+		_xfdashboard_search_result_container_on_destroy_selection(self, inActor);
+	}
+
+	/* First disconnect signal handlers from actor before modifying mapping hash table */
+	g_signal_handlers_disconnect_by_data(inActor, self);
+
+	/* Keep actor alive while removing it from mapping hash table as this
+	 * releases the reference the mapping took.
+	 */
+	g_object_ref(inActor);
+	g_hash_table_remove(priv->mapping, inResultItem);
+
+	/* Recycle actor if possible otherwise destroy it */
+	if(!_xfdashboard_search_result_container_result_item_actor_release(self, inActor))
+	{
+		clutter_actor_destroy(inActor);
+	}
+
+	/* Release extra reference taken */
+	g_object_unref(inActor);
+}
+
+/* Update result items in container by applying only the differences between
+ * the result items shown currently and the ones to show for given result set.
+ * Actors of result items which are still shown are kept with their styles,
+ * textures and layout and are only moved if their rank has changed.
+ */
 static void _xfdashboard_search_result_container_update_result_items(XfdashboardSearchResultContainer *self, XfdashboardSearchResultSet *inResultSet, gboolean inShowAllItems)
 {
 	XfdashboardSearchResultContainerPrivate		*priv;
-	GList										*allList;
+	GList										*showList;
+	GHashTable									*showItems;
+	GHashTableIter								hashIter;
 	GList										*removeList;
 	GList										*iter;
 	GVariant									*resultItem;
 	ClutterActor								*actor;
+	ClutterActor								*expectedActor;
+	gint										allItemsCount;
+	gint										showItemsCount;
+	gint										moreCount;
+	guint										keptCount;
+	guint										insertedCount;
+	guint										removedCount;
+	guint										movedCount;
 
 	g_return_if_fail(XFDASHBOARD_IS_SEARCH_RESULT_CONTAINER(self));
 	g_return_if_fail(XFDASHBOARD_IS_SEARCH_RESULT_SET(inResultSet));
 
 	priv=self->priv;
+	keptCount=insertedCount=removedCount=movedCount=0;
 
 	/* Check if search provider is set */
 	g_return_if_fail(priv->provider);
@@ -562,187 +677,164 @@ static void _xfdashboard_search_result_container_update_result_items(Xfdashboard
 	 */
 	g_object_ref(inResultSet);
 
-	/* Determine list of items whose actors to remove from container by checking
-	 * which result item was in last known result set but is not in given one
-	 * anymore.
+	/* Get number of all result items */
+	allItemsCount=(gint)xfdashboard_search_result_set_get_size(inResultSet);
+
+	/* If this is the first time the maximum number of actors is determined
+	 * then set it to initial number.
 	 */
-	removeList=NULL;
-	if(priv->lastResultSet) removeList=xfdashboard_search_result_set_complement(inResultSet, priv->lastResultSet);
+	if(!priv->maxResultsItemsCountSet)
+	{
+		priv->maxResultsItemsCount=priv->initialResultsCount;
+		priv->maxResultsItemsCountSet=TRUE;
+	}
 
-	/* Create actor for each item in list which is new to mapping */
-	allList=xfdashboard_search_result_set_get_all(inResultSet);
-	if(allList)
+	/* If maximum number of actors to show in items container is zero
+	 * then all result items should be shown.
+	 */
+	if(priv->maxResultsItemsCount<=0) inShowAllItems=TRUE;
+
+	/* If all result items should be shown then raise maximum number of actors
+	 * to the number of all result items to keep them shown when container is
+	 * updated next time.
+	 */
+	if(inShowAllItems && priv->maxResultsItemsCount>0)
 	{
-		ClutterActor							*lastActor;
-		gint									actorsCount;
-		gint									allItemsCount;
+		priv->maxResultsItemsCount=MAX(priv->maxResultsItemsCount, allItemsCount);
+	}
+
+	/* Get result items to show in order. The result set does not need to be
+	 * sorted completely if not all result items should be shown.
+	 */
+	if(inShowAllItems) showList=xfdashboard_search_result_set_get_all(inResultSet);
+		else showList=xfdashboard_search_result_set_get_top(inResultSet, priv->maxResultsItemsCount);
+	showItemsCount=g_list_length(showList);
 
-		/* Get number of all result items */
-		allItemsCount=g_list_length(allList);
+	showItems=g_hash_table_new(g_variant_hash, g_variant_equal);
+	for(iter=showList; iter; iter=g_list_next(iter))
+	{
+		g_hash_table_add(showItems, iter->data);
+	}
 
-		/* If this is the first time the maximum number of actors is determined
-		 * then set it to initial number.
-		 */
-		if(!priv->maxResultsItemsCountSet)
+	/* Determine list of items whose actors to remove from container by checking
+	 * which result item has an actor but should not be shown anymore. Then remove
+	 * their actors before moving or inserting any actor.
+	 */
+	removeList=NULL;
+	g_hash_table_iter_init(&hashIter, priv->mapping);
+	while(g_hash_table_iter_next(&hashIter, (gpointer*)&resultItem, NULL))
+	{
+		if(!g_hash_table_contains(showItems, resultItem))
 		{
-			priv->maxResultsItemsCount=priv->initialResultsCount;
-			priv->maxResultsItemsCountSet=TRUE;
+			removeList=g_list_prepend(removeList, g_variant_ref(resultItem));
 		}
+	}
 
-		/* If maximum number of actors to show in items container is zero
-		 * then all result items should be shown.
-		 */
-		if(priv->maxResultsItemsCount<=0) inShowAllItems=TRUE;
+	for(iter=removeList; iter; iter=g_list_next(iter))
+	{
+		resultItem=(GVariant*)iter->data;
 
-		/* Get current number of result actors but decrease it by the number
-		 * of actors which will be removed.
-		 */
-		actorsCount=clutter_actor_get_n_children(priv->itemsContainer);
-		if(removeList)
+		if(g_hash_table_lookup_extended(priv->mapping, resultItem, NULL, (gpointer*)&actor))
 		{
-			for(iter=removeList; iter && actorsCount>0; iter=g_list_next(iter))
-			{
-				/* Get result item to remove */
-				resultItem=(GVariant*)iter->data;
-
-				/* Get actor to remove */
-				if(g_hash_table_lookup_extended(priv->mapping, resultItem, NULL, (gpointer*)&actor))
-				{
-					if(actor) actorsCount--;
-				}
-			}
+			_xfdashboard_search_result_container_remove_result_item_actor(self, resultItem, actor);
+			removedCount++;
 		}
+	}
 
-		/* Iterate through list of result items and add actor for each result item
-		 * which has no actor currently but do not exceed maximum number of actors
-		 * we just determined above.
-		 */
-		lastActor=NULL;
-		for(iter=allList; iter && (inShowAllItems || actorsCount<=priv->maxResultsItemsCount); iter=g_list_next(iter))
-		{
-			/* Get result item to add */
-			resultItem=(GVariant*)iter->data;
-
-			/* If result item does not exist in mapping then create actor and
-			 * add it to mapping.
-			 */
-			if(!g_hash_table_lookup_extended(priv->mapping, resultItem, NULL, (gpointer*)&actor))
-			{
-				/* Increase actor counter and if it exceeds maximum number of
-				 * allowed actor continue with next result item in result set
-				 * which will not happen as maximum has exceeded.
-				 *
-				 */
-				actorsCount++;
-				if(!inShowAllItems && actorsCount>priv->maxResultsItemsCount) continue;
-
-				/* Create actor for result item and add to this container */
-				actor=_xfdashboard_search_result_container_result_item_actor_new(self, resultItem);
-				if(actor)
-				{
-					/* Add newly created actor to container of provider */
-					if(!lastActor) clutter_actor_insert_child_below(priv->itemsContainer, actor, NULL);
-						else clutter_actor_insert_child_above(priv->itemsContainer, actor, lastActor);
-
-					/* Add actor to mapping hash table for result item */
-					g_hash_table_insert(priv->mapping, g_variant_ref(resultItem), g_object_ref(actor));
-				}
-			}
+	/* Iterate through result items to show and compare the actor of each result
+	 * item with the actor at the same position in container. If they do not match
+	 * move the actor of result item to this position if it exists already or
+	 * create and insert a new actor for the result item at this position.
+	 */
+	expectedActor=clutter_actor_get_first_child(priv->itemsContainer);
+	for(iter=showList; iter; iter=g_list_next(iter))
+	{
+		resultItem=(GVariant*)iter->data;
 
-			/* Remember either existing actor from hash table lookup or
-			 * the newly created actor as the last one seen.
-			 */
-			if(actor) lastActor=actor;
+		/* Actor of result item is at expected position so keep it */
+		actor=NULL;
+		if(g_hash_table_lookup_extended(priv->mapping, resultItem, NULL, (gpointer*)&actor) &&
+			actor==expectedActor)
+		{
+			expectedActor=clutter_actor_get_next_sibling(expectedActor);
+			keptCount++;
+			continue;
 		}
 
-		/* If we tried to create at least one more actore than maximum allowed
-		 * then set text at "more"-label otherwise set empty text to "hide" it
-		 */
-		if(!inShowAllItems && actorsCount>priv->maxResultsItemsCount)
+		/* Move existing actor of result item in front of expected actor */
+		if(actor)
 		{
-			gchar								*labelText;
-			gint								moreCount;
-
-			/* Get text to set at "more"-label */
-			moreCount=MIN(allItemsCount-priv->maxResultsItemsCount, priv->moreResultsCount);
-			labelText=g_strdup_printf(_("Show %d more results..."), moreCount);
-
-			/* Set text at "more"-label */
-			xfdashboard_label_set_text(XFDASHBOARD_LABEL(priv->moreResultsLabelActor), labelText);
-
-			/* Release allocated resources */
-			if(labelText) g_free(labelText);
+			if(expectedActor) clutter_actor_set_child_below_sibling(priv->itemsContainer, actor, expectedActor);
+				else clutter_actor_set_child_above_sibling(priv->itemsContainer, actor, NULL);
+			movedCount++;
+			continue;
 		}
-			else
-			{
-				/* Set empty text at "more"-label */
-				xfdashboard_label_set_text(XFDASHBOARD_LABEL(priv->moreResultsLabelActor), NULL);
-			}
 
-		/* If we have more result items in result set than result items actors shown
-		 * then set text at "all"-label otherwise set empty text to "hide" it
-		 */
-		if(!inShowAllItems && actorsCount<allItemsCount)
+		/* Create actor for result item and insert it in front of expected actor */
+		actor=_xfdashboard_search_result_container_result_item_actor_new(self, resultItem);
+		if(actor)
 		{
-			gchar								*labelText;
-
-			/* Get text to set at "all"-label */
-			labelText=g_strdup_printf(_("Show all %d results..."), allItemsCount);
+			if(expectedActor) clutter_actor_insert_child_below(priv->itemsContainer, actor, expectedActor);
+				else clutter_actor_insert_child_above(priv->itemsContainer, actor, NULL);
 
-			/* Set text at "all"-label */
-			xfdashboard_label_set_text(XFDASHBOARD_LABEL(priv->allResultsLabelActor), labelText);
-
-			/* Release allocated resources */
-			if(labelText) g_free(labelText);
+			/* Add actor to mapping hash table for result item */
+			g_hash_table_insert(priv->mapping, g_variant_ref(resultItem), g_object_ref(actor));
+			insertedCount++;
 		}
-			else
-			{
-				/* Set empty text at "all"-label */
-				xfdashboard_label_set_text(XFDASHBOARD_LABEL(priv->allResultsLabelActor), NULL);
-			}
 	}
 
-	/* Remove the actor for each item in remove list */
-	if(removeList)
+	XFDASHBOARD_DEBUG(self, ACTOR,
+						"Updated result items of provider %s: %u kept, %u inserted, %u removed, %u moved",
+						G_OBJECT_TYPE_NAME(priv->provider),
+						keptCount,
+						insertedCount,
+						removedCount,
+						movedCount);
+
+	/* If more result items exist than shown then set text at "more"-label
+	 * otherwise set empty text to "hide" it
+	 */
+	if(!inShowAllItems && allItemsCount>showItemsCount)
 	{
-		/* Iterate through list of items to remove and for each one remove actor
-		 * and its entry in mapping hash table.
-		 */
-		for(iter=removeList; iter; iter=g_list_next(iter))
-		{
-			/* Get result item to remove */
-			resultItem=(GVariant*)iter->data;
+		gchar									*labelText;
 
-			/* Get actor to remove */
-			if(g_hash_table_lookup_extended(priv->mapping, resultItem, NULL, (gpointer*)&actor))
-			{
-				/* Check if item has really an actor */
-				if(!CLUTTER_IS_ACTOR(actor))
-				{
-					gchar		*resultItemText;
+		/* Get text to set at "more"-label */
+		moreCount=MIN(allItemsCount-showItemsCount, priv->moreResultsCount);
+		labelText=g_strdup_printf(_("Show %d more results..."), moreCount);
+
+		/* Set text at "more"-label */
+		xfdashboard_label_set_text(XFDASHBOARD_LABEL(priv->moreResultsLabelActor), labelText);
 
-					resultItemText=g_variant_print(resultItem, TRUE);
-					g_critical(_("Failed to remove actor for result item %s of provider %s: Actor of type %s is not derived from class %s"),
-								resultItemText,
-								G_OBJECT_TYPE_NAME(priv->provider),
-								G_IS_OBJECT(actor) ? G_OBJECT_TYPE_NAME(actor) : "<unknown>",
-								g_type_name(CLUTTER_TYPE_ACTOR));
-					g_free(resultItemText);
+		/* Release allocated resources */
+		if(labelText) g_free(labelText);
+	}
+		else
+		{
+			/* Set empty text at "more"-label */
+			xfdashboard_label_set_text(XFDASHBOARD_LABEL(priv->moreResultsLabelActor), NULL);
+		}
 
-					continue;
-				}
+	/* If more result items exist than shown and shown by clicking "more"-label
+	 * then set text at "all"-label otherwise set empty text to "hide" it
+	 */
+	if(!inShowAllItems && allItemsCount>showItemsCount+1)
+	{
+		gchar									*labelText;
 
-				/* First disconnect signal handlers from actor before modifying mapping hash table */
-				g_signal_handlers_disconnect_by_data(actor, self);
+		/* Get text to set at "all"-label */
+		labelText=g_strdup_printf(_("Show all %d results..."), allItemsCount);
 
-				/* Remove actor from mapping hash table before destroying it */
-				g_hash_table_remove(priv->mapping, resultItem);
+		/* Set text at "all"-label */
+		xfdashboard_label_set_text(XFDASHBOARD_LABEL(priv->allResultsLabelActor), labelText);
 
-				/* Destroy actor and remove from hash table */
-				clutter_actor_destroy(actor);
-			}
-		}
+		/* Release allocated resources */
+		if(labelText) g_free(labelText);
 	}
+		else
+		{
+			/* Set empty text at "all"-label */
+			xfdashboard_label_set_text(XFDASHBOARD_LABEL(priv->allResultsLabelActor), NULL);
+		}
 
 	/* Remember new result set for search provider */
 	if(priv->lastResultSet)
@@ -755,7 +847,8 @@ static void _xfdashboard_search_result_container_update_result_items(Xfdashboard
 
 	/* Release allocated resources */
 	if(removeList) g_list_free_full(removeList, (GDestroyNotify)g_variant_unref);
-	if(allList) g_list_free_full(allList, (GDestroyNotify)g_variant_unref);
+	if(showItems) g_hash_table_destroy(showItems);
+	if(showList) g_list_free_full(showList, (GDestroyNotify)g_variant_unref);
 
 	/* Release extra reference we took at begin of this function */
 	g_object_unref(inResultSet);
@@ -45,6 +45,9 @@ struct _XfdashboardSearchResultSetPrivate
 {
 	/* Instance related */
 	GHashTable								*set;
+	GPtrArray								*items;
+	gboolean								isSorted;
+	GMutex									lock;
 
 	XfdashboardSearchResultSetCompareFunc	sortCallback;
 	gpointer								sortUserData;
@@ -58,20 +61,24 @@ struct _XfdashboardSearchResultSetItemData
 	gint									refCount;
 
 	/* Item related */
+	GVariant								*item;
 	gfloat									score;
 };
 
 /* Create, destroy, ref and unref item data for an item */
-static XfdashboardSearchResultSetItemData* _xfdashboard_search_result_set_item_data_new(void)
+static XfdashboardSearchResultSetItemData* _xfdashboard_search_result_set_item_data_new(GVariant *inItem)
 {
 	XfdashboardSearchResultSetItemData	*data;
 
+	g_return_val_if_fail(inItem, NULL);
+
 	/* Create statistics data */
 	data=g_new0(XfdashboardSearchResultSetItemData, 1);
 	if(!data) return(NULL);
 
 	/* Set up statistics data */
 	data->refCount=1;
+	data->item=g_variant_ref_sink(inItem);
 
 	return(data);
 }
@@ -81,6 +88,7 @@ static void _xfdashboard_search_result_set_item_data_free(XfdashboardSearchResul
 	g_return_if_fail(inData);
 
 	/* Release common allocated resources */
+	if(inData->item) g_variant_unref(inData->item);
 	g_free(inData);
 }
 
@@ -165,6 +173,115 @@ static gint _xfdashboard_search_result_set_sort_internal(gconstpointer inLeft,
 	return((priv->sortCallback)(left, right, priv->sortUserData));
 }
 
+/* Internal callback function for sorting item data of this result set.
+ * It does the same as _xfdashboard_search_result_set_sort_internal() but
+ * does not need to lookup the scores of both items.
+ */
+static gint _xfdashboard_search_result_set_sort_item_data(gconstpointer inLeft,
+															gconstpointer inRight,
+															gpointer inUserData)
+{
+	XfdashboardSearchResultSet				*self=XFDASHBOARD_SEARCH_RESULT_SET(inUserData);
+	XfdashboardSearchResultSetPrivate		*priv=self->priv;
+	const XfdashboardSearchResultSetItemData	*left;
+	const XfdashboardSearchResultSetItemData	*right;
+
+	left=(const XfdashboardSearchResultSetItemData*)inLeft;
+	right=(const XfdashboardSearchResultSetItemData*)inRight;
+
+	/* Items with higher score are sorted first */
+	if(left->score < right->score) return(1);
+	if(left->score > right->score) return(-1);
+
+	/* Call sorting callback function now if both have the same score */
+	return((priv->sortCallback)(left->item, right->item, priv->sortUserData));
+}
+
+static gint _xfdashboard_search_result_set_sort_item_data_array(gconstpointer inLeft,
+																gconstpointer inRight,
+																gpointer inUserData)
+{
+	return(_xfdashboard_search_result_set_sort_item_data(*((gconstpointer*)inLeft),
+															*((gconstpointer*)inRight),
+															inUserData));
+}
+
+/* Sort array of items in this result set if a sorting function is set and it
+ * was not sorted since it was modified last time.
+ */
+static void _xfdashboard_search_result_set_ensure_sorted(XfdashboardSearchResultSet *self)
+{
+	XfdashboardSearchResultSetPrivate		*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_SEARCH_RESULT_SET(self));
+
+	priv=self->priv;
+
+	/* Do nothing if items are in order already or if there is no order */
+	if(priv->isSorted || !priv->sortCallback) return;
+
+	/* Sort items */
+	g_ptr_array_sort_with_data(priv->items, _xfdashboard_search_result_set_sort_item_data_array, self);
+	priv->isSorted=TRUE;
+}
+
+/* Move item data at given index in heap down until heap is valid again.
+ * The root of heap is the item which would be sorted last of all items
+ * in heap.
+ */
+static void _xfdashboard_search_result_set_heap_sift_down(XfdashboardSearchResultSet *self,
+															XfdashboardSearchResultSetItemData **ioHeap,
+															guint inHeapSize,
+															guint inIndex)
+{
+	XfdashboardSearchResultSetItemData		*swap;
+	guint									child;
+	guint									last;
+
+	while((child=(inIndex*2)+1)<inHeapSize)
+	{
+		/* Find child which would be sorted after the other one */
+		last=child;
+		if(child+1<inHeapSize &&
+			_xfdashboard_search_result_set_sort_item_data(ioHeap[child+1], ioHeap[child], self)>0)
+		{
+			last=child+1;
+		}
+
+		/* Stop if item is sorted after both children */
+		if(_xfdashboard_search_result_set_sort_item_data(ioHeap[inIndex], ioHeap[last], self)>=0) break;
+
+		/* Swap item with child and continue at child's position */
+		swap=ioHeap[inIndex];
+		ioHeap[inIndex]=ioHeap[last];
+		ioHeap[last]=swap;
+		inIndex=last;
+	}
+}
+
+/* Move item data at given index in heap up until heap is valid again */
+static void _xfdashboard_search_result_set_heap_sift_up(XfdashboardSearchResultSet *self,
+														XfdashboardSearchResultSetItemData **ioHeap,
+														guint inIndex)
+{
+	XfdashboardSearchResultSetItemData		*swap;
+	guint									parent;
+
+	while(inIndex>0)
+	{
+		parent=(inIndex-1)/2;
+
+		/* Stop if parent is sorted after item */
+		if(_xfdashboard_search_result_set_sort_item_data(ioHeap[parent], ioHeap[inIndex], self)>=0) break;
+
+		/* Swap item with parent and continue at parent's position */
+		swap=ioHeap[inIndex];
+		ioHeap[inIndex]=ioHeap[parent];
+		ioHeap[parent]=swap;
+		inIndex=parent;
+	}
+}
+
 /* IMPLEMENTATION: GObject */
 
 /* Dispose this object */
@@ -197,10 +314,29 @@ static void _xfdashboard_search_result_set_dispose(GObject *inObject)
 		priv->set=NULL;
 	}
 
+	if(priv->items)
+	{
+		g_ptr_array_unref(priv->items);
+		priv->items=NULL;
+	}
+
 	/* Call parent's class dispose method */
 	G_OBJECT_CLASS(xfdashboard_search_result_set_parent_class)->dispose(inObject);
 }
 
+/* Finalize this object */
+static void _xfdashboard_search_result_set_finalize(GObject *inObject)
+{
+	XfdashboardSearchResultSet			*self=XFDASHBOARD_SEARCH_RESULT_SET(inObject);
+	XfdashboardSearchResultSetPrivate	*priv=self->priv;
+
+	/* Release allocated resouces */
+	g_mutex_clear(&priv->lock);
+
+	/* Call parent's class finalize method */
+	G_OBJECT_CLASS(xfdashboard_search_result_set_parent_class)->finalize(inObject);
+}
+
 /* Class initialization
  * Override functions in parent classes and define properties
  * and signals
@@ -211,6 +347,7 @@ static void xfdashboard_search_result_set_class_init(XfdashboardSearchResultSetC
 
 	/* Override functions */
 	gobjectClass->dispose=_xfdashboard_search_result_set_dispose;
+	gobjectClass->finalize=_xfdashboard_search_result_set_finalize;
 
 	/* Set up private structure */
 	g_type_class_add_private(klass, sizeof(XfdashboardSearchResultSetPrivate));
@@ -228,8 +365,11 @@ static void xfdashboard_search_result_set_init(XfdashboardSearchResultSet *self)
 	/* Set default values */
 	priv->set=g_hash_table_new_full(g_variant_hash,
 									g_variant_equal,
-									(GDestroyNotify)g_variant_unref,
+									NULL,
 									(GDestroyNotify)_xfdashboard_search_result_set_item_data_unref);
+	priv->items=g_ptr_array_new_with_free_func((GDestroyNotify)_xfdashboard_search_result_set_item_data_unref);
+	priv->isSorted=FALSE;
+	g_mutex_init(&priv->lock);
 }
 
 /* IMPLEMENTATION: Public API */
@@ -263,10 +403,14 @@ void xfdashboard_search_result_set_add_item(XfdashboardSearchResultSet *self, GV
 	if(!g_hash_table_lookup_extended(priv->set, inItem, NULL, (gpointer*)&itemData))
 	{
 		/* Create data for item to add */
-		itemData=_xfdashboard_search_result_set_item_data_new();
+		itemData=_xfdashboard_search_result_set_item_data_new(inItem);
 
-		/* Add new item to result set */
-		g_hash_table_insert(priv->set, g_variant_ref_sink(inItem), itemData);
+		/* Add new item to result set. The hash table is used for lookups
+		 * and the array keeps all items compact for ordering them.
+		 */
+		g_hash_table_insert(priv->set, itemData->item, itemData);
+		g_ptr_array_add(priv->items, _xfdashboard_search_result_set_item_data_ref(itemData));
+		priv->isSorted=FALSE;
 	}
 }
 
@@ -290,30 +434,129 @@ gboolean xfdashboard_search_result_set_has_item(XfdashboardSearchResultSet *self
 GList* xfdashboard_search_result_set_get_all(XfdashboardSearchResultSet *self)
 {
 	XfdashboardSearchResultSetPrivate		*priv;
-	GHashTableIter							iter;
+	XfdashboardSearchResultSetItemData		*itemData;
 	GList									*list;
-	GVariant								*key;
+	guint									i;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_SEARCH_RESULT_SET(self), NULL);
 
 	priv=self->priv;
 
-	/* Iterate through hash table of this result set, take a reference of
-	 * key of this result set's hash table item and add list to result list.
+	/* Lock result set as it may be read by a search provider in another
+	 * thread while it is sorted.
+	 */
+	g_mutex_lock(&priv->lock);
+
+	/* If a sorting function was set then sort items. The order is kept
+	 * until this result set is modified.
+	 */
+	_xfdashboard_search_result_set_ensure_sorted(self);
+
+	/* Iterate backwards through items of this result set, take a reference
+	 * of each item and prepend it to result list to keep order.
 	 */
 	list=NULL;
-	g_hash_table_iter_init(&iter, priv->set);
-	while(g_hash_table_iter_next(&iter, (gpointer*)&key, NULL))
+	for(i=priv->items->len; i>0; i--)
 	{
-		list=g_list_prepend(list, g_variant_ref(key));
+		itemData=(XfdashboardSearchResultSetItemData*)g_ptr_array_index(priv->items, i-1);
+		list=g_list_prepend(list, g_variant_ref(itemData->item));
 	}
 
-	/* If a sorting function was set then sort result list */
-	if(list && priv->sortCallback)
+	g_mutex_unlock(&priv->lock);
+
+	/* Return result */
+	return(list);
+}
+
+/* Get list of the first items in this result set in order of sorting function
+ * but not more than the requested number of items. In contrast to
+ * xfdashboard_search_result_set_get_all() the result set does not need to
+ * be sorted completely to get these items.
+ * Returned list should be freed with g_list_free_full(result, g_variant_unref)
+ */
+GList* xfdashboard_search_result_set_get_top(XfdashboardSearchResultSet *self, guint inCount)
+{
+	XfdashboardSearchResultSetPrivate		*priv;
+	XfdashboardSearchResultSetItemData		**heap;
+	XfdashboardSearchResultSetItemData		*itemData;
+	guint									heapSize;
+	GList									*list;
+	guint									i;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_SEARCH_RESULT_SET(self), NULL);
+
+	priv=self->priv;
+
+	/* Nothing to do if no item is requested */
+	if(inCount==0) return(NULL);
+
+	/* Lock result set as it may be read by a search provider in another
+	 * thread while it is sorted.
+	 */
+	g_mutex_lock(&priv->lock);
+
+	/* If all items are requested or if the items are in order already,
+	 * then just take the first items.
+	 */
+	if(inCount>=priv->items->len ||
+		priv->isSorted ||
+		!priv->sortCallback)
 	{
-		list=g_list_sort_with_data(list, _xfdashboard_search_result_set_sort_internal, self);
+		_xfdashboard_search_result_set_ensure_sorted(self);
+
+		list=NULL;
+		for(i=MIN(inCount, priv->items->len); i>0; i--)
+		{
+			itemData=(XfdashboardSearchResultSetItemData*)g_ptr_array_index(priv->items, i-1);
+			list=g_list_prepend(list, g_variant_ref(itemData->item));
+		}
+
+		g_mutex_unlock(&priv->lock);
+
+		return(list);
 	}
 
+	/* Find the requested number of first items by keeping them in a heap
+	 * whose root is the item which would be sorted last. Each other item
+	 * which is sorted before this root replaces it.
+	 */
+	heap=g_new(XfdashboardSearchResultSetItemData*, inCount);
+	heapSize=0;
+	for(i=0; i<priv->items->len; i++)
+	{
+		itemData=(XfdashboardSearchResultSetItemData*)g_ptr_array_index(priv->items, i);
+
+		if(heapSize<inCount)
+		{
+			heap[heapSize]=itemData;
+			_xfdashboard_search_result_set_heap_sift_up(self, heap, heapSize);
+			heapSize++;
+		}
+			else if(_xfdashboard_search_result_set_sort_item_data(itemData, heap[0], self)<0)
+			{
+				heap[0]=itemData;
+				_xfdashboard_search_result_set_heap_sift_down(self, heap, heapSize, 0);
+			}
+	}
+
+	/* Take items from heap which returns them from the last to the first one.
+	 * So prepend them to result list to get them in order.
+	 */
+	list=NULL;
+	while(heapSize>0)
+	{
+		list=g_list_prepend(list, g_variant_ref(heap[0]->item));
+
+		heapSize--;
+		heap[0]=heap[heapSize];
+		_xfdashboard_search_result_set_heap_sift_down(self, heap, heapSize, 0);
+	}
+
+	g_mutex_unlock(&priv->lock);
+
+	/* Release allocated resources */
+	g_free(heap);
+
 	/* Return result */
 	return(list);
 }
@@ -324,35 +567,40 @@ GList* xfdashboard_search_result_set_get_all(XfdashboardSearchResultSet *self)
 GList* xfdashboard_search_result_set_intersect(XfdashboardSearchResultSet *self, XfdashboardSearchResultSet *inOtherSet)
 {
 	XfdashboardSearchResultSetPrivate		*priv;
-	GHashTableIter							iter;
+	XfdashboardSearchResultSetItemData		*itemData;
 	GList									*list;
-	GVariant								*key;
+	guint									i;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_SEARCH_RESULT_SET(self), NULL);
 	g_return_val_if_fail(XFDASHBOARD_IS_SEARCH_RESULT_SET(inOtherSet), NULL);
 
 	priv=self->priv;
 
-	/* Iterate through hash table of this result set and lookup its keys
-	 * at other result set's hash table. If it exists take a reference of
-	 * key of this result set's hash table item and add list to result list.
+	/* Lock result set as it may be read by a search provider in another
+	 * thread while it is sorted.
+	 */
+	g_mutex_lock(&priv->lock);
+
+	/* If a sorting function was set then sort items of this result set */
+	_xfdashboard_search_result_set_ensure_sorted(self);
+
+	/* Iterate backwards through items of this result set and lookup each
+	 * item at other result set's hash table. If it exists take a reference
+	 * of item and prepend it to result list to keep order.
 	 */
 	list=NULL;
-	g_hash_table_iter_init(&iter, priv->set);
-	while(g_hash_table_iter_next(&iter, (gpointer*)&key, NULL))
+	for(i=priv->items->len; i>0; i--)
 	{
-		/* Lookup key in other result set's hash table */
-		if(g_hash_table_lookup_extended(inOtherSet->priv->set, key, NULL, NULL))
+		itemData=(XfdashboardSearchResultSetItemData*)g_ptr_array_index(priv->items, i-1);
+
+		/* Lookup item in other result set's hash table */
+		if(g_hash_table_lookup_extended(inOtherSet->priv->set, itemData->item, NULL, NULL))
 		{
-			list=g_list_prepend(list, g_variant_ref(key));
+			list=g_list_prepend(list, g_variant_ref(itemData->item));
 		}
 	}
 
-	/* If a sorting function was set then sort result list */
-	if(list && priv->sortCallback)
-	{
-		list=g_list_sort_with_data(list, _xfdashboard_search_result_set_sort_internal, self);
-	}
+	g_mutex_unlock(&priv->lock);
 
 	/* Return result */
 	return(list);
@@ -443,6 +691,9 @@ void xfdashboard_search_result_set_set_sort_func_full(XfdashboardSearchResultSet
 		priv->sortUserData=inUserData;
 		priv->sortUserDataDestroyFunc=inUserDataDestroyFunc;
 	}
+
+	/* Items need to be sorted again */
+	priv->isSorted=FALSE;
 }
 
 /* Get/set score for a result item in result set */
@@ -485,8 +736,12 @@ gboolean xfdashboard_search_result_set_set_item_score(XfdashboardSearchResultSet
 	itemData=_xfdashboard_search_result_set_item_data_get(self, inItem);
 	if(itemData)
 	{
-		/* Set score */
-		itemData->score=inScore;
+		/* Set score and invalidate order of items if it has changed */
+		if(itemData->score!=inScore)
+		{
+			itemData->score=inScore;
+			self->priv->isSorted=FALSE;
+		}
 
 		/* Release allocated resources */
 		_xfdashboard_search_result_set_item_data_unref(itemData);
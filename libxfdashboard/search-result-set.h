@@ -73,6 +73,7 @@ guint xfdashboard_search_result_set_get_size(XfdashboardSearchResultSet *self);
 void xfdashboard_search_result_set_add_item(XfdashboardSearchResultSet *self, GVariant *inItem);
 gboolean xfdashboard_search_result_set_has_item(XfdashboardSearchResultSet *self, GVariant *inItem);
 GList* xfdashboard_search_result_set_get_all(XfdashboardSearchResultSet *self);
+GList* xfdashboard_search_result_set_get_top(XfdashboardSearchResultSet *self, guint inCount);
 
 GList* xfdashboard_search_result_set_intersect(XfdashboardSearchResultSet *self, XfdashboardSearchResultSet *inOtherSet);
 GList* xfdashboard_search_result_set_complement(XfdashboardSearchResultSet *self, XfdashboardSearchResultSet *inOtherSet);
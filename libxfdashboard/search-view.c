@@ -73,6 +73,7 @@ G_DEFINE_TYPE_WITH_CODE(XfdashboardSearchView,
 /* Forward declarations */
 typedef struct _XfdashboardSearchViewProviderData	XfdashboardSearchViewProviderData;
 typedef struct _XfdashboardSearchViewSearchTerms	XfdashboardSearchViewSearchTerms;
+typedef struct _XfdashboardSearchViewSearchRequest	XfdashboardSearchViewSearchRequest;
 
 /* Private structure - access only by public API if needed */
 #define XFDASHBOARD_SEARCH_VIEW_GET_PRIVATE(obj) \
@@ -85,6 +86,14 @@ struct _XfdashboardSearchViewPrivate
 	GList								*providers;
 
 	XfdashboardSearchViewSearchTerms	*lastTerms;
+	guint								fullSearchCount;
+	guint								incrementalSearchCount;
+
+	XfdashboardSearchViewSearchTerms	*pendingTerms;
+	guint								pendingProvidersCount;
+	guint								pendingResultsCount;
+	gboolean							pendingNotifyNoResults;
+	GTimer								*pendingTimer;
 
 	XfconfChannel						*xfconfChannel;
 	gboolean							delaySearch;
@@ -121,6 +130,7 @@ struct _XfdashboardSearchViewProviderData
 	XfdashboardSearchView				*view;
 	XfdashboardSearchViewSearchTerms	*lastTerms;
 	XfdashboardSearchResultSet			*lastResultSet;
+	GCancellable						*cancellable;
 
 	ClutterActor						*container;
 };
@@ -133,6 +143,21 @@ struct _XfdashboardSearchViewSearchTerms
 	gchar								**termList;
 };
 
+struct _XfdashboardSearchViewSearchRequest
+{
+	XfdashboardSearchView				*view;
+	XfdashboardSearchViewProviderData	*providerData;
+	XfdashboardSearchViewSearchTerms	*terms;
+	GCancellable						*cancellable;
+	gboolean							isIncremental;
+	gint64								startTime;
+};
+
+/* Forward declarations */
+static gboolean _xfdashboard_search_view_cancel_provider_search(XfdashboardSearchView *self,
+																XfdashboardSearchViewProviderData *inProviderData);
+static void _xfdashboard_search_view_finish_search(XfdashboardSearchView *self);
+
 /* Callback to ensure current selection is visible after search results were updated */
 static gboolean _xfdashboard_search_view_on_repaint_after_update_callback(gpointer inUserData)
 {
@@ -233,6 +258,7 @@ static XfdashboardSearchViewProviderData* _xfdashboard_search_view_provider_data
 	data->view=self;
 	data->lastTerms=NULL;
 	data->lastResultSet=NULL;
+	data->cancellable=NULL;
 	data->container=NULL;
 
 	return(data);
@@ -267,6 +293,12 @@ static void _xfdashboard_search_view_provider_data_free(XfdashboardSearchViewPro
 	}
 
 	/* Release allocated resources */
+	if(inData->cancellable)
+	{
+		g_cancellable_cancel(inData->cancellable);
+		g_object_unref(inData->cancellable);
+	}
+
 	if(inData->lastResultSet) g_object_unref(inData->lastResultSet);
 	if(inData->lastTerms) _xfdashboard_search_view_search_terms_unref(inData->lastTerms);
 	if(inData->provider) g_object_unref(inData->provider);
@@ -432,6 +464,15 @@ static void _xfdashboard_search_view_on_search_provider_unregistered(Xfdashboard
 		iter=g_list_find(priv->providers, data);
 		if(iter) priv->providers=g_list_delete_link(priv->providers, iter);
 
+		/* Cancel pending search at search provider and finish search
+		 * if it was the last search provider to wait for.
+		 */
+		if(_xfdashboard_search_view_cancel_provider_search(self, data) &&
+			priv->pendingProvidersCount==0)
+		{
+			_xfdashboard_search_view_finish_search(self);
+		}
+
 		/* Free provider data */
 		_xfdashboard_search_view_provider_data_unref(data);
 	}
@@ -637,6 +678,9 @@ static void _xfdashboard_search_view_update_provider_container(XfdashboardSearch
 																XfdashboardSearchViewProviderData *inProviderData,
 																XfdashboardSearchResultSet *inNewResultSet)
 {
+	GList					*providerIter;
+	ClutterActor			*nextContainer;
+
 	g_return_if_fail(XFDASHBOARD_IS_SEARCH_VIEW(self));
 	g_return_if_fail(inProviderData);
 	g_return_if_fail(!inNewResultSet || XFDASHBOARD_IS_SEARCH_RESULT_SET(inNewResultSet));
@@ -654,8 +698,19 @@ static void _xfdashboard_search_view_update_provider_container(XfdashboardSearch
 			inProviderData->container=xfdashboard_search_result_container_new(inProviderData->provider);
 			if(!inProviderData->container) return;
 
-			/* Add new container to search view */
-			clutter_actor_add_child(CLUTTER_ACTOR(self), inProviderData->container);
+			/* Add new container to search view. As search providers may return
+			 * their result sets in any order, insert it in front of the container
+			 * of the next search provider in order of registration which has one.
+			 */
+			nextContainer=NULL;
+			providerIter=g_list_find(self->priv->providers, inProviderData);
+			for(providerIter=providerIter ? g_list_next(providerIter) : NULL; providerIter && !nextContainer; providerIter=g_list_next(providerIter))
+			{
+				nextContainer=((XfdashboardSearchViewProviderData*)providerIter->data)->container;
+			}
+
+			if(nextContainer) clutter_actor_insert_child_below(CLUTTER_ACTOR(self), inProviderData->container, nextContainer);
+				else clutter_actor_add_child(CLUTTER_ACTOR(self), inProviderData->container);
 
 			/* Connect signals */
 			g_signal_connect(inProviderData->container,
@@ -718,55 +773,196 @@ static gboolean _xfdashboard_search_view_can_do_incremental_search(XfdashboardSe
 	/* Check for incremental search. An incremental search can be done
 	 * if the last search terms for a search provider is given, the order
 	 * in last search terms of search provider and the current search terms
-	 * has not changed and each term in both search terms is a case-sensitive
-	 * prefix of the term previously used.
+	 * has not changed and each term previously used is a case-sensitive
+	 * prefix of the term at same position in current search terms. The
+	 * current search terms may contain more terms than the previous ones
+	 * as each additional term can only narrow the result set.
 	 */
 	iterProvider=inProviderLastTerms->termList;
 	iterCurrent=inCurrentSearchTerms->termList;
 	while(*iterProvider && *iterCurrent)
 	{
-		if(g_strcmp0(*iterProvider, *iterCurrent)>0) return(FALSE);
+		if(!g_str_has_prefix(*iterCurrent, *iterProvider)) return(FALSE);
 
 		iterProvider++;
 		iterCurrent++;
 	}
 
-	/* If we are at end of list of terms in both search term
-	 * then both terms list are equal and return TRUE here.
+	/* If we are at end of list of terms of search provider then each term
+	 * was extended or kept and return TRUE here.
 	 */
-	if(!(*iterProvider) && !(*iterCurrent)) return(TRUE);
+	if(!(*iterProvider)) return(TRUE);
 
-	/* If we get here both terms list the criteria do not match
-	 * and an incremental search cannot be done. Return FALSE
-	 * to indicate that a full search is needed.
+	/* If we get here terms were removed and an incremental search cannot
+	 * be done. Return FALSE to indicate that a full search is needed.
 	 */
 	return(FALSE);
 }
 
-/* Perform search */
-static guint _xfdashboard_search_view_perform_search(XfdashboardSearchView *self, XfdashboardSearchViewSearchTerms *inSearchTerms)
+/* Create and free data of a search request at a search provider */
+static XfdashboardSearchViewSearchRequest* _xfdashboard_search_view_search_request_new(XfdashboardSearchView *self,
+																						XfdashboardSearchViewProviderData *inProviderData,
+																						XfdashboardSearchViewSearchTerms *inSearchTerms,
+																						gboolean inIsIncremental)
+{
+	XfdashboardSearchViewSearchRequest		*data;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_SEARCH_VIEW(self), NULL);
+	g_return_val_if_fail(inProviderData, NULL);
+	g_return_val_if_fail(inSearchTerms, NULL);
+
+	/* Create data for search request */
+	data=g_new0(XfdashboardSearchViewSearchRequest, 1);
+	data->view=XFDASHBOARD_SEARCH_VIEW(g_object_ref(self));
+	data->providerData=_xfdashboard_search_view_provider_data_ref(inProviderData);
+	data->terms=_xfdashboard_search_view_search_terms_ref(inSearchTerms);
+	data->cancellable=g_cancellable_new();
+	data->isIncremental=inIsIncremental;
+	data->startTime=g_get_monotonic_time();
+
+	return(data);
+}
+
+static void _xfdashboard_search_view_search_request_free(XfdashboardSearchViewSearchRequest *inData)
+{
+	g_return_if_fail(inData);
+
+	/* Release allocated resources */
+	if(inData->cancellable) g_object_unref(inData->cancellable);
+	if(inData->terms) _xfdashboard_search_view_search_terms_unref(inData->terms);
+	if(inData->providerData) _xfdashboard_search_view_provider_data_unref(inData->providerData);
+	if(inData->view) g_object_unref(inData->view);
+	g_free(inData);
+}
+
+/* Finish search when all search providers returned their result sets */
+static void _xfdashboard_search_view_finish_search(XfdashboardSearchView *self)
+{
+	XfdashboardSearchViewPrivate				*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_SEARCH_VIEW(self));
+
+	priv=self->priv;
+
+	/* Only a search in progress can be finished */
+	if(!priv->pendingTerms) return;
+
+#ifdef DEBUG
+	/* Get time for this search for debug performance */
+	if(priv->pendingTimer)
+	{
+		XFDASHBOARD_DEBUG(self, MISC,
+							"Updating search for '%s' took %f seconds",
+							priv->pendingTerms->termString,
+							g_timer_elapsed(priv->pendingTimer, NULL));
+	}
+#endif
+
+	/* Notify user if no search provider found anything */
+	if(priv->pendingNotifyNoResults &&
+		priv->pendingResultsCount==0)
+	{
+		xfdashboard_notify(CLUTTER_ACTOR(self),
+							xfdashboard_view_get_icon(XFDASHBOARD_VIEW(self)),
+							_("No results found for '%s'"),
+							priv->pendingTerms->termString);
+	}
+
+	/* Release allocated resources of finished search */
+	_xfdashboard_search_view_search_terms_unref(priv->pendingTerms);
+	priv->pendingTerms=NULL;
+
+	if(priv->pendingTimer)
+	{
+		g_timer_destroy(priv->pendingTimer);
+		priv->pendingTimer=NULL;
+	}
+
+	priv->pendingProvidersCount=0;
+	priv->pendingResultsCount=0;
+	priv->pendingNotifyNoResults=FALSE;
+}
+
+/* Cancel a pending search at a search provider */
+static gboolean _xfdashboard_search_view_cancel_provider_search(XfdashboardSearchView *self,
+																XfdashboardSearchViewProviderData *inProviderData)
+{
+	XfdashboardSearchViewPrivate				*priv;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_SEARCH_VIEW(self), FALSE);
+	g_return_val_if_fail(inProviderData, FALSE);
+
+	priv=self->priv;
+
+	/* Check if a search is pending at search provider */
+	if(!inProviderData->cancellable) return(FALSE);
+
+	/* Cancel search. The result of search provider will be discarded when
+	 * it arrives.
+	 */
+	g_cancellable_cancel(inProviderData->cancellable);
+	g_object_unref(inProviderData->cancellable);
+	inProviderData->cancellable=NULL;
+
+	XFDASHBOARD_DEBUG(self, MISC,
+						"Cancelled pending search at search provider %s",
+						G_OBJECT_TYPE_NAME(inProviderData->provider));
+
+	/* Search provider will not return a result for current search anymore */
+	if(priv->pendingProvidersCount>0) priv->pendingProvidersCount--;
+
+	return(TRUE);
+}
+
+/* Cancel all pending searches at all search providers */
+static void _xfdashboard_search_view_cancel_search(XfdashboardSearchView *self)
 {
 	XfdashboardSearchViewPrivate				*priv;
-	GList										*providers;
 	GList										*iter;
-	guint										numberResults;
+
+	g_return_if_fail(XFDASHBOARD_IS_SEARCH_VIEW(self));
+
+	priv=self->priv;
+
+	/* Cancel pending search at each search provider */
+	for(iter=priv->providers; iter; iter=g_list_next(iter))
+	{
+		_xfdashboard_search_view_cancel_provider_search(self, (XfdashboardSearchViewProviderData*)iter->data);
+	}
+
+	/* Release allocated resources of search in progress */
+	if(priv->pendingTerms)
+	{
+		_xfdashboard_search_view_search_terms_unref(priv->pendingTerms);
+		priv->pendingTerms=NULL;
+	}
+
+	if(priv->pendingTimer)
+	{
+		g_timer_destroy(priv->pendingTimer);
+		priv->pendingTimer=NULL;
+	}
+
+	priv->pendingProvidersCount=0;
+	priv->pendingResultsCount=0;
+	priv->pendingNotifyNoResults=FALSE;
+}
+
+/* Show new result set of a search provider */
+static void _xfdashboard_search_view_update_provider_result_set(XfdashboardSearchView *self,
+																XfdashboardSearchViewProviderData *inProviderData,
+																XfdashboardSearchResultSet *inNewResultSet)
+{
+	XfdashboardSearchViewPrivate				*priv;
 	ClutterActor								*reselectOldSelection;
 	XfdashboardSearchViewProviderData			*reselectProvider;
 	XfdashboardSelectionTarget					reselectDirection;
-#ifdef DEBUG
-	GTimer										*timer=NULL;
-#endif
 
-	g_return_val_if_fail(XFDASHBOARD_IS_SEARCH_VIEW(self), 0);
-	g_return_val_if_fail(inSearchTerms, 0);
+	g_return_if_fail(XFDASHBOARD_IS_SEARCH_VIEW(self));
+	g_return_if_fail(inProviderData);
+	g_return_if_fail(!inNewResultSet || XFDASHBOARD_IS_SEARCH_RESULT_SET(inNewResultSet));
 
 	priv=self->priv;
-	numberResults=0;
-
-#ifdef DEBUG
-	/* Start timer for debug search performance */
-	timer=g_timer_new();
-#endif
 
 	/* Check if this view has a selection and this one is the first item at
 	 * provider's container so we have to reselect the first item at that
@@ -823,74 +1019,13 @@ static guint _xfdashboard_search_view_perform_search(XfdashboardSearchView *self
 		}
 	}
 
-	/* Perform a search at all registered search providers */
-	providers=g_list_copy(priv->providers);
-	g_list_foreach(providers, (GFunc)_xfdashboard_search_view_provider_data_ref, NULL);
-	for(iter=providers; iter; iter=g_list_next(iter))
-	{
-		XfdashboardSearchViewProviderData		*providerData;
-		gboolean								canDoIncrementalSearch;
-		XfdashboardSearchResultSet				*providerNewResultSet;
-		XfdashboardSearchResultSet				*providerLastResultSet;
-
-		/* Get data for provider to perform search at */
-		providerData=((XfdashboardSearchViewProviderData*)(iter->data));
-
-		/* Check if we can do an incremental search based on previous
-		 * results or if we have to do a full search.
-		 */
-		canDoIncrementalSearch=FALSE;
-		providerLastResultSet=NULL;
-		if(providerData->lastTerms &&
-			_xfdashboard_search_view_can_do_incremental_search(providerData->lastTerms, inSearchTerms))
-		{
-			canDoIncrementalSearch=TRUE;
-			if(providerData->lastResultSet) providerLastResultSet=g_object_ref(providerData->lastResultSet);
-		}
-
-		/* Perform search */
-		providerNewResultSet=xfdashboard_search_provider_get_result_set(providerData->provider,
-																		(const gchar**)inSearchTerms->termList,
-																		providerLastResultSet);
-		XFDASHBOARD_DEBUG(self, MISC,
-							"Performed %s search at search provider %s and got %u result items",
-							canDoIncrementalSearch==TRUE ? "incremental" : "full",
-							G_OBJECT_TYPE_NAME(providerData->provider),
-							providerNewResultSet ? xfdashboard_search_result_set_get_size(providerNewResultSet) : 0);
-
-		/* Count number of results */
-		if(providerNewResultSet) numberResults+=xfdashboard_search_result_set_get_size(providerNewResultSet);
-
-		/* Remember new search term as last one at search provider */
-		if(providerData->lastTerms) _xfdashboard_search_view_search_terms_unref(providerData->lastTerms);
-		providerData->lastTerms=_xfdashboard_search_view_search_terms_ref(inSearchTerms);
-
-		/* Update view of search provider for new result set */
-		_xfdashboard_search_view_update_provider_container(self, providerData, providerNewResultSet);
-
-		/* Release allocated resources */
-		if(providerLastResultSet) g_object_unref(providerLastResultSet);
-		if(providerNewResultSet) g_object_unref(providerNewResultSet);
-	}
-	g_list_free_full(providers, (GDestroyNotify)_xfdashboard_search_view_provider_data_unref);
-
-	/* Remember new search terms as last one */
-	if(priv->lastTerms) _xfdashboard_search_view_search_terms_unref(priv->lastTerms);
-	priv->lastTerms=_xfdashboard_search_view_search_terms_ref(inSearchTerms);
-
-#ifdef DEBUG
-	/* Get time for this search for debug performance */
-	XFDASHBOARD_DEBUG(self, MISC,
-						"Updating search for '%s' took %f seconds",
-						inSearchTerms->termString,
-						g_timer_elapsed(timer, NULL));
-	g_timer_destroy(timer);
-#endif
+	/* Update view of search provider for new result set */
+	_xfdashboard_search_view_update_provider_container(self, inProviderData, inNewResultSet);
 
 	/* Reselect first or last item at provider if we remembered the provider where
 	 * the item should be reselected and if selection has changed while updating results.
 	 */
-	if(reselectProvider)
+	if(reselectProvider && reselectProvider->container)
 	{
 		ClutterActor							*selection;
 
@@ -954,9 +1089,171 @@ static guint _xfdashboard_search_view_perform_search(XfdashboardSearchView *self
 
 	/* Emit signal that search was updated */
 	g_signal_emit(self, XfdashboardSearchViewSignals[SIGNAL_SEARCH_UPDATED], 0);
+}
+
+/* A search provider returned its result set for a search request */
+static void _xfdashboard_search_view_on_provider_result_set_ready(GObject *inSource,
+																	GAsyncResult *inResult,
+																	gpointer inUserData)
+{
+	XfdashboardSearchViewSearchRequest			*request;
+	XfdashboardSearchView						*self;
+	XfdashboardSearchViewPrivate				*priv;
+	XfdashboardSearchViewProviderData			*providerData;
+	XfdashboardSearchResultSet					*resultSet;
+	GError										*error;
+
+	g_return_if_fail(XFDASHBOARD_IS_SEARCH_PROVIDER(inSource));
+	g_return_if_fail(inUserData);
+
+	request=(XfdashboardSearchViewSearchRequest*)inUserData;
+	self=request->view;
+	priv=self->priv;
+	providerData=request->providerData;
+	error=NULL;
+
+	/* Get result set of search provider */
+	resultSet=xfdashboard_search_provider_get_result_set_finish(XFDASHBOARD_SEARCH_PROVIDER(inSource), inResult, &error);
+
+	/* Discard result set if search was cancelled or a newer search was started
+	 * at search provider in the meantime.
+	 */
+	if(g_cancellable_is_cancelled(request->cancellable) ||
+		providerData->cancellable!=request->cancellable)
+	{
+		XFDASHBOARD_DEBUG(self, MISC,
+							"Discarding result set of cancelled search for '%s' at search provider %s after %.3f ms",
+							request->terms->termString,
+							G_OBJECT_TYPE_NAME(inSource),
+							(g_get_monotonic_time()-request->startTime)/1000.0);
+
+		/* Release allocated resources */
+		if(resultSet) g_object_unref(resultSet);
+		if(error) g_error_free(error);
+		_xfdashboard_search_view_search_request_free(request);
+
+		return;
+	}
+
+	/* Search at search provider is done */
+	g_object_unref(providerData->cancellable);
+	providerData->cancellable=NULL;
+
+	if(error)
+	{
+		g_warning(_("Could not get result set from search provider %s: %s"),
+					G_OBJECT_TYPE_NAME(inSource),
+					error->message);
+		g_error_free(error);
+	}
+
+	if(request->isIncremental) priv->incrementalSearchCount++;
+		else priv->fullSearchCount++;
+
+	XFDASHBOARD_DEBUG(self, MISC,
+						"Performed %s search at %s search provider %s in %.3f ms and got %u result items (%u full and %u incremental searches so far)",
+						request->isIncremental==TRUE ? "incremental" : "full",
+						xfdashboard_search_provider_is_thread_safe(XFDASHBOARD_SEARCH_PROVIDER(inSource)) ? "thread-safe" : "main-thread",
+						G_OBJECT_TYPE_NAME(inSource),
+						(g_get_monotonic_time()-request->startTime)/1000.0,
+						resultSet ? xfdashboard_search_result_set_get_size(resultSet) : 0,
+						priv->fullSearchCount,
+						priv->incrementalSearchCount);
+
+	/* Count number of results */
+	if(resultSet) priv->pendingResultsCount+=xfdashboard_search_result_set_get_size(resultSet);
 
-	/* Return number of results */
-	return(numberResults);
+	/* Remember search terms as last one at search provider */
+	if(providerData->lastTerms) _xfdashboard_search_view_search_terms_unref(providerData->lastTerms);
+	providerData->lastTerms=_xfdashboard_search_view_search_terms_ref(request->terms);
+
+	/* Show new result set of search provider */
+	_xfdashboard_search_view_update_provider_result_set(self, providerData, resultSet);
+
+	/* Finish search if it was the last search provider to wait for */
+	if(priv->pendingProvidersCount>0) priv->pendingProvidersCount--;
+	if(priv->pendingProvidersCount==0) _xfdashboard_search_view_finish_search(self);
+
+	/* Release allocated resources */
+	if(resultSet) g_object_unref(resultSet);
+	_xfdashboard_search_view_search_request_free(request);
+}
+
+/* Perform search. The search is started at all search providers and the results
+ * are shown as they arrive from each search provider. Any search still pending
+ * for previous search terms is cancelled.
+ */
+static void _xfdashboard_search_view_perform_search(XfdashboardSearchView *self,
+													XfdashboardSearchViewSearchTerms *inSearchTerms,
+													gboolean inNotifyNoResults)
+{
+	XfdashboardSearchViewPrivate				*priv;
+	GList										*providers;
+	GList										*iter;
+
+	g_return_if_fail(XFDASHBOARD_IS_SEARCH_VIEW(self));
+	g_return_if_fail(inSearchTerms);
+
+	priv=self->priv;
+
+	/* Cancel pending searches for previous search terms */
+	_xfdashboard_search_view_cancel_search(self);
+
+	/* Set up new search */
+	priv->pendingTerms=_xfdashboard_search_view_search_terms_ref(inSearchTerms);
+	priv->pendingNotifyNoResults=inNotifyNoResults;
+
+#ifdef DEBUG
+	/* Start timer for debug search performance */
+	priv->pendingTimer=g_timer_new();
+#endif
+
+	/* Start search at all registered search providers */
+	providers=g_list_copy(priv->providers);
+	g_list_foreach(providers, (GFunc)_xfdashboard_search_view_provider_data_ref, NULL);
+	for(iter=providers; iter; iter=g_list_next(iter))
+	{
+		XfdashboardSearchViewProviderData		*providerData;
+		gboolean								canDoIncrementalSearch;
+		XfdashboardSearchResultSet				*providerLastResultSet;
+		XfdashboardSearchViewSearchRequest		*request;
+
+		/* Get data for provider to perform search at */
+		providerData=((XfdashboardSearchViewProviderData*)(iter->data));
+
+		/* Check if we can do an incremental search based on previous
+		 * results or if we have to do a full search.
+		 */
+		canDoIncrementalSearch=FALSE;
+		providerLastResultSet=NULL;
+		if(providerData->lastTerms &&
+			providerData->lastResultSet &&
+			_xfdashboard_search_view_can_do_incremental_search(providerData->lastTerms, inSearchTerms))
+		{
+			canDoIncrementalSearch=TRUE;
+			providerLastResultSet=providerData->lastResultSet;
+		}
+
+		/* Start search */
+		request=_xfdashboard_search_view_search_request_new(self, providerData, inSearchTerms, canDoIncrementalSearch);
+		providerData->cancellable=g_object_ref(request->cancellable);
+		priv->pendingProvidersCount++;
+
+		xfdashboard_search_provider_get_result_set_async(providerData->provider,
+															(const gchar**)inSearchTerms->termList,
+															providerLastResultSet,
+															request->cancellable,
+															_xfdashboard_search_view_on_provider_result_set_ready,
+															request);
+	}
+	g_list_free_full(providers, (GDestroyNotify)_xfdashboard_search_view_provider_data_unref);
+
+	/* Remember new search terms as last one */
+	if(priv->lastTerms) _xfdashboard_search_view_search_terms_unref(priv->lastTerms);
+	priv->lastTerms=_xfdashboard_search_view_search_terms_ref(inSearchTerms);
+
+	/* If there is no search provider to wait for the search is done */
+	if(priv->pendingProvidersCount==0) _xfdashboard_search_view_finish_search(self);
 }
 
 /* Delay timeout was reached so perform initial search now */
@@ -964,22 +1261,14 @@ static gboolean _xfdashboard_search_view_on_perform_search_delayed_timeout(gpoin
 {
 	XfdashboardSearchView						*self;
 	XfdashboardSearchViewPrivate				*priv;
-	guint										numberResults;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_SEARCH_VIEW(inUserData), G_SOURCE_REMOVE);
 
 	self=XFDASHBOARD_SEARCH_VIEW(inUserData);
 	priv=self->priv;
 
-	/* Perform search */
-	numberResults=_xfdashboard_search_view_perform_search(self, priv->delaySearchTerms);
-	if(numberResults==0)
-	{
-		xfdashboard_notify(CLUTTER_ACTOR(self),
-							xfdashboard_view_get_icon(XFDASHBOARD_VIEW(self)),
-							_("No results found for '%s'"),
-							priv->delaySearchTerms->termString);
-	}
+	/* Perform search and notify if no results were found */
+	_xfdashboard_search_view_perform_search(self, priv->delaySearchTerms, TRUE);
 
 	/* Release allocated resources */
 	if(priv->delaySearchTerms)
@@ -1612,6 +1901,8 @@ static void _xfdashboard_search_view_dispose(GObject *inObject)
 		priv->searchManager=NULL;
 	}
 
+	_xfdashboard_search_view_cancel_search(self);
+
 	if(priv->providers)
 	{
 		g_list_free_full(priv->providers, (GDestroyNotify)_xfdashboard_search_view_provider_data_unref);
@@ -1707,6 +1998,13 @@ static void xfdashboard_search_view_init(XfdashboardSearchView *self)
 	priv->searchManager=xfdashboard_search_manager_get_default();
 	priv->providers=NULL;
 	priv->lastTerms=NULL;
+	priv->fullSearchCount=0;
+	priv->incrementalSearchCount=0;
+	priv->pendingTerms=NULL;
+	priv->pendingProvidersCount=0;
+	priv->pendingResultsCount=0;
+	priv->pendingNotifyNoResults=FALSE;
+	priv->pendingTimer=NULL;
 	priv->delaySearch=TRUE;
 	priv->delaySearchTerms=NULL;
 	priv->delaySearchTimeoutID=0;
@@ -1778,6 +2076,9 @@ void xfdashboard_search_view_reset_search(XfdashboardSearchView *self)
 		priv->delaySearchTimeoutID=0;
 	}
 
+	/* Cancel pending searches */
+	_xfdashboard_search_view_cancel_search(self);
+
 	/* Reset all search providers by destroying actors, destroying containers,
 	 * clearing mappings and release all other allocated resources used.
 	 */
@@ -1902,7 +2203,7 @@ void xfdashboard_search_view_update_search(XfdashboardSearchView *self, const gc
 		/* ... otherwise perform search immediately */
 		else
 		{
-			_xfdashboard_search_view_perform_search(self, searchTerms);
+			_xfdashboard_search_view_perform_search(self, searchTerms, FALSE);
 		}
 
 	/* Release allocated resources */
@@ -104,6 +104,92 @@ static gboolean _xfdashboard_stylable_list_contains(const gchar *inNeedle,
 	return(FALSE);
 }
 
+/* Quark set of classes or pseudo-classes cached at stylable object */
+typedef struct _XfdashboardStylableQuarks		XfdashboardStylableQuarks;
+struct _XfdashboardStylableQuarks
+{
+	gchar					*list;
+	GQuark					*quarks;
+};
+
+#define XFDASHBOARD_STYLABLE_CLASS_QUARKS			(_xfdashboard_stylable_class_quarks_quark())
+#define XFDASHBOARD_STYLABLE_PSEUDO_CLASS_QUARKS	(_xfdashboard_stylable_pseudo_class_quarks_quark())
+
+static GQuark _xfdashboard_stylable_class_quarks_quark(void)
+{
+	return(g_quark_from_static_string("xfdashboard-stylable-class-quarks-quark"));
+}
+
+static GQuark _xfdashboard_stylable_pseudo_class_quarks_quark(void)
+{
+	return(g_quark_from_static_string("xfdashboard-stylable-pseudo-class-quarks-quark"));
+}
+
+/* Free cached quark set */
+static void _xfdashboard_stylable_quarks_free(XfdashboardStylableQuarks *inData)
+{
+	g_return_if_fail(inData);
+
+	if(inData->list) g_free(inData->list);
+	if(inData->quarks) g_free(inData->quarks);
+	g_slice_free(XfdashboardStylableQuarks, inData);
+}
+
+/* Get quark set for a string representing a list which entries are seperated
+ * by a seperator character. The quark set is cached at stylable object and
+ * only rebuilt if the list changed.
+ */
+static const GQuark* _xfdashboard_stylable_get_quarks_cached(XfdashboardStylable *self,
+																GQuark inCacheQuark,
+																const gchar *inList,
+																gchar inSeperator)
+{
+	XfdashboardStylableQuarks	*data;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_STYLABLE(self), NULL);
+
+	/* No list means an empty quark set */
+	if(!inList) return(NULL);
+
+	/* Return cached quark set if it was built for the same list */
+	data=(XfdashboardStylableQuarks*)g_object_get_qdata(G_OBJECT(self), inCacheQuark);
+	if(data && g_strcmp0(data->list, inList)==0) return(data->quarks);
+
+	/* Build quark set and cache it at stylable object */
+	data=g_slice_new0(XfdashboardStylableQuarks);
+	data->list=g_strdup(inList);
+	data->quarks=xfdashboard_stylable_build_quark_list(inList, inSeperator, NULL);
+
+	g_object_set_qdata_full(G_OBJECT(self),
+							inCacheQuark,
+							data,
+							(GDestroyNotify)_xfdashboard_stylable_quarks_free);
+
+	return(data->quarks);
+}
+
+/* Default implementation of virtual function "get_class_quarks" */
+static const GQuark* _xfdashboard_stylable_real_get_class_quarks(XfdashboardStylable *self)
+{
+	g_return_val_if_fail(XFDASHBOARD_IS_STYLABLE(self), NULL);
+
+	return(_xfdashboard_stylable_get_quarks_cached(self,
+													XFDASHBOARD_STYLABLE_CLASS_QUARKS,
+													xfdashboard_stylable_get_classes(self),
+													'.'));
+}
+
+/* Default implementation of virtual function "get_pseudo_class_quarks" */
+static const GQuark* _xfdashboard_stylable_real_get_pseudo_class_quarks(XfdashboardStylable *self)
+{
+	g_return_val_if_fail(XFDASHBOARD_IS_STYLABLE(self), NULL);
+
+	return(_xfdashboard_stylable_get_quarks_cached(self,
+													XFDASHBOARD_STYLABLE_PSEUDO_CLASS_QUARKS,
+													xfdashboard_stylable_get_pseudo_classes(self),
+													':'));
+}
+
 /* Default implementation of virtual function "get_name" */
 static const gchar* _xfdashboard_stylable_real_get_name(XfdashboardStylable *self)
 {
@@ -248,7 +334,7 @@ static void _xfdashboard_stylable_real_invalidate(XfdashboardStylable *self)
 	g_object_thaw_notify(G_OBJECT(self));
 
 	/* Release allocated resources */
-	g_hash_table_destroy(themeStyleSet);
+	g_hash_table_unref(themeStyleSet);
 	g_hash_table_destroy(stylableProperties);
 
 	/* Emit 'style-revalidated' signal to notify other objects about it's done */
@@ -278,6 +364,8 @@ void xfdashboard_stylable_default_init(XfdashboardStylableInterface *iface)
 	iface->get_name=_xfdashboard_stylable_real_get_name;
 	iface->get_parent=_xfdashboard_stylable_real_get_parent;
 	iface->invalidate=_xfdashboard_stylable_real_invalidate;
+	iface->get_class_quarks=_xfdashboard_stylable_real_get_class_quarks;
+	iface->get_pseudo_class_quarks=_xfdashboard_stylable_real_get_pseudo_class_quarks;
 
 	/* Define properties, signals and actions */
 	if(!initialized)
@@ -571,6 +659,30 @@ void xfdashboard_stylable_remove_class(XfdashboardStylable *self, const gchar *i
 	}
 }
 
+/* Call virtual function "get_class_quarks".
+ * The returned zero-terminated array of quarks is owned by the stylable and
+ * is only valid until the classes of stylable change. NULL is returned if
+ * no class is set.
+ */
+const GQuark* xfdashboard_stylable_get_class_quarks(XfdashboardStylable *self)
+{
+	XfdashboardStylableInterface		*iface;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_STYLABLE(self), NULL);
+
+	iface=XFDASHBOARD_STYLABLE_GET_IFACE(self);
+
+	/* Call virtual function */
+	if(iface->get_class_quarks)
+	{
+		return(iface->get_class_quarks(self));
+	}
+
+	/* If we get here the virtual function was not overridden */
+	XFDASHBOARD_STYLABLE_WARN_NOT_IMPLEMENTED(self, "get_class_quarks");
+	return(NULL);
+}
+
 /* Call virtual function "get_pseudo_classes" */
 const gchar* xfdashboard_stylable_get_pseudo_classes(XfdashboardStylable *self)
 {
@@ -715,6 +827,65 @@ void xfdashboard_stylable_remove_pseudo_class(XfdashboardStylable *self, const g
 	}
 }
 
+/* Call virtual function "get_pseudo_class_quarks".
+ * The returned zero-terminated array of quarks is owned by the stylable and
+ * is only valid until the pseudo-classes of stylable change. NULL is returned
+ * if no pseudo-class is set.
+ */
+const GQuark* xfdashboard_stylable_get_pseudo_class_quarks(XfdashboardStylable *self)
+{
+	XfdashboardStylableInterface		*iface;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_STYLABLE(self), NULL);
+
+	iface=XFDASHBOARD_STYLABLE_GET_IFACE(self);
+
+	/* Call virtual function */
+	if(iface->get_pseudo_class_quarks)
+	{
+		return(iface->get_pseudo_class_quarks(self));
+	}
+
+	/* If we get here the virtual function was not overridden */
+	XFDASHBOARD_STYLABLE_WARN_NOT_IMPLEMENTED(self, "get_pseudo_class_quarks");
+	return(NULL);
+}
+
+/* Build zero-terminated array of quarks for a string representing a list
+ * which entries are seperated by a seperator character, e.g. classes or
+ * pseudo-classes. Empty entries are skipped. Returns NULL if list is NULL,
+ * otherwise free returned array with g_free(). If a pointer is given for
+ * count it is set to number of quarks in array.
+ */
+GQuark* xfdashboard_stylable_build_quark_list(const gchar *inList, gchar inSeperator, guint *outCount)
+{
+	GQuark					*quarks;
+	gchar					delimiter[2];
+	gchar					**entries;
+	gchar					**iter;
+	guint					count;
+
+	if(outCount) *outCount=0;
+
+	if(!inList) return(NULL);
+
+	delimiter[0]=inSeperator;
+	delimiter[1]=0;
+	entries=g_strsplit(inList, delimiter, -1);
+
+	quarks=g_new0(GQuark, g_strv_length(entries)+1);
+	for(count=0, iter=entries; *iter; iter++)
+	{
+		if(**iter) quarks[count++]=g_quark_from_string(*iter);
+	}
+
+	g_strfreev(entries);
+
+	if(outCount) *outCount=count;
+
+	return(quarks);
+}
+
 /* Call virtual function "invalidate" */
 void xfdashboard_stylable_invalidate(XfdashboardStylable *self)
 {
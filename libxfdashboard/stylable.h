@@ -62,6 +62,9 @@ struct _XfdashboardStylableInterface
 	void (*set_pseudo_classes)(XfdashboardStylable *self, const gchar *inClasses);
 
 	void (*invalidate)(XfdashboardStylable *self);
+
+	const GQuark* (*get_class_quarks)(XfdashboardStylable *self);
+	const GQuark* (*get_pseudo_class_quarks)(XfdashboardStylable *self);
 };
 
 /* Public API */
@@ -81,12 +84,16 @@ void xfdashboard_stylable_set_classes(XfdashboardStylable *self, const gchar *in
 gboolean xfdashboard_stylable_has_class(XfdashboardStylable *self, const gchar *inClass);
 void xfdashboard_stylable_add_class(XfdashboardStylable *self, const gchar *inClass);
 void xfdashboard_stylable_remove_class(XfdashboardStylable *self, const gchar *inClass);
+const GQuark* xfdashboard_stylable_get_class_quarks(XfdashboardStylable *self);
 
 const gchar* xfdashboard_stylable_get_pseudo_classes(XfdashboardStylable *self);
 void xfdashboard_stylable_set_pseudo_classes(XfdashboardStylable *self, const gchar *inClasses);
 gboolean xfdashboard_stylable_has_pseudo_class(XfdashboardStylable *self, const gchar *inClass);
 void xfdashboard_stylable_add_pseudo_class(XfdashboardStylable *self, const gchar *inClass);
 void xfdashboard_stylable_remove_pseudo_class(XfdashboardStylable *self, const gchar *inClass);
+const GQuark* xfdashboard_stylable_get_pseudo_class_quarks(XfdashboardStylable *self);
+
+GQuark* xfdashboard_stylable_build_quark_list(const gchar *inList, gchar inSeperator, guint *outCount);
 
 void xfdashboard_stylable_invalidate(XfdashboardStylable *self);
 
@@ -60,6 +60,21 @@ struct _XfdashboardThemeCSSPrivate
 	GList		*styles;
 	GSList		*names;
 
+	GHashTable	*selectorsByID;
+	GHashTable	*selectorsByClass;
+	GHashTable	*selectorsByType;
+	GPtrArray	*selectorsUniversal;
+	guint		selectorsCount;
+	GHashTable	*ancestorSelectorsByID;
+	GHashTable	*ancestorSelectorsByClass;
+	GHashTable	*ancestorSelectorsByType;
+	guint		ancestorSelectorsUniversal;
+	guint		lookupStamp;
+
+	GHashTable	*styleCache;
+	guint		styleCacheHits;
+	guint		styleCacheMisses;
+
 	GHashTable	*registeredFunctions;
 
 	gint		offsetLine;
@@ -91,6 +106,7 @@ struct _XfdashboardThemeCSSSelector
 	XfdashboardThemeCSSSelectorType	type;
 	XfdashboardCssSelector			*selector;
 	GHashTable						*style;
+	guint							lookupStamp;
 };
 
 typedef struct _XfdashboardThemeCSSSelectorMatch	XfdashboardThemeCSSSelectorMatch;
@@ -181,7 +197,7 @@ static void _xfdashboard_theme_css_copy_table(gpointer *inKey, gpointer *inValue
 	value->source=inData->name;
 	value->string=(gchar*)inValue;
 
-	g_hash_table_insert(inData->table, inKey, value);
+	g_hash_table_insert(inData->table, g_strdup((const gchar*)inKey), value);
 }
 
 /* Free selector match */
@@ -246,10 +262,168 @@ static XfdashboardThemeCSSSelector* _xfdashboard_theme_css_selector_new(const gc
 
 	selector=g_slice_new0(XfdashboardThemeCSSSelector);
 	selector->type=XFDASHBOARD_THEME_CSS_SELECTOR_TYPE_NONE;
+	selector->lookupStamp=0;
   
 	return(selector);
 }
 
+/* Add selector to bucket of given key in hash-table of buckets */
+static void _xfdashboard_theme_css_add_selector_to_bucket(GHashTable *ioBuckets,
+															const gchar *inKey,
+															XfdashboardThemeCSSSelector *inSelector)
+{
+	GPtrArray						*bucket;
+
+	g_return_if_fail(ioBuckets);
+	g_return_if_fail(inKey && *inKey);
+	g_return_if_fail(inSelector);
+
+	/* Get bucket for key and create it if it does not exist yet */
+	bucket=(GPtrArray*)g_hash_table_lookup(ioBuckets, inKey);
+	if(!bucket)
+	{
+		bucket=g_ptr_array_new();
+		g_hash_table_insert(ioBuckets, g_strdup(inKey), bucket);
+	}
+
+	/* Add selector to bucket */
+	g_ptr_array_add(bucket, inSelector);
+}
+
+/* Index selector by its rightmost rule, i.e. the rule which must match the
+ * stylable itself, so only selectors which can match a stylable at all need
+ * to be scored when looking up properties. Each selector is added to exactly
+ * one bucket which is the most specific one: ID, then first class, then type.
+ * Selectors without any of them (universal ones) must be scored every time.
+ * The keys of buckets containing selectors with parent or ancestor rules are
+ * remembered also to determine quickly if a stylable's style may depend on
+ * its ancestors.
+ */
+static void _xfdashboard_theme_css_index_selector(XfdashboardThemeCSS *self,
+													XfdashboardThemeCSSSelector *inSelector)
+{
+	XfdashboardThemeCSSPrivate		*priv;
+	XfdashboardCssSelectorRule		*rule;
+	const gchar						*id;
+	const gchar						*classes;
+	const gchar						*type;
+	gboolean						hasAncestorRule;
+	GHashTable						*buckets;
+	GHashTable						*ancestorKeys;
+	gchar							*key;
+
+	g_return_if_fail(XFDASHBOARD_IS_THEME_CSS(self));
+	g_return_if_fail(inSelector);
+
+	priv=self->priv;
+	buckets=NULL;
+	ancestorKeys=NULL;
+	key=NULL;
+
+	/* Only real selectors can be matched against stylables */
+	if(inSelector->type!=XFDASHBOARD_THEME_CSS_SELECTOR_TYPE_SELECTOR) return;
+
+	rule=xfdashboard_css_selector_get_rule(inSelector->selector);
+	if(!rule) return;
+
+	id=xfdashboard_css_selector_rule_get_id(rule);
+	classes=xfdashboard_css_selector_rule_get_classes(rule);
+	type=xfdashboard_css_selector_rule_get_type(rule);
+	hasAncestorRule=(xfdashboard_css_selector_rule_get_parent(rule) ||
+						xfdashboard_css_selector_rule_get_ancestor(rule));
+
+	if(id)
+	{
+		buckets=priv->selectorsByID;
+		ancestorKeys=priv->ancestorSelectorsByID;
+		key=g_strdup(id);
+	}
+		else if(classes)
+		{
+			const gchar				*nextClass;
+
+			buckets=priv->selectorsByClass;
+			ancestorKeys=priv->ancestorSelectorsByClass;
+
+			nextClass=strchr(classes, '.');
+			if(nextClass) key=g_strndup(classes, nextClass-classes);
+				else key=g_strdup(classes);
+		}
+		else if(type && type[0]!='*')
+		{
+			buckets=priv->selectorsByType;
+			ancestorKeys=priv->ancestorSelectorsByType;
+			key=g_strdup(type);
+		}
+
+	if(buckets)
+	{
+		_xfdashboard_theme_css_add_selector_to_bucket(buckets, key, inSelector);
+
+		if(hasAncestorRule &&
+			!g_hash_table_contains(ancestorKeys, key))
+		{
+			g_hash_table_add(ancestorKeys, g_strdup(key));
+		}
+
+		g_free(key);
+	}
+		else
+		{
+			g_ptr_array_add(priv->selectorsUniversal, inSelector);
+			if(hasAncestorRule) priv->ancestorSelectorsUniversal++;
+		}
+
+	priv->selectorsCount++;
+}
+
+/* Score all selectors in bucket against stylable which were not scored
+ * in current lookup yet and collect the matching ones.
+ */
+static void _xfdashboard_theme_css_collect_matches(XfdashboardThemeCSS *self,
+													GPtrArray *inBucket,
+													XfdashboardStylable *inStylable,
+													GList **ioMatches,
+													guint *ioScored)
+{
+	XfdashboardThemeCSSPrivate			*priv;
+	XfdashboardThemeCSSSelector			*selector;
+	XfdashboardThemeCSSSelectorMatch	*match;
+	gint								score;
+	guint								i;
+
+	g_return_if_fail(XFDASHBOARD_IS_THEME_CSS(self));
+	g_return_if_fail(XFDASHBOARD_IS_STYLABLE(inStylable));
+	g_return_if_fail(ioMatches);
+	g_return_if_fail(ioScored);
+
+	priv=self->priv;
+
+	/* Empty or non-existing buckets have nothing to score */
+	if(!inBucket) return;
+
+	for(i=0; i<inBucket->len; i++)
+	{
+		selector=(XfdashboardThemeCSSSelector*)g_ptr_array_index(inBucket, i);
+
+		/* Skip selector if it was already scored in this lookup */
+		if(selector->lookupStamp==priv->lookupStamp) continue;
+		selector->lookupStamp=priv->lookupStamp;
+
+		/* Score selector and remember it if it matches */
+		score=xfdashboard_css_selector_score(selector->selector, inStylable);
+		(*ioScored)++;
+
+		if(score>=0)
+		{
+			match=g_slice_new(XfdashboardThemeCSSSelectorMatch);
+			match->selector=selector;
+			match->score=score;
+			*ioMatches=g_list_prepend(*ioMatches, match);
+		}
+	}
+}
+
 /* Get function argument and transform it to requested type.
  * Returned value must first be cleared with g_value_unset and
  * then freed with g_free.
@@ -2539,6 +2713,54 @@ static void _xfdashboard_theme_css_dispose(GObject *inObject)
 		priv->registeredFunctions=NULL;
 	}
 
+	if(priv->selectorsByID)
+	{
+		g_hash_table_unref(priv->selectorsByID);
+		priv->selectorsByID=NULL;
+	}
+
+	if(priv->selectorsByClass)
+	{
+		g_hash_table_unref(priv->selectorsByClass);
+		priv->selectorsByClass=NULL;
+	}
+
+	if(priv->selectorsByType)
+	{
+		g_hash_table_unref(priv->selectorsByType);
+		priv->selectorsByType=NULL;
+	}
+
+	if(priv->selectorsUniversal)
+	{
+		g_ptr_array_unref(priv->selectorsUniversal);
+		priv->selectorsUniversal=NULL;
+	}
+
+	if(priv->styleCache)
+	{
+		g_hash_table_unref(priv->styleCache);
+		priv->styleCache=NULL;
+	}
+
+	if(priv->ancestorSelectorsByID)
+	{
+		g_hash_table_unref(priv->ancestorSelectorsByID);
+		priv->ancestorSelectorsByID=NULL;
+	}
+
+	if(priv->ancestorSelectorsByClass)
+	{
+		g_hash_table_unref(priv->ancestorSelectorsByClass);
+		priv->ancestorSelectorsByClass=NULL;
+	}
+
+	if(priv->ancestorSelectorsByType)
+	{
+		g_hash_table_unref(priv->ancestorSelectorsByType);
+		priv->ancestorSelectorsByType=NULL;
+	}
+
 	/* Call parent's class dispose method */
 	G_OBJECT_CLASS(xfdashboard_theme_css_parent_class)->dispose(inObject);
 }
@@ -2612,6 +2834,19 @@ void xfdashboard_theme_css_init(XfdashboardThemeCSS *self)
 	priv->names=NULL;
 	priv->registeredFunctions=NULL;
 	priv->offsetLine=0;
+	priv->selectorsByID=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, (GDestroyNotify)g_ptr_array_unref);
+	priv->selectorsByClass=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, (GDestroyNotify)g_ptr_array_unref);
+	priv->selectorsByType=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, (GDestroyNotify)g_ptr_array_unref);
+	priv->selectorsUniversal=g_ptr_array_new();
+	priv->selectorsCount=0;
+	priv->lookupStamp=0;
+	priv->ancestorSelectorsByID=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+	priv->ancestorSelectorsByClass=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+	priv->ancestorSelectorsByType=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+	priv->ancestorSelectorsUniversal=0;
+	priv->styleCache=g_hash_table_new_full(g_str_hash, g_str_equal, g_free, (GDestroyNotify)g_hash_table_unref);
+	priv->styleCacheHits=0;
+	priv->styleCacheMisses=0;
 
 	/* Register CSS functions */
 #define REGISTER_CSS_FUNC(name, callback) \
@@ -2717,8 +2952,20 @@ gboolean xfdashboard_theme_css_add_file(XfdashboardThemeCSS *self,
 	 */
 	priv->names=g_slist_prepend(priv->names, strdup(inPath));
 
+	/* Styles computed so far may be affected by the new selectors so
+	 * flush cache of computed styles.
+	 */
+	g_hash_table_remove_all(priv->styleCache);
+
 	if(selectors)
 	{
+		GList						*iter;
+
+		for(iter=selectors; iter; iter=g_list_next(iter))
+		{
+			_xfdashboard_theme_css_index_selector(self, (XfdashboardThemeCSSSelector*)iter->data);
+		}
+
 		priv->selectors=g_list_concat(priv->selectors, selectors);
 		XFDASHBOARD_DEBUG(self, THEME,
 							"Successfully parsed '%s' and added %d selectors - total %d selectors",
@@ -2743,14 +2990,315 @@ gboolean xfdashboard_theme_css_add_file(XfdashboardThemeCSS *self,
 	return(TRUE);
 }
 
-/* Return properties for a stylable actor */
-GHashTable* xfdashboard_theme_css_get_properties(XfdashboardThemeCSS *self,
-													XfdashboardStylable *inStylable)
+/* Get serialized form of all selectors, styles and names of loaded files of
+ * this theme CSS. All '@' identifiers were already resolved when the files
+ * were parsed so the serialized form can be added to a new theme CSS instance
+ * with xfdashboard_theme_css_add_from_variant() without parsing any file again.
+ * The returned variant is floating.
+ */
+GVariant* xfdashboard_theme_css_to_variant(XfdashboardThemeCSS *self)
+{
+	XfdashboardThemeCSSPrivate		*priv;
+	GVariantBuilder					selectorsBuilder;
+	GVariantBuilder					stylesBuilder;
+	GVariantBuilder					namesBuilder;
+	GHashTable						*styleIndices;
+	GList							*iter;
+	GSList							*namesIter;
+	guint							index;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_THEME_CSS(self), NULL);
+
+	priv=self->priv;
+
+	/* Add styles and remember their index as selectors refer to them by index */
+	styleIndices=g_hash_table_new(g_direct_hash, g_direct_equal);
+
+	g_variant_builder_init(&stylesBuilder, G_VARIANT_TYPE("aa{ss}"));
+	for(index=0, iter=priv->styles; iter; iter=g_list_next(iter), index++)
+	{
+		GHashTable					*style;
+		GHashTableIter				styleIter;
+		const gchar					*key;
+		const gchar					*value;
+
+		style=(GHashTable*)iter->data;
+		g_hash_table_insert(styleIndices, style, GUINT_TO_POINTER(index));
+
+		g_variant_builder_open(&stylesBuilder, G_VARIANT_TYPE("a{ss}"));
+
+		g_hash_table_iter_init(&styleIter, style);
+		while(g_hash_table_iter_next(&styleIter, (gpointer*)&key, (gpointer*)&value))
+		{
+			g_variant_builder_add(&stylesBuilder, "{ss}", key, value ? value : "");
+		}
+
+		g_variant_builder_close(&stylesBuilder);
+	}
+
+	/* Add selectors */
+	g_variant_builder_init(&selectorsBuilder, G_VARIANT_TYPE("a(umvu)"));
+	for(iter=priv->selectors; iter; iter=g_list_next(iter))
+	{
+		XfdashboardThemeCSSSelector	*selector;
+		GVariant					*selectorVariant;
+
+		selector=(XfdashboardThemeCSSSelector*)iter->data;
+
+		selectorVariant=NULL;
+		if(selector->selector) selectorVariant=xfdashboard_css_selector_to_variant(selector->selector);
+
+		g_variant_builder_add(&selectorsBuilder,
+								"(umvu)",
+								(guint)selector->type,
+								selectorVariant,
+								GPOINTER_TO_UINT(g_hash_table_lookup(styleIndices, selector->style)));
+	}
+
+	/* Add names of loaded files */
+	g_variant_builder_init(&namesBuilder, G_VARIANT_TYPE("as"));
+	for(namesIter=priv->names; namesIter; namesIter=g_slist_next(namesIter))
+	{
+		g_variant_builder_add(&namesBuilder, "s", (const gchar*)namesIter->data);
+	}
+
+	/* Release allocated resources */
+	g_hash_table_destroy(styleIndices);
+
+	/* Return serialized form */
+	return(g_variant_new("(a(umvu)aa{ss}asi)",
+							&selectorsBuilder,
+							&stylesBuilder,
+							&namesBuilder,
+							priv->offsetLine));
+}
+
+/* Add selectors, styles and names of loaded files from serialized form
+ * created by xfdashboard_theme_css_to_variant() to this theme CSS.
+ */
+gboolean xfdashboard_theme_css_add_from_variant(XfdashboardThemeCSS *self,
+													GVariant *inVariant,
+													GError **outError)
+{
+	XfdashboardThemeCSSPrivate		*priv;
+	GVariant						*selectorsVariant;
+	GVariant						*stylesVariant;
+	GVariant						*namesVariant;
+	gint							offsetLine;
+	GPtrArray						*styles;
+	GList							*selectors;
+	GSList							*names;
+	GVariantIter					iter;
+	GVariantIter					*styleIter;
+	guint							selectorType;
+	GVariant						*selectorVariant;
+	guint							styleIndex;
+	const gchar						*key;
+	const gchar						*value;
+	gboolean						success;
+	guint							i;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_THEME_CSS(self), FALSE);
+	g_return_val_if_fail(inVariant, FALSE);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
+
+	priv=self->priv;
+	selectors=NULL;
+	names=NULL;
+	success=TRUE;
+
+	/* Check that variant is a serialized theme CSS */
+	if(!g_variant_is_of_type(inVariant, G_VARIANT_TYPE("(a(umvu)aa{ss}asi)")))
+	{
+		_xfdashboard_theme_css_set_error(self,
+											outError,
+											XFDASHBOARD_THEME_CSS_ERROR_INVALID_ARGUMENT,
+											_("The variant of type %s is not supported"),
+											g_variant_get_type_string(inVariant));
+		return(FALSE);
+	}
+
+	g_variant_get(inVariant,
+					"(@a(umvu)@aa{ss}@asi)",
+					&selectorsVariant,
+					&stylesVariant,
+					&namesVariant,
+					&offsetLine);
+
+	/* Rebuild styles */
+	styles=g_ptr_array_new_with_free_func((GDestroyNotify)g_hash_table_unref);
+
+	g_variant_iter_init(&iter, stylesVariant);
+	while(g_variant_iter_next(&iter, "a{ss}", &styleIter))
+	{
+		GHashTable					*style;
+
+		style=g_hash_table_new_full(g_str_hash,
+									g_str_equal,
+									g_free,
+									(GDestroyNotify)g_free);
+
+		while(g_variant_iter_next(styleIter, "{&s&s}", &key, &value))
+		{
+			g_hash_table_insert(style, g_strdup(key), g_strdup(value));
+		}
+
+		g_variant_iter_free(styleIter);
+		g_ptr_array_add(styles, style);
+	}
+
+	/* Rebuild selectors and assign their styles */
+	g_variant_iter_init(&iter, selectorsVariant);
+	while(success &&
+			g_variant_iter_next(&iter, "(umvu)", &selectorType, &selectorVariant, &styleIndex))
+	{
+		XfdashboardThemeCSSSelector	*selector;
+
+		selector=_xfdashboard_theme_css_selector_new(NULL);
+		selector->type=selectorType;
+		selectors=g_list_prepend(selectors, selector);
+
+		if(selectorVariant)
+		{
+			selector->selector=xfdashboard_css_selector_new_from_variant(selectorVariant);
+			g_variant_unref(selectorVariant);
+		}
+
+		if(styleIndex>=styles->len ||
+			(selector->type==XFDASHBOARD_THEME_CSS_SELECTOR_TYPE_SELECTOR && !selector->selector))
+		{
+			_xfdashboard_theme_css_set_error(self,
+												outError,
+												XFDASHBOARD_THEME_CSS_ERROR_INVALID_ARGUMENT,
+												_("Invalid selector in variant"));
+			success=FALSE;
+			break;
+		}
+
+		selector->style=g_hash_table_ref((GHashTable*)g_ptr_array_index(styles, styleIndex));
+	}
+	selectors=g_list_reverse(selectors);
+
+	/* Get names of loaded files */
+	g_variant_iter_init(&iter, namesVariant);
+	while(g_variant_iter_next(&iter, "&s", &value))
+	{
+		names=g_slist_prepend(names, g_strdup(value));
+	}
+	names=g_slist_reverse(names);
+
+	/* Add selectors, styles and names to this theme CSS if they were valid */
+	if(success)
+	{
+		priv->names=g_slist_concat(priv->names, names);
+		names=NULL;
+
+		/* Styles computed so far may be affected by the new selectors so
+		 * flush cache of computed styles.
+		 */
+		g_hash_table_remove_all(priv->styleCache);
+
+		for(i=0; i<styles->len; i++)
+		{
+			priv->styles=g_list_append(priv->styles, g_hash_table_ref((GHashTable*)g_ptr_array_index(styles, i)));
+		}
+
+		if(selectors)
+		{
+			GList					*selectorIter;
+
+			for(selectorIter=selectors; selectorIter; selectorIter=g_list_next(selectorIter))
+			{
+				_xfdashboard_theme_css_index_selector(self, (XfdashboardThemeCSSSelector*)selectorIter->data);
+			}
+
+			priv->selectors=g_list_concat(priv->selectors, selectors);
+			selectors=NULL;
+		}
+
+		priv->offsetLine+=offsetLine;
+
+		XFDASHBOARD_DEBUG(self, THEME,
+							"Successfully added %u styles from variant - total %d selectors",
+							styles->len,
+							g_list_length(priv->selectors));
+	}
+
+	/* Release allocated resources */
+	if(selectors)
+	{
+		g_list_foreach(selectors, (GFunc)_xfdashboard_theme_css_selector_free, NULL);
+		g_list_free(selectors);
+	}
+	if(names) g_slist_free_full(names, g_free);
+	g_ptr_array_unref(styles);
+	g_variant_unref(selectorsVariant);
+	g_variant_unref(stylesVariant);
+	g_variant_unref(namesVariant);
+
+	return(success);
+}
+
+/* Get list of paths of all CSS files loaded including imported ones.
+ * The returned list is owned by this theme CSS and must not be modified or freed.
+ */
+const GSList* xfdashboard_theme_css_get_files(XfdashboardThemeCSS *self)
+{
+	g_return_val_if_fail(XFDASHBOARD_IS_THEME_CSS(self), NULL);
+
+	return(self->priv->names);
+}
+
+/* Build signature of stylable which consists of type, ID, classes and
+ * pseudo-classes of stylable and all its stylable parents. Stylables with the
+ * same signature are matched by exactly the same selectors.
+ */
+static gchar* _xfdashboard_theme_css_get_stylable_signature(XfdashboardStylable *inStylable)
+{
+	GString							*signature;
+	XfdashboardStylable				*stylable;
+	const gchar						*value;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_STYLABLE(inStylable), NULL);
+
+	signature=g_string_sized_new(256);
+
+	for(stylable=inStylable; stylable; stylable=xfdashboard_stylable_get_parent(stylable))
+	{
+		/* Separate this node from its child */
+		if(stylable!=inStylable) g_string_append_c(signature, '\x1e');
+
+		/* Add type, ID, classes and pseudo-classes of this node */
+		g_string_append(signature, G_OBJECT_TYPE_NAME(stylable));
+
+		g_string_append_c(signature, '\x1f');
+		value=xfdashboard_stylable_get_name(stylable);
+		if(value) g_string_append(signature, value);
+
+		g_string_append_c(signature, '\x1f');
+		value=xfdashboard_stylable_get_classes(stylable);
+		if(value) g_string_append(signature, value);
+
+		g_string_append_c(signature, '\x1f');
+		value=xfdashboard_stylable_get_pseudo_classes(stylable);
+		if(value) g_string_append(signature, value);
+	}
+
+	return(g_string_free(signature, FALSE));
+}
+
+/* Find matching selectors for a stylable and build set of properties */
+static GHashTable* _xfdashboard_theme_css_build_properties(XfdashboardThemeCSS *self,
+															XfdashboardStylable *inStylable)
 {
 	XfdashboardThemeCSSPrivate			*priv;
 	GList								*entry, *matches;
 	XfdashboardThemeCSSSelectorMatch	*match;
 	GHashTable							*result;
+	const gchar							*id;
+	const gchar							*classes;
+	GType								type;
+	guint								scored;
 #ifdef DEBUG
 	GTimer								*timer=NULL;
 	const gchar							*styleID;
@@ -2787,26 +3335,79 @@ GHashTable* xfdashboard_theme_css_get_properties(XfdashboardThemeCSS *self,
 	timer=g_timer_new();
 #endif
 
-	/* Find and collect matching selectors */
-	for(entry=priv->selectors; entry; entry=g_list_next(entry))
+	/* Find and collect matching selectors. Only the selectors in buckets
+	 * matching the stylable's ID, classes or types and the universal ones
+	 * can match so score only those candidates.
+	 */
+	priv->lookupStamp++;
+	scored=0;
+
+	id=xfdashboard_stylable_get_name(inStylable);
+	if(id)
+	{
+		_xfdashboard_theme_css_collect_matches(self,
+												(GPtrArray*)g_hash_table_lookup(priv->selectorsByID, id),
+												inStylable,
+												&matches,
+												&scored);
+	}
+
+	classes=xfdashboard_stylable_get_classes(inStylable);
+	if(classes)
 	{
-		gint							score;
-		XfdashboardThemeCSSSelector		*selector;
+		gchar							**classList;
+		gchar							**iter;
 
-		selector=(XfdashboardThemeCSSSelector*)entry->data;
-		if(selector->type==XFDASHBOARD_THEME_CSS_SELECTOR_TYPE_SELECTOR)
+		classList=g_strsplit(classes, ".", -1);
+		for(iter=classList; *iter; iter++)
 		{
-			score=xfdashboard_css_selector_score(selector->selector, inStylable);
-			if(score>=0)
-			{
-				match=g_slice_new(XfdashboardThemeCSSSelectorMatch);
-				match->selector=entry->data;
-				match->score=score;
-				matches=g_list_prepend(matches, match);
-			}
+			if(!**iter) continue;
+
+			_xfdashboard_theme_css_collect_matches(self,
+													(GPtrArray*)g_hash_table_lookup(priv->selectorsByClass, *iter),
+													inStylable,
+													&matches,
+													&scored);
+		}
+		g_strfreev(classList);
+	}
+
+	if(g_hash_table_size(priv->selectorsByType)>0)
+	{
+		GType							*interfaces;
+		guint							numberInterfaces;
+		guint							i;
+
+		/* A type selector matches the stylable's type, any of its parent
+		 * types and any interface implemented by it.
+		 */
+		for(type=G_OBJECT_TYPE(inStylable); type; type=g_type_parent(type))
+		{
+			_xfdashboard_theme_css_collect_matches(self,
+													(GPtrArray*)g_hash_table_lookup(priv->selectorsByType, g_type_name(type)),
+													inStylable,
+													&matches,
+													&scored);
+		}
+
+		interfaces=g_type_interfaces(G_OBJECT_TYPE(inStylable), &numberInterfaces);
+		for(i=0; i<numberInterfaces; i++)
+		{
+			_xfdashboard_theme_css_collect_matches(self,
+													(GPtrArray*)g_hash_table_lookup(priv->selectorsByType, g_type_name(interfaces[i])),
+													inStylable,
+													&matches,
+													&scored);
 		}
+		g_free(interfaces);
 	}
 
+	_xfdashboard_theme_css_collect_matches(self,
+											priv->selectorsUniversal,
+											inStylable,
+											&matches,
+											&scored);
+
 	/* Sort matching selectors by their score */
 	matches=g_list_sort(matches,
 						(GCompareFunc)_xfdashboard_theme_css_sort_by_score);
@@ -2814,7 +3415,7 @@ GHashTable* xfdashboard_theme_css_get_properties(XfdashboardThemeCSS *self,
 	/* Get properties from matching selectors' styles */
 	result=g_hash_table_new_full(g_str_hash,
 									g_str_equal,
-									NULL,
+									g_free,
 									(GDestroyNotify)_xfdashboard_theme_css_value_free);
 	for(entry=matches; entry; entry=g_list_next(entry))
 	{
@@ -2837,10 +3438,12 @@ GHashTable* xfdashboard_theme_css_get_properties(XfdashboardThemeCSS *self,
 
 #ifdef DEBUG
 	XFDASHBOARD_DEBUG(self, STYLE,
-						"Found %u properties for %s in %f seconds" ,
+						"Found %u properties for %s in %f seconds after scoring %u of %u selectors",
 						g_hash_table_size(result),
 						styleSelector,
-						g_timer_elapsed(timer, NULL));
+						g_timer_elapsed(timer, NULL),
+						scored,
+						priv->selectorsCount);
 	g_timer_destroy(timer);
 	g_free(styleSelector);
 #endif
@@ -2848,3 +3451,115 @@ GHashTable* xfdashboard_theme_css_get_properties(XfdashboardThemeCSS *self,
 	/* Return found properties */
 	return(result);
 }
+
+/* Return properties for a stylable actor.
+ * The returned hash-table is shared between all stylables with the same
+ * signature and must not be modified. Release it with g_hash_table_unref().
+ */
+GHashTable* xfdashboard_theme_css_get_properties(XfdashboardThemeCSS *self,
+													XfdashboardStylable *inStylable)
+{
+	XfdashboardThemeCSSPrivate			*priv;
+	gchar								*signature;
+	GHashTable							*result;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_THEME_CSS(self), NULL);
+	g_return_val_if_fail(XFDASHBOARD_IS_STYLABLE(inStylable), NULL);
+
+	priv=self->priv;
+
+	/* Look up computed style in cache by signature of stylable */
+	signature=_xfdashboard_theme_css_get_stylable_signature(inStylable);
+
+	result=(GHashTable*)g_hash_table_lookup(priv->styleCache, signature);
+	if(result)
+	{
+		priv->styleCacheHits++;
+		g_free(signature);
+
+		return(g_hash_table_ref(result));
+	}
+
+	/* Style was not computed for this signature yet so do it now and
+	 * store it in cache. The cache takes ownership of signature string.
+	 */
+	result=_xfdashboard_theme_css_build_properties(self, inStylable);
+	g_hash_table_insert(priv->styleCache, signature, g_hash_table_ref(result));
+	priv->styleCacheMisses++;
+
+	XFDASHBOARD_DEBUG(self, STYLE,
+						"Computed style for %s stored in cache - %u cached styles, %u hits, %u misses",
+						G_OBJECT_TYPE_NAME(inStylable),
+						g_hash_table_size(priv->styleCache),
+						priv->styleCacheHits,
+						priv->styleCacheMisses);
+
+	/* Return found properties */
+	return(result);
+}
+
+/* Determine if any selector which could match a stylable contains parent or
+ * ancestor rules, i.e. if the style of stylable may change when any of its
+ * ancestors changes.
+ */
+gboolean xfdashboard_theme_css_has_ancestor_selectors(XfdashboardThemeCSS *self,
+														XfdashboardStylable *inStylable)
+{
+	XfdashboardThemeCSSPrivate			*priv;
+	const gchar							*id;
+	const gchar							*classes;
+	GType								type;
+	GType								*interfaces;
+	guint								numberInterfaces;
+	guint								i;
+	gboolean							result;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_THEME_CSS(self), TRUE);
+	g_return_val_if_fail(XFDASHBOARD_IS_STYLABLE(inStylable), TRUE);
+
+	priv=self->priv;
+
+	/* Universal selectors may match any stylable */
+	if(priv->ancestorSelectorsUniversal>0) return(TRUE);
+
+	/* Check ID of stylable */
+	id=xfdashboard_stylable_get_name(inStylable);
+	if(id && g_hash_table_contains(priv->ancestorSelectorsByID, id)) return(TRUE);
+
+	/* Check classes of stylable */
+	classes=xfdashboard_stylable_get_classes(inStylable);
+	if(classes && g_hash_table_size(priv->ancestorSelectorsByClass)>0)
+	{
+		gchar							**classList;
+		gchar							**iter;
+
+		result=FALSE;
+
+		classList=g_strsplit(classes, ".", -1);
+		for(iter=classList; *iter && !result; iter++)
+		{
+			if(**iter && g_hash_table_contains(priv->ancestorSelectorsByClass, *iter)) result=TRUE;
+		}
+		g_strfreev(classList);
+
+		if(result) return(TRUE);
+	}
+
+	/* Check types and interfaces of stylable */
+	if(g_hash_table_size(priv->ancestorSelectorsByType)==0) return(FALSE);
+
+	for(type=G_OBJECT_TYPE(inStylable); type; type=g_type_parent(type))
+	{
+		if(g_hash_table_contains(priv->ancestorSelectorsByType, g_type_name(type))) return(TRUE);
+	}
+
+	result=FALSE;
+	interfaces=g_type_interfaces(G_OBJECT_TYPE(inStylable), &numberInterfaces);
+	for(i=0; i<numberInterfaces && !result; i++)
+	{
+		if(g_hash_table_contains(priv->ancestorSelectorsByType, g_type_name(interfaces[i]))) result=TRUE;
+	}
+	g_free(interfaces);
+
+	return(result);
+}
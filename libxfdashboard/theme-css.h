@@ -98,9 +98,19 @@ gboolean xfdashboard_theme_css_add_file(XfdashboardThemeCSS *self,
 											gint inPriority,
 											GError **outError);
 
+GVariant* xfdashboard_theme_css_to_variant(XfdashboardThemeCSS *self);
+gboolean xfdashboard_theme_css_add_from_variant(XfdashboardThemeCSS *self,
+													GVariant *inVariant,
+													GError **outError);
+
+const GSList* xfdashboard_theme_css_get_files(XfdashboardThemeCSS *self);
+
 GHashTable* xfdashboard_theme_css_get_properties(XfdashboardThemeCSS *self,
 													XfdashboardStylable *inStylable);
 
+gboolean xfdashboard_theme_css_has_ancestor_selectors(XfdashboardThemeCSS *self,
+														XfdashboardStylable *inStylable);
+
 G_END_DECLS
 
 #endif	/* __LIBXFDASHBOARD_THEME_CSS__ */
@@ -1245,6 +1245,123 @@ gboolean xfdashboard_theme_effects_add_file(XfdashboardThemeEffects *self,
 	return(TRUE);
 }
 
+/* Get serialized form of all effects parsed so far which can be added to
+ * a new theme effects instance with xfdashboard_theme_effects_add_from_variant()
+ * without parsing any XML file again. The returned variant is floating.
+ */
+GVariant* xfdashboard_theme_effects_to_variant(XfdashboardThemeEffects *self)
+{
+	GVariantBuilder							builder;
+	GSList									*iter;
+	XfdashboardThemeEffectsParsedObject		*objectData;
+	GHashTableIter							propertiesIter;
+	const gchar								*key;
+	const gchar								*value;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_THEME_EFFECTS(self), NULL);
+
+	g_variant_builder_init(&builder, G_VARIANT_TYPE("a(mssa{ss})"));
+	for(iter=self->priv->effects; iter; iter=g_slist_next(iter))
+	{
+		objectData=(XfdashboardThemeEffectsParsedObject*)iter->data;
+
+		g_variant_builder_open(&builder, G_VARIANT_TYPE("(mssa{ss})"));
+		g_variant_builder_add(&builder, "ms", objectData->id);
+		g_variant_builder_add(&builder, "s", objectData->className);
+
+		g_variant_builder_open(&builder, G_VARIANT_TYPE("a{ss}"));
+		g_hash_table_iter_init(&propertiesIter, objectData->properties);
+		while(g_hash_table_iter_next(&propertiesIter, (gpointer*)&key, (gpointer*)&value))
+		{
+			g_variant_builder_add(&builder, "{ss}", key, value ? value : "");
+		}
+		g_variant_builder_close(&builder);
+
+		g_variant_builder_close(&builder);
+	}
+
+	return(g_variant_builder_end(&builder));
+}
+
+/* Add effects from serialized form created by xfdashboard_theme_effects_to_variant() */
+gboolean xfdashboard_theme_effects_add_from_variant(XfdashboardThemeEffects *self,
+													GVariant *inVariant,
+													GError **outError)
+{
+	XfdashboardThemeEffectsPrivate			*priv;
+	GSList									*effects;
+	XfdashboardThemeEffectsParsedObject		*objectData;
+	GVariantIter							iter;
+	GVariantIter							*propertiesIter;
+	const gchar								*id;
+	const gchar								*className;
+	const gchar								*key;
+	const gchar								*value;
+	GError									*error;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_THEME_EFFECTS(self), FALSE);
+	g_return_val_if_fail(inVariant, FALSE);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
+
+	priv=self->priv;
+	effects=NULL;
+	error=NULL;
+
+	/* Check that variant is a serialized theme effects */
+	if(!g_variant_is_of_type(inVariant, G_VARIANT_TYPE("a(mssa{ss})")))
+	{
+		g_set_error(outError,
+					XFDASHBOARD_THEME_EFFECTS_ERROR,
+					XFDASHBOARD_THEME_EFFECTS_ERROR_ERROR,
+					_("Unsupported variant of type %s for effects"),
+					g_variant_get_type_string(inVariant));
+		return(FALSE);
+	}
+
+	/* Recreate object data of each effect in same order as serialized */
+	g_variant_iter_init(&iter, inVariant);
+	while(!error &&
+			g_variant_iter_next(&iter, "(m&s&sa{ss})", &id, &className, &propertiesIter))
+	{
+		objectData=_xfdashboard_theme_effects_object_data_new(NULL, TAG_OBJECT, &error);
+		if(objectData)
+		{
+			objectData->id=g_strdup(id);
+			objectData->className=g_strdup(className);
+			objectData->classType=_xfdashboard_theme_effects_resolve_type_lazy(className);
+			if(objectData->classType==G_TYPE_INVALID)
+			{
+				g_set_error(&error,
+							XFDASHBOARD_THEME_EFFECTS_ERROR,
+							XFDASHBOARD_THEME_EFFECTS_ERROR_MALFORMED,
+							_("Unknown object class %s"),
+							className);
+			}
+
+			while(g_variant_iter_next(propertiesIter, "{&s&s}", &key, &value))
+			{
+				g_hash_table_insert(objectData->properties, g_strdup(key), g_strdup(value));
+			}
+
+			effects=g_slist_prepend(effects, objectData);
+		}
+
+		g_variant_iter_free(propertiesIter);
+	}
+
+	if(error)
+	{
+		g_propagate_error(outError, error);
+		g_slist_free_full(effects, (GDestroyNotify)_xfdashboard_theme_effects_object_data_unref);
+		return(FALSE);
+	}
+
+	/* Add effects */
+	priv->effects=g_slist_concat(priv->effects, g_slist_reverse(effects));
+
+	return(TRUE);
+}
+
 /* Create requested effect */
 ClutterEffect* xfdashboard_theme_effects_create_effect(XfdashboardThemeEffects *self,
 														const gchar *inID)
@@ -83,6 +83,11 @@ gboolean xfdashboard_theme_effects_add_file(XfdashboardThemeEffects *self,
 											const gchar *inPath,
 											GError **outError);
 
+GVariant* xfdashboard_theme_effects_to_variant(XfdashboardThemeEffects *self);
+gboolean xfdashboard_theme_effects_add_from_variant(XfdashboardThemeEffects *self,
+													GVariant *inVariant,
+													GError **outError);
+
 ClutterEffect* xfdashboard_theme_effects_create_effect(XfdashboardThemeEffects *self,
 														const gchar *inID);
 
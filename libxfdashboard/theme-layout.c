@@ -550,6 +550,222 @@ static void _xfdashboard_theme_layout_object_data_free_foreach_callback(gpointer
 	_xfdashboard_theme_layout_object_data_free(data);
 }
 
+/* Get serialized form of parsed object data and all its sub-objects */
+static GVariant* _xfdashboard_theme_layout_object_data_to_variant(XfdashboardThemeLayoutParsedObject *inData)
+{
+	GVariantBuilder						propertiesBuilder;
+	GVariantBuilder						constraintsBuilder;
+	GVariantBuilder						childrenBuilder;
+	GVariantBuilder						focusablesBuilder;
+	GVariant							*layout;
+	GVariant							*focusables;
+	GSList								*iter;
+	XfdashboardThemeLayoutTagData		*tagData;
+	guint								i;
+
+	g_return_val_if_fail(inData, NULL);
+
+	g_variant_builder_init(&propertiesBuilder, G_VARIANT_TYPE("a(smsbms)"));
+	for(iter=inData->properties; iter; iter=g_slist_next(iter))
+	{
+		tagData=(XfdashboardThemeLayoutTagData*)iter->data;
+		g_variant_builder_add(&propertiesBuilder,
+								"(smsbms)",
+								tagData->tag.property.name,
+								tagData->tag.property.value,
+								tagData->tag.property.translatable,
+								tagData->tag.property.refID);
+	}
+
+	g_variant_builder_init(&constraintsBuilder, G_VARIANT_TYPE("av"));
+	for(iter=inData->constraints; iter; iter=g_slist_next(iter))
+	{
+		g_variant_builder_add(&constraintsBuilder,
+								"v",
+								_xfdashboard_theme_layout_object_data_to_variant((XfdashboardThemeLayoutParsedObject*)iter->data));
+	}
+
+	layout=NULL;
+	if(inData->layout) layout=_xfdashboard_theme_layout_object_data_to_variant(inData->layout);
+
+	g_variant_builder_init(&childrenBuilder, G_VARIANT_TYPE("av"));
+	for(iter=inData->children; iter; iter=g_slist_next(iter))
+	{
+		g_variant_builder_add(&childrenBuilder,
+								"v",
+								_xfdashboard_theme_layout_object_data_to_variant((XfdashboardThemeLayoutParsedObject*)iter->data));
+	}
+
+	/* An empty list of focusables differs from no list of focusables */
+	focusables=NULL;
+	if(inData->focusables)
+	{
+		g_variant_builder_init(&focusablesBuilder, G_VARIANT_TYPE("a(sb)"));
+		for(i=0; i<inData->focusables->len; i++)
+		{
+			tagData=(XfdashboardThemeLayoutTagData*)g_ptr_array_index(inData->focusables, i);
+			g_variant_builder_add(&focusablesBuilder,
+									"(sb)",
+									tagData->tag.focus.refID,
+									tagData->tag.focus.selected);
+		}
+		focusables=g_variant_builder_end(&focusablesBuilder);
+	}
+
+	return(g_variant_new("(mssa(smsbms)avmvav@ma(sb))",
+							inData->id,
+							g_type_name(inData->classType),
+							&propertiesBuilder,
+							&constraintsBuilder,
+							layout,
+							&childrenBuilder,
+							g_variant_new_maybe(G_VARIANT_TYPE("a(sb)"), focusables)));
+}
+
+/* Create parsed object data and all its sub-objects from serialized form */
+static XfdashboardThemeLayoutParsedObject* _xfdashboard_theme_layout_object_data_new_from_variant(XfdashboardThemeLayout *self,
+																									GVariant *inVariant,
+																									GError **outError)
+{
+	XfdashboardThemeLayoutPrivate		*priv;
+	XfdashboardThemeLayoutParsedObject	*objectData;
+	XfdashboardThemeLayoutParsedObject	*subObjectData;
+	XfdashboardThemeLayoutTagData		*tagData;
+	const gchar							*id;
+	const gchar							*className;
+	GVariantIter						*propertiesIter;
+	GVariantIter						*constraintsIter;
+	GVariant							*layout;
+	GVariantIter						*childrenIter;
+	GVariantIter						*focusablesIter;
+	const gchar							*name;
+	const gchar							*value;
+	gboolean							flag;
+	const gchar							*refID;
+	GVariant							*subVariant;
+	GError								*error;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_THEME_LAYOUT(self), NULL);
+	g_return_val_if_fail(inVariant, NULL);
+	g_return_val_if_fail(outError && *outError==NULL, NULL);
+
+	priv=self->priv;
+	error=NULL;
+
+	if(!g_variant_is_of_type(inVariant, G_VARIANT_TYPE("(mssa(smsbms)avmvavma(sb))")))
+	{
+		g_set_error(outError,
+					XFDASHBOARD_THEME_LAYOUT_ERROR,
+					XFDASHBOARD_THEME_LAYOUT_ERROR_ERROR,
+					_("Unsupported variant of type %s for object data"),
+					g_variant_get_type_string(inVariant));
+		return(NULL);
+	}
+
+	g_variant_get(inVariant,
+					"(m&s&sa(smsbms)avmvavma(sb))",
+					&id,
+					&className,
+					&propertiesIter,
+					&constraintsIter,
+					&layout,
+					&childrenIter,
+					&focusablesIter);
+
+	/* Create object data and resolve its type */
+	objectData=_xfdashboard_theme_layout_object_data_new(NULL, TAG_OBJECT, &error);
+	if(objectData)
+	{
+		objectData->id=g_strdup(id);
+
+		objectData->classType=g_type_from_name(className);
+		if(objectData->classType==G_TYPE_INVALID) objectData->classType=_xfdashboard_theme_layout_resolve_type_lazy(className);
+		if(objectData->classType==G_TYPE_INVALID)
+		{
+			g_set_error(&error,
+						XFDASHBOARD_THEME_LAYOUT_ERROR,
+						XFDASHBOARD_THEME_LAYOUT_ERROR_MALFORMED,
+						_("Unknown object class %s"),
+						className);
+		}
+	}
+
+	/* Restore properties */
+	while(!error &&
+			g_variant_iter_next(propertiesIter, "(&sm&sbm&s)", &name, &value, &flag, &refID))
+	{
+		tagData=_xfdashboard_theme_layout_tag_data_new(NULL, TAG_PROPERTY, &error);
+		if(!tagData) break;
+
+		tagData->tag.property.name=g_strdup(name);
+		tagData->tag.property.value=g_strdup(value);
+		tagData->tag.property.translatable=flag;
+		tagData->tag.property.refID=g_strdup(refID);
+		objectData->properties=g_slist_append(objectData->properties, tagData);
+	}
+
+	/* Restore constraints */
+	while(!error &&
+			g_variant_iter_next(constraintsIter, "v", &subVariant))
+	{
+		subObjectData=_xfdashboard_theme_layout_object_data_new_from_variant(self, subVariant, &error);
+		if(subObjectData) objectData->constraints=g_slist_append(objectData->constraints, subObjectData);
+		g_variant_unref(subVariant);
+	}
+
+	/* Restore layout manager */
+	if(!error && layout)
+	{
+		objectData->layout=_xfdashboard_theme_layout_object_data_new_from_variant(self, layout, &error);
+	}
+
+	/* Restore children */
+	while(!error &&
+			g_variant_iter_next(childrenIter, "v", &subVariant))
+	{
+		subObjectData=_xfdashboard_theme_layout_object_data_new_from_variant(self, subVariant, &error);
+		if(subObjectData) objectData->children=g_slist_append(objectData->children, subObjectData);
+		g_variant_unref(subVariant);
+	}
+
+	/* Restore focusables */
+	if(!error && focusablesIter)
+	{
+		objectData->focusables=g_ptr_array_new_with_free_func((GDestroyNotify)_xfdashboard_theme_layout_tag_data_unref);
+		while(!error &&
+				g_variant_iter_next(focusablesIter, "(&sb)", &refID, &flag))
+		{
+			tagData=_xfdashboard_theme_layout_tag_data_new(NULL, TAG_FOCUS, &error);
+			if(!tagData) break;
+
+			tagData->tag.focus.refID=g_strdup(refID);
+			tagData->tag.focus.selected=flag;
+			g_ptr_array_add(objectData->focusables, tagData);
+
+			/* Remember first actor marked as pre-selected focus */
+			if(flag && !priv->focusSelected) priv->focusSelected=_xfdashboard_theme_layout_tag_data_ref(tagData);
+		}
+	}
+
+	/* Release allocated resources */
+	g_variant_iter_free(propertiesIter);
+	g_variant_iter_free(constraintsIter);
+	if(layout) g_variant_unref(layout);
+	g_variant_iter_free(childrenIter);
+	if(focusablesIter) g_variant_iter_free(focusablesIter);
+
+	/* Check for error and return NULL in this case */
+	if(error)
+	{
+		g_propagate_error(outError, error);
+		if(objectData) _xfdashboard_theme_layout_object_data_unref(objectData);
+		return(NULL);
+	}
+
+	/* Return created object data */
+	return(objectData);
+}
+
 /* Free data about an unresolved property which refers an other object */
 static void _xfdashboard_theme_layout_create_object_free_unresolved(gpointer inData)
 {
@@ -2139,6 +2355,82 @@ gboolean xfdashboard_theme_layout_add_file(XfdashboardThemeLayout *self,
 	return(TRUE);
 }
 
+/* Get serialized form of all interfaces parsed so far which can be added to
+ * a new theme layout instance with xfdashboard_theme_layout_add_from_variant()
+ * without parsing any XML file again. The returned variant is floating.
+ */
+GVariant* xfdashboard_theme_layout_to_variant(XfdashboardThemeLayout *self)
+{
+	GVariantBuilder						builder;
+	GSList								*iter;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_THEME_LAYOUT(self), NULL);
+
+	g_variant_builder_init(&builder, G_VARIANT_TYPE("av"));
+	for(iter=self->priv->interfaces; iter; iter=g_slist_next(iter))
+	{
+		g_variant_builder_add(&builder,
+								"v",
+								_xfdashboard_theme_layout_object_data_to_variant((XfdashboardThemeLayoutParsedObject*)iter->data));
+	}
+
+	return(g_variant_builder_end(&builder));
+}
+
+/* Add interfaces from serialized form created by xfdashboard_theme_layout_to_variant() */
+gboolean xfdashboard_theme_layout_add_from_variant(XfdashboardThemeLayout *self,
+													GVariant *inVariant,
+													GError **outError)
+{
+	XfdashboardThemeLayoutPrivate		*priv;
+	GSList								*interfaces;
+	XfdashboardThemeLayoutParsedObject	*objectData;
+	GVariantIter						iter;
+	GVariant							*interfaceVariant;
+	GError								*error;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_THEME_LAYOUT(self), FALSE);
+	g_return_val_if_fail(inVariant, FALSE);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, FALSE);
+
+	priv=self->priv;
+	interfaces=NULL;
+	error=NULL;
+
+	/* Check that variant is a serialized theme layout */
+	if(!g_variant_is_of_type(inVariant, G_VARIANT_TYPE("av")))
+	{
+		g_set_error(outError,
+					XFDASHBOARD_THEME_LAYOUT_ERROR,
+					XFDASHBOARD_THEME_LAYOUT_ERROR_ERROR,
+					_("Unsupported variant of type %s for layout"),
+					g_variant_get_type_string(inVariant));
+		return(FALSE);
+	}
+
+	/* Recreate object data of each interface */
+	g_variant_iter_init(&iter, inVariant);
+	while(!error &&
+			g_variant_iter_next(&iter, "v", &interfaceVariant))
+	{
+		objectData=_xfdashboard_theme_layout_object_data_new_from_variant(self, interfaceVariant, &error);
+		if(objectData) interfaces=g_slist_prepend(interfaces, objectData);
+		g_variant_unref(interfaceVariant);
+	}
+
+	if(error)
+	{
+		g_propagate_error(outError, error);
+		g_slist_free_full(interfaces, (GDestroyNotify)_xfdashboard_theme_layout_object_data_unref);
+		return(FALSE);
+	}
+
+	/* Add interfaces */
+	priv->interfaces=g_slist_concat(priv->interfaces, g_slist_reverse(interfaces));
+
+	return(TRUE);
+}
+
 /* Build requested interface */
 ClutterActor* xfdashboard_theme_layout_build_interface(XfdashboardThemeLayout *self,
 														const gchar *inID,
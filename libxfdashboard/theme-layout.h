@@ -109,6 +109,11 @@ gboolean xfdashboard_theme_layout_add_file(XfdashboardThemeLayout *self,
 											const gchar *inPath,
 											GError **outError);
 
+GVariant* xfdashboard_theme_layout_to_variant(XfdashboardThemeLayout *self);
+gboolean xfdashboard_theme_layout_add_from_variant(XfdashboardThemeLayout *self,
+													GVariant *inVariant,
+													GError **outError);
+
 ClutterActor* xfdashboard_theme_layout_build_interface(XfdashboardThemeLayout *self,
 														const gchar *inID,
 														...);
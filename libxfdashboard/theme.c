@@ -31,6 +31,7 @@
 #include <glib/gi18n-lib.h>
 #include <glib.h>
 #include <gio/gio.h>
+#include <gtk/gtk.h>
 
 #include <libxfdashboard/compat.h>
 #include <libxfdashboard/debug.h>
@@ -87,6 +88,415 @@ static GParamSpec* XfdashboardThemeProperties[PROP_LAST]={ 0, };
 #define XFDASHBOARD_THEME_GROUP							"Xfdashboard Theme"
 #define XFDASHBOARD_USER_GLOBAL_CSS_FILE				"global.css"
 
+#define XFDASHBOARD_THEME_CACHE_SUBPATH					"themes"
+#define XFDASHBOARD_THEME_CACHE_SUFFIX					".cache"
+#define XFDASHBOARD_THEME_CACHE_MAGIC					0x58444243	/* "XDBC" in native byte order */
+#define XFDASHBOARD_THEME_CACHE_VERSION					1
+#define XFDASHBOARD_THEME_CACHE_FORMAT					"(uusa(sxts)vvv)"
+
+/* Get path to compiled theme cache file.
+ * Caller must free returned path with g_free if not needed anymore.
+ */
+static gchar* _xfdashboard_theme_cache_get_path(XfdashboardTheme *self)
+{
+	XfdashboardThemePrivate		*priv;
+	gchar						*filename;
+	gchar						*path;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_THEME(self), NULL);
+
+	priv=self->priv;
+
+	filename=g_strconcat(priv->themeName, XFDASHBOARD_THEME_CACHE_SUFFIX, NULL);
+	path=g_build_filename(g_get_user_cache_dir(), "xfdashboard", XFDASHBOARD_THEME_CACHE_SUBPATH, filename, NULL);
+	g_free(filename);
+
+	return(path);
+}
+
+/* Get manifest of compiled theme cache which covers everything a cache depends
+ * on besides the content of the source files, i.e. the version of this library,
+ * the path of theme, which user stylesheets exist and the icon theme used as
+ * icon names resolved by CSS function try_icons() are cached.
+ * Caller must free returned string with g_free if not needed anymore.
+ */
+static gchar* _xfdashboard_theme_cache_get_manifest(XfdashboardTheme *self)
+{
+	XfdashboardThemePrivate		*priv;
+	GtkSettings					*settings;
+	gchar						*iconThemeName;
+	gchar						*manifest;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_THEME(self), NULL);
+
+	priv=self->priv;
+
+	/* Get name of icon theme */
+	iconThemeName=NULL;
+	settings=gtk_settings_get_default();
+	if(settings) g_object_get(settings, "gtk-icon-theme-name", &iconThemeName, NULL);
+
+	manifest=g_strdup_printf("%s\n%s\n%s\n%s\n%s",
+								PACKAGE_VERSION,
+								priv->themePath,
+								priv->userGlobalStyleFile ? priv->userGlobalStyleFile : "",
+								priv->userThemeStyleFile ? priv->userThemeStyleFile : "",
+								iconThemeName ? iconThemeName : "");
+
+	/* Release allocated resources */
+	if(iconThemeName) g_free(iconThemeName);
+
+	return(manifest);
+}
+
+/* Get modification time (in microseconds) and size of a source file */
+static gboolean _xfdashboard_theme_cache_stat_source(const gchar *inPath,
+														gint64 *outModified,
+														guint64 *outSize)
+{
+	GFile						*file;
+	GFileInfo					*info;
+
+	g_return_val_if_fail(inPath && *inPath, FALSE);
+	g_return_val_if_fail(outModified, FALSE);
+	g_return_val_if_fail(outSize, FALSE);
+
+	file=g_file_new_for_path(inPath);
+	info=g_file_query_info(file,
+							G_FILE_ATTRIBUTE_TIME_MODIFIED ","
+							G_FILE_ATTRIBUTE_TIME_MODIFIED_USEC ","
+							G_FILE_ATTRIBUTE_STANDARD_SIZE,
+							G_FILE_QUERY_INFO_NONE,
+							NULL,
+							NULL);
+	g_object_unref(file);
+	if(!info) return(FALSE);
+
+	*outModified=(gint64)g_file_info_get_attribute_uint64(info, G_FILE_ATTRIBUTE_TIME_MODIFIED)*G_USEC_PER_SEC;
+	*outModified+=g_file_info_get_attribute_uint32(info, G_FILE_ATTRIBUTE_TIME_MODIFIED_USEC);
+	*outSize=(guint64)g_file_info_get_size(info);
+
+	g_object_unref(info);
+
+	return(TRUE);
+}
+
+/* Get checksum of content of a source file.
+ * Caller must free returned string with g_free if not needed anymore.
+ */
+static gchar* _xfdashboard_theme_cache_checksum_source(const gchar *inPath)
+{
+	gchar						*contents;
+	gsize						contentsLength;
+	gchar						*checksum;
+
+	g_return_val_if_fail(inPath && *inPath, NULL);
+
+	if(!g_file_get_contents(inPath, &contents, &contentsLength, NULL)) return(NULL);
+
+	checksum=g_compute_checksum_for_data(G_CHECKSUM_SHA256, (const guchar*)contents, contentsLength);
+	g_free(contents);
+
+	return(checksum);
+}
+
+/* Load theme's resources from compiled theme cache if it exists and is still
+ * valid. The cache file is mapped into memory and the serialized resources are
+ * read from it directly so no source file needs to be parsed.
+ */
+static gboolean _xfdashboard_theme_cache_load(XfdashboardTheme *self)
+{
+	XfdashboardThemePrivate		*priv;
+	gchar						*cacheFile;
+	GMappedFile					*mappedFile;
+	GVariant					*cache;
+	guint32						magic;
+	guint32						version;
+	const gchar					*cachedManifest;
+	gchar						*manifest;
+	GVariant					*sources;
+	GVariant					*styling;
+	GVariant					*layout;
+	GVariant					*effects;
+	GVariantIter				iter;
+	const gchar					*sourcePath;
+	gint64						sourceModified;
+	guint64						sourceSize;
+	const gchar					*sourceChecksum;
+	gint64						modified;
+	guint64						size;
+	gchar						*checksum;
+	gboolean					isValid;
+	GError						*error;
+#ifdef DEBUG
+	GTimer						*timer;
+#endif
+
+	g_return_val_if_fail(XFDASHBOARD_IS_THEME(self), FALSE);
+
+	priv=self->priv;
+	error=NULL;
+#ifdef DEBUG
+	timer=g_timer_new();
+#endif
+
+	/* Map cache file into memory */
+	cacheFile=_xfdashboard_theme_cache_get_path(self);
+	mappedFile=g_mapped_file_new(cacheFile, FALSE, &error);
+	if(!mappedFile)
+	{
+		XFDASHBOARD_DEBUG(self, THEME,
+							"Could not map compiled theme cache %s: %s",
+							cacheFile,
+							error ? error->message : "Unknown error");
+
+		/* Release allocated resources */
+		if(error) g_error_free(error);
+		g_free(cacheFile);
+#ifdef DEBUG
+		g_timer_destroy(timer);
+#endif
+
+		return(FALSE);
+	}
+
+	/* The mapped file is owned by the variant from now on and the data is not
+	 * trusted so any corruption results in default values but never in reading
+	 * beyond mapped memory.
+	 */
+	cache=g_variant_new_from_data(G_VARIANT_TYPE(XFDASHBOARD_THEME_CACHE_FORMAT),
+									g_mapped_file_get_contents(mappedFile),
+									g_mapped_file_get_length(mappedFile),
+									FALSE,
+									(GDestroyNotify)g_mapped_file_unref,
+									mappedFile);
+	g_variant_ref_sink(cache);
+
+	g_variant_get(cache,
+					"(uu&s@a(sxts)vvv)",
+					&magic,
+					&version,
+					&cachedManifest,
+					&sources,
+					&styling,
+					&layout,
+					&effects);
+
+	/* Check that cache was created for this theme by this version */
+	manifest=_xfdashboard_theme_cache_get_manifest(self);
+	isValid=(magic==XFDASHBOARD_THEME_CACHE_MAGIC &&
+				version==XFDASHBOARD_THEME_CACHE_VERSION &&
+				g_strcmp0(cachedManifest, manifest)==0);
+	g_free(manifest);
+
+	/* Check that no source file has changed. If modification time and size are
+	 * unchanged the source file is considered unchanged without reading it.
+	 * Otherwise the checksum of its content decides, e.g. if it was only touched.
+	 */
+	g_variant_iter_init(&iter, sources);
+	while(isValid &&
+			g_variant_iter_next(&iter, "(&sxt&s)", &sourcePath, &sourceModified, &sourceSize, &sourceChecksum))
+	{
+		if(!_xfdashboard_theme_cache_stat_source(sourcePath, &modified, &size))
+		{
+			XFDASHBOARD_DEBUG(self, THEME,
+								"Compiled theme cache %s is outdated because source file %s is missing",
+								cacheFile,
+								sourcePath);
+			isValid=FALSE;
+			break;
+		}
+
+		if(modified==sourceModified && size==sourceSize) continue;
+
+		checksum=_xfdashboard_theme_cache_checksum_source(sourcePath);
+		if(g_strcmp0(checksum, sourceChecksum)!=0)
+		{
+			XFDASHBOARD_DEBUG(self, THEME,
+								"Compiled theme cache %s is outdated because content of source file %s changed",
+								cacheFile,
+								sourcePath);
+			isValid=FALSE;
+		}
+		g_free(checksum);
+	}
+
+	/* Add resources from cache */
+	if(isValid &&
+		(!xfdashboard_theme_css_add_from_variant(priv->styling, styling, &error) ||
+			!xfdashboard_theme_layout_add_from_variant(priv->layout, layout, &error) ||
+			!xfdashboard_theme_effects_add_from_variant(priv->effects, effects, &error)))
+	{
+		XFDASHBOARD_DEBUG(self, THEME,
+							"Could not load resources from compiled theme cache %s: %s",
+							cacheFile,
+							error ? error->message : "Unknown error");
+
+		/* Resources could be added partially so start with empty ones */
+		g_object_unref(priv->styling);
+		priv->styling=xfdashboard_theme_css_new(priv->themePath);
+
+		g_object_unref(priv->layout);
+		priv->layout=xfdashboard_theme_layout_new();
+
+		g_object_unref(priv->effects);
+		priv->effects=xfdashboard_theme_effects_new();
+
+		isValid=FALSE;
+	}
+
+#ifdef DEBUG
+	if(isValid)
+	{
+		XFDASHBOARD_DEBUG(self, THEME,
+							"Loaded resources of theme %s from compiled theme cache %s in %f seconds",
+							priv->themeName,
+							cacheFile,
+							g_timer_elapsed(timer, NULL));
+	}
+	g_timer_destroy(timer);
+#endif
+
+	/* Release allocated resources */
+	if(error) g_error_free(error);
+	g_variant_unref(sources);
+	g_variant_unref(styling);
+	g_variant_unref(layout);
+	g_variant_unref(effects);
+	g_variant_unref(cache);
+	g_free(cacheFile);
+
+	return(isValid);
+}
+
+/* Add a source file with its modification time, size and checksum to list
+ * of source files a compiled theme cache depends on.
+ */
+static gboolean _xfdashboard_theme_cache_add_source(GVariantBuilder *ioBuilder,
+														const gchar *inPath)
+{
+	gint64						modified;
+	guint64						size;
+	gchar						*checksum;
+
+	g_return_val_if_fail(ioBuilder, FALSE);
+	g_return_val_if_fail(inPath && *inPath, FALSE);
+
+	if(!_xfdashboard_theme_cache_stat_source(inPath, &modified, &size)) return(FALSE);
+
+	checksum=_xfdashboard_theme_cache_checksum_source(inPath);
+	if(!checksum) return(FALSE);
+
+	g_variant_builder_add(ioBuilder, "(sxts)", inPath, modified, size, checksum);
+	g_free(checksum);
+
+	return(TRUE);
+}
+
+/* Write resources of theme to compiled theme cache */
+static void _xfdashboard_theme_cache_save(XfdashboardTheme *self, GKeyFile *inThemeKeyFile)
+{
+	XfdashboardThemePrivate		*priv;
+	GVariantBuilder				sourcesBuilder;
+	gboolean					success;
+	gchar						*themeFile;
+	const GSList				*cssFiles;
+	const gchar					*xmlGroups[]={ "Layout", "Effects", NULL };
+	const gchar					**xmlGroup;
+	gchar						**resources, **resource;
+	gchar						*resourceFile;
+	gchar						*manifest;
+	GVariant					*cache;
+	gchar						*cacheFile;
+	gchar						*cachePath;
+	GError						*error;
+
+	g_return_if_fail(XFDASHBOARD_IS_THEME(self));
+	g_return_if_fail(inThemeKeyFile);
+
+	priv=self->priv;
+	success=TRUE;
+	error=NULL;
+
+	/* Collect all source files the resources were loaded from */
+	g_variant_builder_init(&sourcesBuilder, G_VARIANT_TYPE("a(sxts)"));
+
+	themeFile=g_build_filename(priv->themePath, XFDASHBOARD_THEME_FILE, NULL);
+	success=_xfdashboard_theme_cache_add_source(&sourcesBuilder, themeFile);
+	g_free(themeFile);
+
+	for(cssFiles=xfdashboard_theme_css_get_files(priv->styling); success && cssFiles; cssFiles=g_slist_next(cssFiles))
+	{
+		success=_xfdashboard_theme_cache_add_source(&sourcesBuilder, (const gchar*)cssFiles->data);
+	}
+
+	for(xmlGroup=xmlGroups; success && *xmlGroup; xmlGroup++)
+	{
+		resources=g_key_file_get_string_list(inThemeKeyFile, XFDASHBOARD_THEME_GROUP, *xmlGroup, NULL, NULL);
+		if(!resources) continue;
+
+		for(resource=resources; success && *resource; resource++)
+		{
+			resourceFile=g_build_filename(priv->themePath, *resource, NULL);
+			success=_xfdashboard_theme_cache_add_source(&sourcesBuilder, resourceFile);
+			g_free(resourceFile);
+		}
+
+		g_strfreev(resources);
+	}
+
+	if(!success)
+	{
+		XFDASHBOARD_DEBUG(self, THEME,
+							"Not writing compiled theme cache for theme %s because not all source files could be read",
+							priv->themeName);
+		g_variant_builder_clear(&sourcesBuilder);
+		return;
+	}
+
+	/* Build cache */
+	manifest=_xfdashboard_theme_cache_get_manifest(self);
+	cache=g_variant_new(XFDASHBOARD_THEME_CACHE_FORMAT,
+						XFDASHBOARD_THEME_CACHE_MAGIC,
+						XFDASHBOARD_THEME_CACHE_VERSION,
+						manifest,
+						&sourcesBuilder,
+						xfdashboard_theme_css_to_variant(priv->styling),
+						xfdashboard_theme_layout_to_variant(priv->layout),
+						xfdashboard_theme_effects_to_variant(priv->effects));
+	g_variant_ref_sink(cache);
+	g_free(manifest);
+
+	/* Write cache */
+	cacheFile=_xfdashboard_theme_cache_get_path(self);
+	cachePath=g_path_get_dirname(cacheFile);
+
+	if(g_mkdir_with_parents(cachePath, 0700)<0 ||
+		!g_file_set_contents(cacheFile,
+								g_variant_get_data(cache),
+								g_variant_get_size(cache),
+								&error))
+	{
+		g_warning(_("Could not write compiled theme cache %s: %s"),
+					cacheFile,
+					error ? error->message : _("Unknown error"));
+	}
+		else
+		{
+			XFDASHBOARD_DEBUG(self, THEME,
+								"Wrote compiled theme cache %s for theme %s with %" G_GSIZE_FORMAT " bytes",
+								cacheFile,
+								priv->themeName,
+								g_variant_get_size(cache));
+		}
+
+	/* Release allocated resources */
+	if(error) g_error_free(error);
+	g_free(cachePath);
+	g_free(cacheFile);
+	g_variant_unref(cache);
+}
+
 /* Load theme file and all listed resources in this file */
 static gboolean _xfdashboard_theme_load_resources(XfdashboardTheme *self,
 													GError **outError)
@@ -181,6 +591,18 @@ static gboolean _xfdashboard_theme_load_resources(XfdashboardTheme *self,
 		return(FALSE);
 	}
 
+	/* Load resources from compiled theme cache if it is still valid to avoid
+	 * parsing all the source files.
+	 */
+	if(_xfdashboard_theme_cache_load(self))
+	{
+		/* Release allocated resources */
+		if(themeKeyFile) g_key_file_free(themeKeyFile);
+
+		/* Return TRUE to indicate success */
+		return(TRUE);
+	}
+
 	/* Create CSS parser, load style resources first and user stylesheets (theme
 	 * unrelated "global.css" and theme related "user-[THEME_NAME].css" in this
 	 * order) at last to allow user to override theme styles.
@@ -401,6 +823,9 @@ static gboolean _xfdashboard_theme_load_resources(XfdashboardTheme *self,
 		g_strfreev(resources);
 	}
 
+	/* Write all parsed resources to compiled theme cache for next start */
+	_xfdashboard_theme_cache_save(self, themeKeyFile);
+
 	/* Release allocated resources */
 	if(themeKeyFile) g_key_file_free(themeKeyFile);
 
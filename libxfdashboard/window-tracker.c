@@ -73,6 +73,9 @@ enum
 
 	SIGNAL_WINDOW_MANAGER_CHANGED,
 
+	SIGNAL_WINDOWS_UPDATE_BEGIN,
+	SIGNAL_WINDOWS_UPDATE_END,
+
 	SIGNAL_LAST
 };
 
@@ -573,6 +576,47 @@ void xfdashboard_window_tracker_default_init(XfdashboardWindowTrackerInterface *
 							G_TYPE_NONE,
 							0);
 
+		/**
+		 * XfdashboardWindowTracker::windows-update-begin:
+		 * @self: The window tracker
+		 *
+		 * The ::windows-update-begin signal is emitted before a batch of
+		 * #XfdashboardWindowTracker::window-opened signals is emitted, e.g.
+		 * when many windows are mapped at once on session restore. Listeners
+		 * may defer expensive work like relayouts until the corresponding
+		 * #XfdashboardWindowTracker::windows-update-end signal was received.
+		 * Both signals are always emitted in pairs and do not nest.
+		 */
+		XfdashboardWindowTrackerSignals[SIGNAL_WINDOWS_UPDATE_BEGIN]=
+			g_signal_new("windows-update-begin",
+							G_TYPE_FROM_INTERFACE(iface),
+							G_SIGNAL_RUN_LAST,
+							G_STRUCT_OFFSET(XfdashboardWindowTrackerInterface, windows_update_begin),
+							NULL,
+							NULL,
+							g_cclosure_marshal_VOID__VOID,
+							G_TYPE_NONE,
+							0);
+
+		/**
+		 * XfdashboardWindowTracker::windows-update-end:
+		 * @self: The window tracker
+		 *
+		 * The ::windows-update-end signal is emitted after the last signal
+		 * of a batch started with #XfdashboardWindowTracker::windows-update-begin
+		 * was emitted.
+		 */
+		XfdashboardWindowTrackerSignals[SIGNAL_WINDOWS_UPDATE_END]=
+			g_signal_new("windows-update-end",
+							G_TYPE_FROM_INTERFACE(iface),
+							G_SIGNAL_RUN_LAST,
+							G_STRUCT_OFFSET(XfdashboardWindowTrackerInterface, windows_update_end),
+							NULL,
+							NULL,
+							g_cclosure_marshal_VOID__VOID,
+							G_TYPE_NONE,
+							0);
+
 		/* Set flag that base initialization was done for this interface */
 		initialized=TRUE;
 	}
@@ -97,6 +97,8 @@ typedef struct _XfdashboardWindowTrackerInterface	XfdashboardWindowTrackerInterf
  * @screen_size_changed: Signal emitted when the total screen size over all
  *    connected monitors has changed
  * @window_manager_changed: Signal emitted when the window manager was replaced
+ * @windows_update_begin: Signal emitted before a batch of windows is opened
+ * @windows_update_end: Signal emitted after a batch of windows was opened
  */
 struct _XfdashboardWindowTrackerInterface
 {
@@ -166,6 +168,9 @@ struct _XfdashboardWindowTrackerInterface
 	void (*screen_size_changed)(XfdashboardWindowTracker *self);
 
 	void (*window_manager_changed)(XfdashboardWindowTracker *self);
+
+	void (*windows_update_begin)(XfdashboardWindowTracker *self);
+	void (*windows_update_end)(XfdashboardWindowTracker *self);
 };
 
 
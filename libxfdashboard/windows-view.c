@@ -86,6 +86,9 @@ struct _XfdashboardWindowsViewPrivate
 	XfdashboardStageInterface			*currentStage;
 	XfdashboardWindowTrackerMonitor		*currentMonitor;
 	guint								currentStageMonitorBindingID;
+
+	gboolean							isWindowsUpdate;
+	gboolean							needWindowNumberUpdate;
 };
 
 /* Properties */
@@ -652,11 +655,14 @@ static void _xfdashboard_windows_view_on_window_opened(XfdashboardWindowsView *s
 														XfdashboardWindowTrackerWindow *inWindow,
 														gpointer inUserData)
 {
+	XfdashboardWindowsViewPrivate		*priv;
 	XfdashboardLiveWindow				*liveWindow;
 
 	g_return_if_fail(XFDASHBOARD_IS_WINDOWS_VIEW(self));
 	g_return_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_WINDOW(inWindow));
 
+	priv=self->priv;
+
 	/* Check if parent stage interface changed. If not just add window actor.
 	 * Otherwise recreate all window actors for changed stage interface and
 	 * monitor.
@@ -674,7 +680,12 @@ static void _xfdashboard_windows_view_on_window_opened(XfdashboardWindowsView *s
 			if(liveWindow)
 			{
 				clutter_actor_insert_child_below(CLUTTER_ACTOR(self), CLUTTER_ACTOR(liveWindow), NULL);
-				_xfdashboard_windows_view_update_window_number_in_actors(self);
+
+				/* Update window numbers once at end of batch if window
+				 * tracker reports a batch of opened windows currently.
+				 */
+				if(priv->isWindowsUpdate) priv->needWindowNumberUpdate=TRUE;
+					else _xfdashboard_windows_view_update_window_number_in_actors(self);
 			}
 		}
 	}
@@ -685,6 +696,33 @@ static void _xfdashboard_windows_view_on_window_opened(XfdashboardWindowsView *s
 		}
 }
 
+/* A batch of opened windows begins */
+static void _xfdashboard_windows_view_on_windows_update_begin(XfdashboardWindowsView *self,
+																gpointer inUserData)
+{
+	g_return_if_fail(XFDASHBOARD_IS_WINDOWS_VIEW(self));
+
+	self->priv->isWindowsUpdate=TRUE;
+}
+
+/* A batch of opened windows ended so apply deferred updates */
+static void _xfdashboard_windows_view_on_windows_update_end(XfdashboardWindowsView *self,
+															gpointer inUserData)
+{
+	XfdashboardWindowsViewPrivate		*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_WINDOWS_VIEW(self));
+
+	priv=self->priv;
+
+	priv->isWindowsUpdate=FALSE;
+	if(priv->needWindowNumberUpdate)
+	{
+		priv->needWindowNumberUpdate=FALSE;
+		_xfdashboard_windows_view_update_window_number_in_actors(self);
+	}
+}
+
 /* A window has changed monitor */
 static void _xfdashboard_windows_view_on_window_monitor_changed(XfdashboardWindowsView *self,
 																XfdashboardWindowTrackerWindow *inWindow,
@@ -2276,6 +2314,8 @@ static void xfdashboard_windows_view_init(XfdashboardWindowsView *self)
 	priv->currentStage=NULL;
 	priv->currentMonitor=NULL;
 	priv->currentStageMonitorBindingID=0;
+	priv->isWindowsUpdate=FALSE;
+	priv->needWindowNumberUpdate=FALSE;
 
 	/* Set up view */
 	xfdashboard_view_set_name(XFDASHBOARD_VIEW(self), _("Windows"));
@@ -2318,6 +2358,16 @@ static void xfdashboard_windows_view_init(XfdashboardWindowsView *self)
 								G_CALLBACK(_xfdashboard_windows_view_on_window_opened),
 								self);
 
+	g_signal_connect_swapped(priv->windowTracker,
+								"windows-update-begin",
+								G_CALLBACK(_xfdashboard_windows_view_on_windows_update_begin),
+								self);
+
+	g_signal_connect_swapped(priv->windowTracker,
+								"windows-update-end",
+								G_CALLBACK(_xfdashboard_windows_view_on_windows_update_end),
+								self);
+
 	g_signal_connect_swapped(priv->windowTracker,
 								"window-monitor-changed",
 								G_CALLBACK(_xfdashboard_windows_view_on_window_monitor_changed),
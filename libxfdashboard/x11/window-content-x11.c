@@ -41,14 +41,24 @@
 #endif
 #ifdef HAVE_XDAMAGE
 #include <X11/extensions/Xdamage.h>
+#include <X11/extensions/Xfixes.h>
+#endif
+#ifdef HAVE_XSHM
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <X11/extensions/XShm.h>
 #endif
 #include <gdk/gdkx.h>
+#include <math.h>
+#include <stdlib.h>
 
 #include <libxfdashboard/window-content.h>
 #include <libxfdashboard/x11/window-tracker-window-x11.h>
 #include <libxfdashboard/application.h>
+#include <libxfdashboard/image-downscale.h>
 #include <libxfdashboard/marshal.h>
 #include <libxfdashboard/stylable.h>
+#include <libxfdashboard/view.h>
 #include <libxfdashboard/window-tracker.h>
 #include <libxfdashboard/enums.h>
 #include <libxfdashboard/compat.h>
@@ -64,6 +74,23 @@ typedef enum /*< skip,prefix=XFDASHBOARD_WINDOW_CONTENT_X11_WORKAROUND_MODE >*/
 	XFDASHBOARD_WINDOW_CONTENT_X11_WORKAROUND_MODE_DONE
 } XfdashboardWindowContentX11WorkaroundMode;
 
+typedef enum /*< skip,prefix=XFDASHBOARD_WINDOW_CONTENT_X11_RESUME_PRIORITY >*/
+{
+	XFDASHBOARD_WINDOW_CONTENT_X11_RESUME_PRIORITY_VISIBLE_ON_MONITOR=0,
+	XFDASHBOARD_WINDOW_CONTENT_X11_RESUME_PRIORITY_ACTIVE_WORKSPACE,
+	XFDASHBOARD_WINDOW_CONTENT_X11_RESUME_PRIORITY_OTHER_WORKSPACE,
+	XFDASHBOARD_WINDOW_CONTENT_X11_RESUME_PRIORITY_MINIMIZED,
+
+	XFDASHBOARD_WINDOW_CONTENT_X11_RESUME_PRIORITY_LAST
+} XfdashboardWindowContentX11ResumePriority;
+
+typedef enum /*< skip,prefix=XFDASHBOARD_WINDOW_CONTENT_X11_CAPTURE_MODE >*/
+{
+	XFDASHBOARD_WINDOW_CONTENT_X11_CAPTURE_MODE_AUTO=0,
+	XFDASHBOARD_WINDOW_CONTENT_X11_CAPTURE_MODE_COMPOSITE,
+	XFDASHBOARD_WINDOW_CONTENT_X11_CAPTURE_MODE_SOFTWARE
+} XfdashboardWindowContentX11CaptureMode;
+
 /* Define this class in GObject system */
 static void _xfdashboard_window_content_clutter_content_iface_init(ClutterContentIface *iface);
 static void _xfdashboard_window_content_x11_stylable_iface_init(XfdashboardStylableInterface *iface);
@@ -100,12 +127,16 @@ struct _XfdashboardWindowContentX11Private
 
 	/* Instance related */
 	gboolean									isFallback;
+	gboolean									isSnapshot;
 	CoglTexture									*texture;
 	Window										xWindowID;
 	Pixmap										pixmap;
 #ifdef HAVE_XDAMAGE
 	Damage										damage;
+	cairo_region_t								*damageRegion;
+	gint64										lastDamageFlushTime;
 #endif
+	GSList										*actors;
 
 	guint										suspendSignalID;
 	gboolean									isMapped;
@@ -116,6 +147,11 @@ struct _XfdashboardWindowContentX11Private
 	guint										workaroundStateSignalID;
 
 	gboolean									suspendAfterResumeOnIdle;
+	XfdashboardWindowContentX11ResumePriority	resumePriority;
+	gboolean									isDispatcherRegistered;
+#ifdef HAVE_XSHM
+	GList										*captureLink;
+#endif
 };
 
 /* Properties */
@@ -159,6 +195,28 @@ static GParamSpec* XfdashboardWindowContentX11Properties[PROP_LAST]={ 0, };
 #define WINDOW_CONTENT_CREATION_PRIORITY_XFCONF_PROP		"/window-content-creation-priority"
 #define DEFAULT_WINDOW_CONTENT_X11_CREATION_PRIORITY		"immediate"
 
+#define RESUME_ON_IDLE_TIME_BUDGET_MSEC						5
+
+#define WINDOW_CONTENT_SNAPSHOT_CACHE_LIMIT_XFCONF_PROP		"/window-content-snapshot-cache-limit"
+#define DEFAULT_WINDOW_CONTENT_SNAPSHOT_CACHE_LIMIT			32
+
+#define SNAPSHOT_MAX_SIZE									512
+
+#define WINDOW_CONTENT_MAX_UPDATE_RATE_XFCONF_PROP			"/window-content-max-update-rate"
+#define DEFAULT_WINDOW_CONTENT_MAX_UPDATE_RATE				0
+
+#define DAMAGE_FLUSH_PRIORITY								(CLUTTER_PRIORITY_REDRAW-10)
+#define DAMAGE_MAX_CLIP_RECTANGLES							16
+
+#define WINDOW_CONTENT_CAPTURE_MODE_XFCONF_PROP				"/window-content-capture-mode"
+#define DEFAULT_WINDOW_CONTENT_CAPTURE_MODE					"auto"
+
+#define CAPTURE_MAX_SIZE									256
+#define CAPTURE_CPU_USAGE_PERCENT							5
+#define CAPTURE_MIN_CYCLE_MSEC								1000
+#define CAPTURE_MIN_INTERVAL_MSEC							20
+#define CAPTURE_MAX_INTERVAL_MSEC							5000
+
 struct _XfdashboardWindowContentX11PriorityMap
 {
 	const gchar		*name;
@@ -166,13 +224,37 @@ struct _XfdashboardWindowContentX11PriorityMap
 };
 typedef struct _XfdashboardWindowContentX11PriorityMap		XfdashboardWindowContentX11PriorityMap;
 
+struct _XfdashboardWindowContentX11CaptureModeMap
+{
+	const gchar								*name;
+	XfdashboardWindowContentX11CaptureMode	mode;
+};
+typedef struct _XfdashboardWindowContentX11CaptureModeMap	XfdashboardWindowContentX11CaptureModeMap;
+
+struct _XfdashboardWindowContentX11Snapshot
+{
+	Window				xWindowID;
+	gint				width;
+	gint				height;
+	CoglTexture			*texture;
+	gsize				size;
+	GList				*link;
+};
+typedef struct _XfdashboardWindowContentX11Snapshot		XfdashboardWindowContentX11Snapshot;
+
 static gboolean									_xfdashboard_window_content_x11_have_checked_extensions=FALSE;
 static gboolean									_xfdashboard_window_content_x11_have_composite_extension=FALSE;
 static gboolean									_xfdashboard_window_content_x11_have_damage_extension=FALSE;
 static int										_xfdashboard_window_content_x11_damage_event_base=0;
+static gboolean									_xfdashboard_window_content_x11_have_fixes_regions=FALSE;
+static gboolean									_xfdashboard_window_content_x11_have_shm_extension=FALSE;
 
-static GList*									_xfdashboard_window_content_x11_resume_idle_queue=NULL;
+static GQueue									_xfdashboard_window_content_x11_resume_idle_queue[XFDASHBOARD_WINDOW_CONTENT_X11_RESUME_PRIORITY_LAST]={ G_QUEUE_INIT, };
 static guint									_xfdashboard_window_content_x11_resume_idle_id=0;
+static gint64									_xfdashboard_window_content_x11_resume_drain_start_time=0;
+static guint									_xfdashboard_window_content_x11_resume_drain_ticks=0;
+static guint									_xfdashboard_window_content_x11_resume_drain_count=0;
+static guint									_xfdashboard_window_content_x11_resume_max_queue_size=0;
 static guint									_xfdashboard_window_content_x11_resume_shutdown_signal_id=0;
 
 static guint									_xfdashboard_window_content_x11_xfconf_priority_notify_id=0;
@@ -187,9 +269,55 @@ static XfdashboardWindowContentX11PriorityMap	_xfdashboard_window_content_x11_wi
 												};
 static guint									_xfdashboard_window_content_x11_window_creation_shutdown_signal_id=0;
 
+static guint									_xfdashboard_window_content_x11_dispatcher_ref_count=0;
+static GHashTable*								_xfdashboard_window_content_x11_window_map=NULL;
+#ifdef HAVE_XDAMAGE
+static GHashTable*								_xfdashboard_window_content_x11_damage_map=NULL;
+
+static GSList*									_xfdashboard_window_content_x11_damage_queue=NULL;
+static XserverRegion							_xfdashboard_window_content_x11_damage_parts=None;
+static guint									_xfdashboard_window_content_x11_damage_flush_id=0;
+static gint64									_xfdashboard_window_content_x11_damage_flush_due_time=0;
+#endif
+
+static guint									_xfdashboard_window_content_x11_xfconf_max_update_rate_notify_id=0;
+static guint									_xfdashboard_window_content_x11_max_update_rate=DEFAULT_WINDOW_CONTENT_MAX_UPDATE_RATE;
+
+static GHashTable*								_xfdashboard_window_content_x11_snapshot_cache=NULL;
+static GQueue									_xfdashboard_window_content_x11_snapshot_cache_lru=G_QUEUE_INIT;
+static gsize									_xfdashboard_window_content_x11_snapshot_cache_size=0;
+static guint									_xfdashboard_window_content_x11_snapshot_cache_limit=DEFAULT_WINDOW_CONTENT_SNAPSHOT_CACHE_LIMIT;
+static guint									_xfdashboard_window_content_x11_snapshot_cache_stores=0;
+static guint									_xfdashboard_window_content_x11_snapshot_cache_hits=0;
+static guint									_xfdashboard_window_content_x11_snapshot_cache_misses=0;
+static guint									_xfdashboard_window_content_x11_snapshot_cache_evictions=0;
+static guint									_xfdashboard_window_content_x11_snapshot_cache_shutdown_signal_id=0;
+static XfdashboardWindowTracker*				_xfdashboard_window_content_x11_snapshot_cache_window_tracker=NULL;
+static guint									_xfdashboard_window_content_x11_snapshot_cache_window_closed_signal_id=0;
+static guint									_xfdashboard_window_content_x11_xfconf_snapshot_cache_limit_notify_id=0;
+
+static guint									_xfdashboard_window_content_x11_xfconf_capture_mode_notify_id=0;
+static XfdashboardWindowContentX11CaptureMode	_xfdashboard_window_content_x11_capture_mode=XFDASHBOARD_WINDOW_CONTENT_X11_CAPTURE_MODE_AUTO;
+static XfdashboardWindowContentX11CaptureModeMap	_xfdashboard_window_content_x11_capture_mode_map[]=
+												{
+													{ "auto", XFDASHBOARD_WINDOW_CONTENT_X11_CAPTURE_MODE_AUTO }, /* First entry is default value */
+													{ "composite", XFDASHBOARD_WINDOW_CONTENT_X11_CAPTURE_MODE_COMPOSITE },
+													{ "software", XFDASHBOARD_WINDOW_CONTENT_X11_CAPTURE_MODE_SOFTWARE },
+													{ NULL, 0 },
+												};
+#ifdef HAVE_XSHM
+static GQueue									_xfdashboard_window_content_x11_capture_queue=G_QUEUE_INIT;
+static guint									_xfdashboard_window_content_x11_capture_id=0;
+static gint64									_xfdashboard_window_content_x11_capture_cost=0;
+static XShmSegmentInfo							_xfdashboard_window_content_x11_capture_segment={ 0, -1, NULL, False };
+static gsize									_xfdashboard_window_content_x11_capture_segment_size=0;
+#endif
+
 /* Forward declarations */
 static void _xfdashboard_window_content_x11_suspend(XfdashboardWindowContentX11 *self);
+static void _xfdashboard_window_content_x11_suspend_full(XfdashboardWindowContentX11 *self, gboolean inStoreSnapshot);
 static void _xfdashboard_window_content_x11_resume(XfdashboardWindowContentX11 *self);
+static void _xfdashboard_window_content_x11_resume_queued(XfdashboardWindowContentX11 *self);
 static gboolean _xfdashboard_window_content_x11_resume_on_idle(gpointer inUserData);
 
 /* Get X server display */
@@ -221,11 +349,65 @@ static Display* _xfdashboard_window_content_x11_get_display(void)
 	return(display);
 }
 
+/* Get priority of window content in resume queue */
+static XfdashboardWindowContentX11ResumePriority _xfdashboard_window_content_x11_get_resume_priority(XfdashboardWindowContentX11 *self)
+{
+	XfdashboardWindowContentX11Private		*priv;
+	XfdashboardWindowTrackerWindow			*window;
+	XfdashboardWindowTrackerWorkspace		*workspace;
+	XfdashboardWindowTrackerMonitor			*monitor;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self), XFDASHBOARD_WINDOW_CONTENT_X11_RESUME_PRIORITY_MINIMIZED);
+
+	priv=self->priv;
+	window=XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window);
+
+	/* Minimized windows are resumed last */
+	if(xfdashboard_window_tracker_window_get_state(window) & XFDASHBOARD_WINDOW_TRACKER_WINDOW_STATE_MINIMIZED)
+	{
+		return(XFDASHBOARD_WINDOW_CONTENT_X11_RESUME_PRIORITY_MINIMIZED);
+	}
+
+	/* Windows on other workspaces than the active one are resumed before minimized ones */
+	workspace=xfdashboard_window_tracker_get_active_workspace(priv->windowTracker);
+	if(workspace && !xfdashboard_window_tracker_window_is_on_workspace(window, workspace))
+	{
+		return(XFDASHBOARD_WINDOW_CONTENT_X11_RESUME_PRIORITY_OTHER_WORKSPACE);
+	}
+
+	/* Windows visible at primary monitor, where the dashboard is shown, are
+	 * resumed first, all others windows on active workspace right after them.
+	 */
+	monitor=xfdashboard_window_tracker_get_primary_monitor(priv->windowTracker);
+	if(monitor && !xfdashboard_window_tracker_window_is_visible_on_monitor(window, monitor))
+	{
+		return(XFDASHBOARD_WINDOW_CONTENT_X11_RESUME_PRIORITY_ACTIVE_WORKSPACE);
+	}
+
+	return(XFDASHBOARD_WINDOW_CONTENT_X11_RESUME_PRIORITY_VISIBLE_ON_MONITOR);
+}
+
+/* Get number of window contents in all priorities of resume queue */
+static guint _xfdashboard_window_content_x11_get_resume_queue_length(void)
+{
+	guint									length;
+	gint									priority;
+
+	length=0;
+	for(priority=0; priority<XFDASHBOARD_WINDOW_CONTENT_X11_RESUME_PRIORITY_LAST; priority++)
+	{
+		length+=g_queue_get_length(&_xfdashboard_window_content_x11_resume_idle_queue[priority]);
+	}
+
+	return(length);
+}
+
 /* Remove all entries from resume queue and release all allocated resources */
 static void _xfdashboard_window_content_x11_destroy_resume_queue(void)
 {
 	XfdashboardApplication					*application;
 	gint									queueSize;
+	gint									priority;
 
 	/* Disconnect application "shutdown" signal handler */
 	if(_xfdashboard_window_content_x11_resume_shutdown_signal_id)
@@ -251,31 +433,36 @@ static void _xfdashboard_window_content_x11_destroy_resume_queue(void)
 	}
 
 	/* Destroy resume-on-idle queue if available*/
-	if(_xfdashboard_window_content_x11_resume_idle_queue)
+	queueSize=_xfdashboard_window_content_x11_get_resume_queue_length();
+	if(queueSize>0)
 	{
-		queueSize=g_list_length(_xfdashboard_window_content_x11_resume_idle_queue);
-		if(queueSize>0) g_warning(_("Destroying window content resume queue containing %d windows."), queueSize);
+		g_warning(_("Destroying window content resume queue containing %d windows."), queueSize);
 #ifdef DEBUG
-		if(queueSize>0)
 		{
 			GList								*iter;
 			XfdashboardWindowContentX11			*content;
 			XfdashboardWindowTrackerWindow		*window;
 
-			for(iter=_xfdashboard_window_content_x11_resume_idle_queue; iter; iter=g_list_next(iter))
+			for(priority=0; priority<XFDASHBOARD_WINDOW_CONTENT_X11_RESUME_PRIORITY_LAST; priority++)
 			{
-				content=XFDASHBOARD_WINDOW_CONTENT_X11(iter->data);
-				window=xfdashboard_window_content_x11_get_window(content);
-				g_print("Window content in resume queue: Item %s@%p for window '%s'\n",
-							G_OBJECT_TYPE_NAME(content), content,
-							xfdashboard_window_tracker_window_get_name(window));
+				for(iter=_xfdashboard_window_content_x11_resume_idle_queue[priority].head; iter; iter=g_list_next(iter))
+				{
+					content=XFDASHBOARD_WINDOW_CONTENT_X11(iter->data);
+					window=xfdashboard_window_content_x11_get_window(content);
+					g_print("Window content in resume queue: Item %s@%p for window '%s' with priority %d\n",
+								G_OBJECT_TYPE_NAME(content), content,
+								xfdashboard_window_tracker_window_get_name(window),
+								priority);
+				}
 			}
 		}
 #endif
 
 		XFDASHBOARD_DEBUG(NULL, WINDOWS, "Destroying window content resume queue");
-		g_list_free(_xfdashboard_window_content_x11_resume_idle_queue);
-		_xfdashboard_window_content_x11_resume_idle_queue=NULL;
+		for(priority=0; priority<XFDASHBOARD_WINDOW_CONTENT_X11_RESUME_PRIORITY_LAST; priority++)
+		{
+			g_queue_clear(&_xfdashboard_window_content_x11_resume_idle_queue[priority]);
+		}
 	}
 }
 
@@ -288,29 +475,18 @@ static void _xfdashboard_window_content_x11_resume_on_idle_remove(XfdashboardWin
 
 	priv=self->priv;
 
-	/* Remove window content from queue */
-	if(_xfdashboard_window_content_x11_resume_idle_queue)
+	/* Lookup window content in queue of its priority and remove it from queue */
+	if(g_queue_remove(&_xfdashboard_window_content_x11_resume_idle_queue[priv->resumePriority], self))
 	{
-		GList								*queueEntry;
-
-		/* Lookup window content in queue and remove it from queue. If queue is empty
-		 * after removal, remove idle source also.
-		 */
-		queueEntry=g_list_find(_xfdashboard_window_content_x11_resume_idle_queue, self);
-		if(queueEntry)
-		{
-			/* Remove window content from queue */
-			_xfdashboard_window_content_x11_resume_idle_queue=g_list_delete_link(_xfdashboard_window_content_x11_resume_idle_queue, queueEntry);
-			XFDASHBOARD_DEBUG(self, WINDOWS,
-								"Removed queue entry %p for window '%s' because of releasing resources",
-								queueEntry,
-								xfdashboard_window_tracker_window_get_name(XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window)));
-		}
+		XFDASHBOARD_DEBUG(self, WINDOWS,
+							"Removed queued window resume of '%s' with priority %d because of releasing resources",
+							xfdashboard_window_tracker_window_get_name(XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window)),
+							priv->resumePriority);
 	}
 
 	/* If queue is empty remove idle source as well */
-	if(!_xfdashboard_window_content_x11_resume_idle_queue &&
-		_xfdashboard_window_content_x11_resume_idle_id)
+	if(_xfdashboard_window_content_x11_resume_idle_id &&
+		_xfdashboard_window_content_x11_get_resume_queue_length()==0)
 	{
 		XFDASHBOARD_DEBUG(self, WINDOWS,
 							"Removing idle source with ID %u because queue is empty",
@@ -325,6 +501,7 @@ static void _xfdashboard_window_content_x11_resume_on_idle_remove(XfdashboardWin
 static void _xfdashboard_window_content_x11_resume_on_idle_add(XfdashboardWindowContentX11 *self)
 {
 	XfdashboardWindowContentX11Private		*priv;
+	guint									queueSize;
 
 	g_return_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self));
 
@@ -335,20 +512,35 @@ static void _xfdashboard_window_content_x11_resume_on_idle_add(XfdashboardWindow
 						xfdashboard_window_tracker_window_get_name(XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window)));
 
 	/* Only add callback to resume window content if no one was added */
-	if(!g_list_find(_xfdashboard_window_content_x11_resume_idle_queue, self))
+	if(!g_queue_find(&_xfdashboard_window_content_x11_resume_idle_queue[priv->resumePriority], self))
 	{
-		/* Queue window content for resume */
-		_xfdashboard_window_content_x11_resume_idle_queue=g_list_append(_xfdashboard_window_content_x11_resume_idle_queue, self);
+		/* Queue window content for resume at its priority */
+		priv->resumePriority=_xfdashboard_window_content_x11_get_resume_priority(self);
+		g_queue_push_tail(&_xfdashboard_window_content_x11_resume_idle_queue[priv->resumePriority], self);
+
+		/* Update statistics about draining the queue */
+		queueSize=_xfdashboard_window_content_x11_get_resume_queue_length();
+		if(queueSize==1)
+		{
+			_xfdashboard_window_content_x11_resume_drain_start_time=g_get_monotonic_time();
+			_xfdashboard_window_content_x11_resume_drain_ticks=0;
+			_xfdashboard_window_content_x11_resume_drain_count=0;
+			_xfdashboard_window_content_x11_resume_max_queue_size=0;
+		}
+		if(queueSize>_xfdashboard_window_content_x11_resume_max_queue_size) _xfdashboard_window_content_x11_resume_max_queue_size=queueSize;
+
 		XFDASHBOARD_DEBUG(self, WINDOWS,
-							"Queued window resume of '%s'",
-							xfdashboard_window_tracker_window_get_name(XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window)));
+							"Queued window resume of '%s' with priority %d at queue depth %u",
+							xfdashboard_window_tracker_window_get_name(XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window)),
+							priv->resumePriority,
+							queueSize);
 	}
 
 	/* Create idle source for resuming queued window contents but with
 	 * high priority to get window content created as soon as possible.
 	 */
-	if(_xfdashboard_window_content_x11_resume_idle_queue &&
-		!_xfdashboard_window_content_x11_resume_idle_id)
+	if(!_xfdashboard_window_content_x11_resume_idle_id &&
+		_xfdashboard_window_content_x11_get_resume_queue_length()>0)
 	{
 		_xfdashboard_window_content_x11_resume_idle_id=clutter_threads_add_idle_full(_xfdashboard_window_content_x11_window_creation_priority,
 																				_xfdashboard_window_content_x11_resume_on_idle,
@@ -377,6 +569,338 @@ static void _xfdashboard_window_content_x11_resume_on_idle_add(XfdashboardWindow
 	}
 }
 
+/* Free snapshot of window content */
+static void _xfdashboard_window_content_x11_snapshot_free(XfdashboardWindowContentX11Snapshot *inSnapshot)
+{
+	g_return_if_fail(inSnapshot);
+
+	/* Release allocated resources */
+	if(inSnapshot->texture) cogl_object_unref(inSnapshot->texture);
+	g_free(inSnapshot);
+}
+
+/* Remove snapshot from snapshot cache and free it */
+static void _xfdashboard_window_content_x11_snapshot_cache_remove(XfdashboardWindowContentX11Snapshot *inSnapshot)
+{
+	g_return_if_fail(inSnapshot);
+	g_return_if_fail(_xfdashboard_window_content_x11_snapshot_cache);
+
+	g_queue_delete_link(&_xfdashboard_window_content_x11_snapshot_cache_lru, inSnapshot->link);
+	_xfdashboard_window_content_x11_snapshot_cache_size-=inSnapshot->size;
+	g_hash_table_remove(_xfdashboard_window_content_x11_snapshot_cache, GUINT_TO_POINTER(inSnapshot->xWindowID));
+}
+
+/* Evict least recently used snapshots until size of snapshot cache fits into limit */
+static void _xfdashboard_window_content_x11_snapshot_cache_evict(gsize inLimit)
+{
+	XfdashboardWindowContentX11Snapshot		*snapshot;
+
+	while(_xfdashboard_window_content_x11_snapshot_cache_size>inLimit &&
+			_xfdashboard_window_content_x11_snapshot_cache_lru.tail)
+	{
+		snapshot=(XfdashboardWindowContentX11Snapshot*)_xfdashboard_window_content_x11_snapshot_cache_lru.tail->data;
+		_xfdashboard_window_content_x11_snapshot_cache_evictions++;
+
+		XFDASHBOARD_DEBUG(NULL, WINDOWS,
+							"Evicting snapshot of %" G_GSIZE_FORMAT " bytes for window 0x%lx from snapshot cache of %" G_GSIZE_FORMAT " bytes (limit %" G_GSIZE_FORMAT " bytes, %u evictions)",
+							snapshot->size,
+							snapshot->xWindowID,
+							_xfdashboard_window_content_x11_snapshot_cache_size,
+							inLimit,
+							_xfdashboard_window_content_x11_snapshot_cache_evictions);
+
+		_xfdashboard_window_content_x11_snapshot_cache_remove(snapshot);
+	}
+}
+
+/* Remove snapshot of a destroyed window from snapshot cache so that a new
+ * window reusing the X window ID does not show the last frame of it.
+ */
+static void _xfdashboard_window_content_x11_snapshot_cache_forget(Window inXWindowID)
+{
+	XfdashboardWindowContentX11Snapshot		*snapshot;
+
+	if(!_xfdashboard_window_content_x11_snapshot_cache) return;
+
+	snapshot=g_hash_table_lookup(_xfdashboard_window_content_x11_snapshot_cache, GUINT_TO_POINTER(inXWindowID));
+	if(!snapshot) return;
+
+	XFDASHBOARD_DEBUG(NULL, WINDOWS,
+						"Removing snapshot of %" G_GSIZE_FORMAT " bytes for destroyed window 0x%lx from snapshot cache",
+						snapshot->size,
+						snapshot->xWindowID);
+
+	_xfdashboard_window_content_x11_snapshot_cache_remove(snapshot);
+}
+
+/* A window was closed so remove its snapshot from snapshot cache. This also
+ * covers windows which have no window content anymore to receive the X event
+ * when the window is destroyed.
+ */
+static void _xfdashboard_window_content_x11_on_snapshot_cache_window_closed(XfdashboardWindowTracker *inWindowTracker,
+																				XfdashboardWindowTrackerWindow *inWindow,
+																				gpointer inUserData)
+{
+	g_return_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_WINDOW_X11(inWindow));
+
+	_xfdashboard_window_content_x11_snapshot_cache_forget(xfdashboard_window_tracker_window_x11_get_xid(XFDASHBOARD_WINDOW_TRACKER_WINDOW_X11(inWindow)));
+}
+
+/* Destroy snapshot cache and release all allocated resources */
+static void _xfdashboard_window_content_x11_snapshot_cache_destroy(void)
+{
+	XfdashboardApplication					*application;
+
+	/* Disconnect application "shutdown" signal handler */
+	if(_xfdashboard_window_content_x11_snapshot_cache_shutdown_signal_id)
+	{
+		application=xfdashboard_application_get_default();
+		g_signal_handler_disconnect(application, _xfdashboard_window_content_x11_snapshot_cache_shutdown_signal_id);
+		_xfdashboard_window_content_x11_snapshot_cache_shutdown_signal_id=0;
+	}
+
+	/* Disconnect window tracker "window-closed" signal handler */
+	if(_xfdashboard_window_content_x11_snapshot_cache_window_tracker)
+	{
+		if(_xfdashboard_window_content_x11_snapshot_cache_window_closed_signal_id)
+		{
+			g_signal_handler_disconnect(_xfdashboard_window_content_x11_snapshot_cache_window_tracker, _xfdashboard_window_content_x11_snapshot_cache_window_closed_signal_id);
+			_xfdashboard_window_content_x11_snapshot_cache_window_closed_signal_id=0;
+		}
+
+		g_object_unref(_xfdashboard_window_content_x11_snapshot_cache_window_tracker);
+		_xfdashboard_window_content_x11_snapshot_cache_window_tracker=NULL;
+	}
+
+	/* Destroy snapshot cache */
+	if(_xfdashboard_window_content_x11_snapshot_cache)
+	{
+		XFDASHBOARD_DEBUG(NULL, WINDOWS,
+							"Destroying snapshot cache with %u snapshots of %" G_GSIZE_FORMAT " bytes - %u stores, %u hits, %u misses, %u evictions",
+							g_hash_table_size(_xfdashboard_window_content_x11_snapshot_cache),
+							_xfdashboard_window_content_x11_snapshot_cache_size,
+							_xfdashboard_window_content_x11_snapshot_cache_stores,
+							_xfdashboard_window_content_x11_snapshot_cache_hits,
+							_xfdashboard_window_content_x11_snapshot_cache_misses,
+							_xfdashboard_window_content_x11_snapshot_cache_evictions);
+
+		g_queue_clear(&_xfdashboard_window_content_x11_snapshot_cache_lru);
+		g_hash_table_destroy(_xfdashboard_window_content_x11_snapshot_cache);
+		_xfdashboard_window_content_x11_snapshot_cache=NULL;
+		_xfdashboard_window_content_x11_snapshot_cache_size=0;
+	}
+}
+
+/* Create downscaled copy of window texture by rendering it into an offscreen texture */
+static CoglTexture* _xfdashboard_window_content_x11_create_snapshot_texture(CoglTexture *inTexture)
+{
+#if COGL_VERSION_CHECK(1, 18, 0)
+	CoglContext								*context;
+	CoglTexture								*snapshotTexture;
+	CoglOffscreen							*offscreen;
+	CoglPipeline							*pipeline;
+	CoglError								*error;
+	gint									textureWidth;
+	gint									textureHeight;
+	gint									width;
+	gint									height;
+	gfloat									scale;
+
+	g_return_val_if_fail(inTexture, NULL);
+
+	error=NULL;
+
+	/* Determine size of snapshot */
+	textureWidth=cogl_texture_get_width(inTexture);
+	textureHeight=cogl_texture_get_height(inTexture);
+	if(textureWidth<=0 || textureHeight<=0) return(NULL);
+
+	scale=MIN(1.0f, ((gfloat)SNAPSHOT_MAX_SIZE)/MAX(textureWidth, textureHeight));
+	width=MAX(1, (gint)(textureWidth*scale));
+	height=MAX(1, (gint)(textureHeight*scale));
+
+	/* Create texture for snapshot and offscreen framebuffer to render into it */
+	context=clutter_backend_get_cogl_context(clutter_get_default_backend());
+	snapshotTexture=COGL_TEXTURE(cogl_texture_2d_new_with_size(context, width, height));
+	offscreen=cogl_offscreen_new_with_texture(snapshotTexture);
+	if(!cogl_framebuffer_allocate(COGL_FRAMEBUFFER(offscreen), &error))
+	{
+		XFDASHBOARD_DEBUG(NULL, WINDOWS,
+							"Could not allocate offscreen framebuffer for snapshot of size %dx%d: %s",
+							width,
+							height,
+							(error && error->message) ? error->message : _("Unknown error"));
+
+		/* Release allocated resources */
+		if(error) cogl_error_free(error);
+		cogl_object_unref(offscreen);
+		cogl_object_unref(snapshotTexture);
+
+		return(NULL);
+	}
+
+	/* Render window texture downscaled into snapshot texture */
+	pipeline=cogl_pipeline_new(context);
+	cogl_pipeline_set_layer_texture(pipeline, 0, inTexture);
+	cogl_pipeline_set_layer_filters(pipeline, 0, COGL_PIPELINE_FILTER_LINEAR, COGL_PIPELINE_FILTER_LINEAR);
+
+	cogl_framebuffer_orthographic(COGL_FRAMEBUFFER(offscreen), 0, 0, width, height, -1, 1);
+	cogl_framebuffer_clear4f(COGL_FRAMEBUFFER(offscreen), COGL_BUFFER_BIT_COLOR, 0.0f, 0.0f, 0.0f, 0.0f);
+	cogl_framebuffer_draw_rectangle(COGL_FRAMEBUFFER(offscreen), pipeline, 0, 0, width, height);
+
+	/* Submit journaled rendering to GL as the pixmap of window texture is
+	 * going to be released right after the snapshot was taken. Commands are
+	 * executed in order by GL so there is no need to block until rendering
+	 * finished.
+	 */
+	cogl_flush();
+
+	/* Release allocated resources */
+	cogl_object_unref(pipeline);
+	cogl_object_unref(offscreen);
+
+	/* Return snapshot texture */
+	return(snapshotTexture);
+#else
+	/* Rendering into offscreen textures is not supported with this cogl version */
+	return(NULL);
+#endif
+}
+
+/* Take snapshot of current live window texture and store it in snapshot cache.
+ * Returns snapshot texture which is owned by snapshot cache or NULL.
+ */
+static CoglTexture* _xfdashboard_window_content_x11_snapshot_cache_store(XfdashboardWindowContentX11 *self)
+{
+	XfdashboardWindowContentX11Private		*priv;
+	XfdashboardWindowContentX11Snapshot		*snapshot;
+	CoglTexture								*snapshotTexture;
+	gsize									limit;
+	gsize									size;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self), NULL);
+
+	priv=self->priv;
+
+	/* Only a live window texture can be stored in snapshot cache if enabled */
+	limit=((gsize)_xfdashboard_window_content_x11_snapshot_cache_limit)*1024*1024;
+	if(!limit) return(NULL);
+
+	if(!priv->texture ||
+		priv->isFallback ||
+		priv->isSnapshot ||
+		priv->xWindowID==None ||
+		priv->pixmap==None)
+	{
+		return(NULL);
+	}
+
+	/* Take snapshot */
+	snapshotTexture=_xfdashboard_window_content_x11_create_snapshot_texture(priv->texture);
+	if(!snapshotTexture) return(NULL);
+
+	size=cogl_texture_get_width(snapshotTexture)*cogl_texture_get_height(snapshotTexture)*4;
+	if(size>limit)
+	{
+		cogl_object_unref(snapshotTexture);
+		return(NULL);
+	}
+
+	/* Create snapshot cache if not done already */
+	if(!_xfdashboard_window_content_x11_snapshot_cache)
+	{
+		_xfdashboard_window_content_x11_snapshot_cache=g_hash_table_new_full(g_direct_hash,
+																				g_direct_equal,
+																				NULL,
+																				(GDestroyNotify)_xfdashboard_window_content_x11_snapshot_free);
+	}
+
+	if(!_xfdashboard_window_content_x11_snapshot_cache_shutdown_signal_id)
+	{
+		_xfdashboard_window_content_x11_snapshot_cache_shutdown_signal_id=g_signal_connect(xfdashboard_application_get_default(),
+																							"shutdown-final",
+																							G_CALLBACK(_xfdashboard_window_content_x11_snapshot_cache_destroy),
+																							NULL);
+	}
+
+	if(!_xfdashboard_window_content_x11_snapshot_cache_window_tracker)
+	{
+		_xfdashboard_window_content_x11_snapshot_cache_window_tracker=xfdashboard_window_tracker_get_default();
+		_xfdashboard_window_content_x11_snapshot_cache_window_closed_signal_id=g_signal_connect(_xfdashboard_window_content_x11_snapshot_cache_window_tracker,
+																								"window-closed",
+																								G_CALLBACK(_xfdashboard_window_content_x11_on_snapshot_cache_window_closed),
+																								NULL);
+	}
+
+	/* Replace any older snapshot of this window */
+	snapshot=g_hash_table_lookup(_xfdashboard_window_content_x11_snapshot_cache, GUINT_TO_POINTER(priv->xWindowID));
+	if(snapshot) _xfdashboard_window_content_x11_snapshot_cache_remove(snapshot);
+
+	/* Add snapshot as most recently used one and evict older ones if limit is exceeded */
+	snapshot=g_new0(XfdashboardWindowContentX11Snapshot, 1);
+	snapshot->xWindowID=priv->xWindowID;
+	snapshot->width=cogl_texture_get_width(priv->texture);
+	snapshot->height=cogl_texture_get_height(priv->texture);
+	snapshot->texture=snapshotTexture;
+	snapshot->size=size;
+
+	g_queue_push_head(&_xfdashboard_window_content_x11_snapshot_cache_lru, snapshot);
+	snapshot->link=_xfdashboard_window_content_x11_snapshot_cache_lru.head;
+	g_hash_table_insert(_xfdashboard_window_content_x11_snapshot_cache, GUINT_TO_POINTER(snapshot->xWindowID), snapshot);
+	_xfdashboard_window_content_x11_snapshot_cache_size+=size;
+	_xfdashboard_window_content_x11_snapshot_cache_stores++;
+
+	XFDASHBOARD_DEBUG(self, WINDOWS,
+						"Stored snapshot of %dx%d pixels for window '%s' in snapshot cache of %" G_GSIZE_FORMAT " bytes",
+						cogl_texture_get_width(snapshotTexture),
+						cogl_texture_get_height(snapshotTexture),
+						xfdashboard_window_tracker_window_get_name(XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window)),
+						_xfdashboard_window_content_x11_snapshot_cache_size);
+
+	_xfdashboard_window_content_x11_snapshot_cache_evict(limit);
+
+	/* Return snapshot texture if it was not evicted immediately */
+	snapshot=g_hash_table_lookup(_xfdashboard_window_content_x11_snapshot_cache, GUINT_TO_POINTER(priv->xWindowID));
+	return(snapshot ? snapshot->texture : NULL);
+}
+
+/* Look up snapshot of window with requested size in snapshot cache.
+ * Returns snapshot texture which is owned by snapshot cache or NULL.
+ */
+static CoglTexture* _xfdashboard_window_content_x11_snapshot_cache_lookup(Window inXWindowID, gint inWidth, gint inHeight)
+{
+	XfdashboardWindowContentX11Snapshot		*snapshot;
+
+	snapshot=NULL;
+	if(_xfdashboard_window_content_x11_snapshot_cache)
+	{
+		snapshot=g_hash_table_lookup(_xfdashboard_window_content_x11_snapshot_cache, GUINT_TO_POINTER(inXWindowID));
+	}
+
+	/* A snapshot of a different size is outdated or of another window
+	 * which reused the X window ID.
+	 */
+	if(snapshot &&
+		(snapshot->width!=inWidth || snapshot->height!=inHeight))
+	{
+		_xfdashboard_window_content_x11_snapshot_cache_remove(snapshot);
+		snapshot=NULL;
+	}
+
+	if(!snapshot)
+	{
+		_xfdashboard_window_content_x11_snapshot_cache_misses++;
+		return(NULL);
+	}
+
+	/* Mark snapshot as most recently used one */
+	g_queue_unlink(&_xfdashboard_window_content_x11_snapshot_cache_lru, snapshot->link);
+	g_queue_push_head_link(&_xfdashboard_window_content_x11_snapshot_cache_lru, snapshot->link);
+	_xfdashboard_window_content_x11_snapshot_cache_hits++;
+
+	return(snapshot->texture);
+}
+
 /* Value for window creation priority in xfconf has changed */
 static void _xfdashboard_window_content_x11_on_window_creation_priority_value_changed(XfconfChannel *inChannel,
 																					const gchar *inProperty,
@@ -418,6 +942,100 @@ static void _xfdashboard_window_content_x11_on_window_creation_priority_value_ch
 	}
 }
 
+/* Value for maximum update rate of window contents in xfconf has changed */
+static void _xfdashboard_window_content_x11_on_max_update_rate_value_changed(XfconfChannel *inChannel,
+																				const gchar *inProperty,
+																				const GValue *inValue,
+																				gpointer inUserData)
+{
+	g_return_if_fail(g_strcmp0(inProperty, WINDOW_CONTENT_MAX_UPDATE_RATE_XFCONF_PROP)==0);
+
+	/* Set new maximum update rate or default value if property was reset */
+	if(inValue && G_VALUE_HOLDS_UINT(inValue))
+	{
+		_xfdashboard_window_content_x11_max_update_rate=g_value_get_uint(inValue);
+	}
+		else if(inValue && G_VALUE_HOLDS_INT(inValue))
+		{
+			_xfdashboard_window_content_x11_max_update_rate=MAX(0, g_value_get_int(inValue));
+		}
+		else
+		{
+			_xfdashboard_window_content_x11_max_update_rate=DEFAULT_WINDOW_CONTENT_MAX_UPDATE_RATE;
+		}
+
+	XFDASHBOARD_DEBUG(NULL, WINDOWS,
+						"Setting maximum update rate of window contents not hovered or selected to %u updates per second",
+						_xfdashboard_window_content_x11_max_update_rate);
+}
+
+/* Value for memory limit of snapshot cache in xfconf has changed */
+static void _xfdashboard_window_content_x11_on_snapshot_cache_limit_value_changed(XfconfChannel *inChannel,
+																					const gchar *inProperty,
+																					const GValue *inValue,
+																					gpointer inUserData)
+{
+	g_return_if_fail(g_strcmp0(inProperty, WINDOW_CONTENT_SNAPSHOT_CACHE_LIMIT_XFCONF_PROP)==0);
+
+	/* Set new memory limit or default value if property was reset */
+	if(inValue && G_VALUE_HOLDS_UINT(inValue))
+	{
+		_xfdashboard_window_content_x11_snapshot_cache_limit=g_value_get_uint(inValue);
+	}
+		else if(inValue && G_VALUE_HOLDS_INT(inValue))
+		{
+			_xfdashboard_window_content_x11_snapshot_cache_limit=MAX(0, g_value_get_int(inValue));
+		}
+		else
+		{
+			_xfdashboard_window_content_x11_snapshot_cache_limit=DEFAULT_WINDOW_CONTENT_SNAPSHOT_CACHE_LIMIT;
+		}
+
+	XFDASHBOARD_DEBUG(NULL, WINDOWS,
+						"Setting memory limit of snapshot cache to %u MiB",
+						_xfdashboard_window_content_x11_snapshot_cache_limit);
+
+	/* Evict snapshots exceeding new limit */
+	_xfdashboard_window_content_x11_snapshot_cache_evict(((gsize)_xfdashboard_window_content_x11_snapshot_cache_limit)*1024*1024);
+}
+
+/* Value for capture mode of window contents in xfconf has changed */
+static void _xfdashboard_window_content_x11_on_capture_mode_value_changed(XfconfChannel *inChannel,
+																			const gchar *inProperty,
+																			const GValue *inValue,
+																			gpointer inUserData)
+{
+	const gchar									*modeValue;
+	XfdashboardWindowContentX11CaptureModeMap	*found;
+
+	g_return_if_fail(g_strcmp0(inProperty, WINDOW_CONTENT_CAPTURE_MODE_XFCONF_PROP)==0);
+
+	/* Determine capture mode from new value or use default value if property was reset */
+	modeValue=DEFAULT_WINDOW_CONTENT_CAPTURE_MODE;
+	if(inValue && G_VALUE_HOLDS_STRING(inValue)) modeValue=g_value_get_string(inValue);
+
+	found=_xfdashboard_window_content_x11_capture_mode_map;
+	while(found->name && g_strcmp0(modeValue, found->name)!=0) found++;
+
+	/* Set default value if no match was found in capture mode map */
+	if(!found->name)
+	{
+		/* Default value is the first one in mapping */
+		found=_xfdashboard_window_content_x11_capture_mode_map;
+
+		g_warning(_("Unknown value '%s' for property '%s' - defaulting to '%s'"),
+					modeValue,
+					inProperty,
+					found->name);
+	}
+
+	/* Set capture mode. It will take effect when window contents are resumed next time. */
+	_xfdashboard_window_content_x11_capture_mode=found->mode;
+	XFDASHBOARD_DEBUG(NULL, WINDOWS,
+						"Setting capture mode of window contents to '%s'",
+						found->name);
+}
+
 /* Disconnect signal handler for xfconf value change notification on window priority */
 static void _xfdashboard_window_content_x11_on_window_creation_priority_shutdown(void)
 {
@@ -448,21 +1066,60 @@ static void _xfdashboard_window_content_x11_on_window_creation_priority_shutdown
 		g_signal_handler_disconnect(xfconfChannel, _xfdashboard_window_content_x11_xfconf_priority_notify_id);
 		_xfdashboard_window_content_x11_xfconf_priority_notify_id=0;
 	}
-}
 
-/* Check if we should workaround unmapped window for requested window and set up workaround */
-static void _xfdashboard_window_content_x11_on_workaround_state_changed(XfdashboardWindowContentX11 *self,
-																	gpointer inUserData)
-{
-	XfdashboardWindowContentX11Private		*priv;
-	XfdashboardWindowTrackerWindowState		windowState;
+	if(_xfdashboard_window_content_x11_xfconf_max_update_rate_notify_id)
+	{
+		XfconfChannel					*xfconfChannel;
 
-	g_return_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self));
-	g_return_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_WINDOW_X11(inUserData));
+		XFDASHBOARD_DEBUG(NULL, WINDOWS,
+							"Disconnecting property changed signal handler %u for maximum update rate value change notifications",
+							_xfdashboard_window_content_x11_xfconf_max_update_rate_notify_id);
 
-	priv=self->priv;
+		xfconfChannel=xfdashboard_application_get_xfconf_channel(NULL);
+		g_signal_handler_disconnect(xfconfChannel, _xfdashboard_window_content_x11_xfconf_max_update_rate_notify_id);
+		_xfdashboard_window_content_x11_xfconf_max_update_rate_notify_id=0;
+	}
 
-	/* Handle state change of window */
+	if(_xfdashboard_window_content_x11_xfconf_snapshot_cache_limit_notify_id)
+	{
+		XfconfChannel					*xfconfChannel;
+
+		XFDASHBOARD_DEBUG(NULL, WINDOWS,
+							"Disconnecting property changed signal handler %u for snapshot cache limit value change notifications",
+							_xfdashboard_window_content_x11_xfconf_snapshot_cache_limit_notify_id);
+
+		xfconfChannel=xfdashboard_application_get_xfconf_channel(NULL);
+		g_signal_handler_disconnect(xfconfChannel, _xfdashboard_window_content_x11_xfconf_snapshot_cache_limit_notify_id);
+		_xfdashboard_window_content_x11_xfconf_snapshot_cache_limit_notify_id=0;
+	}
+
+	if(_xfdashboard_window_content_x11_xfconf_capture_mode_notify_id)
+	{
+		XfconfChannel					*xfconfChannel;
+
+		XFDASHBOARD_DEBUG(NULL, WINDOWS,
+							"Disconnecting property changed signal handler %u for capture mode value change notifications",
+							_xfdashboard_window_content_x11_xfconf_capture_mode_notify_id);
+
+		xfconfChannel=xfdashboard_application_get_xfconf_channel(NULL);
+		g_signal_handler_disconnect(xfconfChannel, _xfdashboard_window_content_x11_xfconf_capture_mode_notify_id);
+		_xfdashboard_window_content_x11_xfconf_capture_mode_notify_id=0;
+	}
+}
+
+/* Check if we should workaround unmapped window for requested window and set up workaround */
+static void _xfdashboard_window_content_x11_on_workaround_state_changed(XfdashboardWindowContentX11 *self,
+																	gpointer inUserData)
+{
+	XfdashboardWindowContentX11Private		*priv;
+	XfdashboardWindowTrackerWindowState		windowState;
+
+	g_return_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self));
+	g_return_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_WINDOW_X11(inUserData));
+
+	priv=self->priv;
+
+	/* Handle state change of window */
 	windowState=xfdashboard_window_tracker_window_get_state(XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window));
 
 	switch(priv->workaroundMode)
@@ -651,6 +1308,9 @@ static void _xfdashboard_window_content_x11_check_extension(void)
 	Display		*display G_GNUC_UNUSED;
 #ifdef HAVE_XDAMAGE
 	int			damageError=0;
+	int			fixesEventBase=0;
+	int			fixesError=0;
+	int			fixesMajor=0, fixesMinor=0;
 #endif
 #ifdef HAVE_XCOMPOSITE
 	int			compositeEventBase=0;
@@ -688,139 +1348,1184 @@ static void _xfdashboard_window_content_x11_check_extension(void)
 		}
 			else g_warning(_("Query for X composite extension failed - using only fallback imagess"));
 	}
-		else g_warning(_("X does not support composite extension - using only fallback images"));
+		else g_warning(_("X does not support composite extension - using only fallback images"));
+#endif
+
+	/* Get base of damage event in X */
+	_xfdashboard_window_content_x11_have_damage_extension=FALSE;
+	_xfdashboard_window_content_x11_damage_event_base=0;
+	_xfdashboard_window_content_x11_have_fixes_regions=FALSE;
+
+#ifdef HAVE_XDAMAGE
+	if(G_LIKELY(display!=None) &&
+		XDamageQueryExtension(display, &_xfdashboard_window_content_x11_damage_event_base, &damageError))
+	{
+		_xfdashboard_window_content_x11_have_damage_extension=TRUE;
+
+		/* Regions of XFixes extension are needed to get damaged rectangles
+		 * and not only their bounding box.
+		 */
+		if(XFixesQueryExtension(display, &fixesEventBase, &fixesError) &&
+			XFixesQueryVersion(display, &fixesMajor, &fixesMinor) &&
+			fixesMajor>=2)
+		{
+			_xfdashboard_window_content_x11_have_fixes_regions=TRUE;
+		}
+			else
+			{
+				XFDASHBOARD_DEBUG(NULL, WINDOWS, "X does not support regions of XFixes extension - updating bounding box of damaged areas");
+			}
+	}
+		else
+		{
+			g_warning(_("Query for X damage extension resulted in error code %d - using only still images of windows"),
+						damageError);
+		}
+#endif
+
+	/* Check for MIT-SHM extension used to capture windows in software */
+	_xfdashboard_window_content_x11_have_shm_extension=FALSE;
+#ifdef HAVE_XSHM
+	if(G_LIKELY(display!=None) &&
+		XShmQueryExtension(display))
+	{
+		_xfdashboard_window_content_x11_have_shm_extension=TRUE;
+	}
+		else
+		{
+			XFDASHBOARD_DEBUG(NULL, WINDOWS, "X does not support MIT-SHM extension - cannot capture windows in software");
+		}
+#endif
+}
+
+#ifdef HAVE_XSHM
+/* Check if window contents should be captured in software via MIT-SHM
+ * instead of using composite extension.
+ */
+static gboolean _xfdashboard_window_content_x11_use_software_capture(void)
+{
+	if(!_xfdashboard_window_content_x11_have_shm_extension) return(FALSE);
+
+	switch(_xfdashboard_window_content_x11_capture_mode)
+	{
+		case XFDASHBOARD_WINDOW_CONTENT_X11_CAPTURE_MODE_SOFTWARE:
+			return(TRUE);
+
+		case XFDASHBOARD_WINDOW_CONTENT_X11_CAPTURE_MODE_COMPOSITE:
+			return(FALSE);
+
+		default:
+			break;
+	}
+
+	/* Capture mode is "auto" so capture in software only if composite
+	 * extension is not available.
+	 */
+	return(!_xfdashboard_window_content_x11_have_composite_extension);
+}
+
+/* Release shared memory segment used to capture windows */
+static void _xfdashboard_window_content_x11_capture_destroy_segment(void)
+{
+	Display		*display;
+
+	if(!_xfdashboard_window_content_x11_capture_segment.shmaddr) return;
+
+	display=_xfdashboard_window_content_x11_get_display();
+
+	clutter_x11_trap_x_errors();
+	XShmDetach(display, &_xfdashboard_window_content_x11_capture_segment);
+	XSync(display, False);
+	clutter_x11_untrap_x_errors();
+
+	shmdt(_xfdashboard_window_content_x11_capture_segment.shmaddr);
+	_xfdashboard_window_content_x11_capture_segment.shmaddr=NULL;
+	_xfdashboard_window_content_x11_capture_segment.shmid=-1;
+	_xfdashboard_window_content_x11_capture_segment_size=0;
+
+	XFDASHBOARD_DEBUG(NULL, WINDOWS, "Released shared memory segment for capturing windows");
+}
+
+/* Ensure that shared memory segment used to capture windows is large enough.
+ * It is shared by all window contents as windows are captured one by one.
+ */
+static gboolean _xfdashboard_window_content_x11_capture_ensure_segment(Display *inDisplay, gsize inSize)
+{
+	XShmSegmentInfo		*segment;
+
+	segment=&_xfdashboard_window_content_x11_capture_segment;
+
+	/* Check if current segment is large enough */
+	if(segment->shmaddr && _xfdashboard_window_content_x11_capture_segment_size>=inSize) return(TRUE);
+
+	/* Release current segment and create a larger one */
+	_xfdashboard_window_content_x11_capture_destroy_segment();
+
+	segment->shmid=shmget(IPC_PRIVATE, inSize, IPC_CREAT | 0600);
+	if(segment->shmid<0)
+	{
+		XFDASHBOARD_DEBUG(NULL, WINDOWS,
+							"Could not create shared memory segment of %" G_GSIZE_FORMAT " bytes for capturing windows",
+							inSize);
+		return(FALSE);
+	}
+
+	segment->shmaddr=shmat(segment->shmid, NULL, 0);
+	if(segment->shmaddr==(char*)-1)
+	{
+		XFDASHBOARD_DEBUG(NULL, WINDOWS, "Could not attach to shared memory segment for capturing windows");
+
+		shmctl(segment->shmid, IPC_RMID, NULL);
+		segment->shmaddr=NULL;
+		segment->shmid=-1;
+		return(FALSE);
+	}
+
+	segment->readOnly=False;
+	if(!XShmAttach(inDisplay, segment))
+	{
+		XFDASHBOARD_DEBUG(NULL, WINDOWS, "X server could not attach to shared memory segment for capturing windows");
+
+		shmdt(segment->shmaddr);
+		shmctl(segment->shmid, IPC_RMID, NULL);
+		segment->shmaddr=NULL;
+		segment->shmid=-1;
+		return(FALSE);
+	}
+	XSync(inDisplay, False);
+
+	/* Mark segment to get destroyed as soon as X server and we detached from it */
+	shmctl(segment->shmid, IPC_RMID, NULL);
+	_xfdashboard_window_content_x11_capture_segment_size=inSize;
+
+	XFDASHBOARD_DEBUG(NULL, WINDOWS,
+						"Created shared memory segment of %" G_GSIZE_FORMAT " bytes for capturing windows",
+						inSize);
+
+	return(TRUE);
+}
+
+/* Capture window of window content via MIT-SHM and set a downscaled copy
+ * as texture. As composite extension is not used, only the visible parts
+ * of viewable windows can be captured. All other windows keep their last
+ * captured image.
+ */
+static void _xfdashboard_window_content_x11_capture_window(XfdashboardWindowContentX11 *self)
+{
+	XfdashboardWindowContentX11Private		*priv;
+	Display									*display;
+	XWindowAttributes						windowAttrs;
+	XImage									*image;
+	CoglTexture								*texture;
+	CoglPixelFormat							textureFormat;
+	guint8									*textureData;
+	gint									textureWidth;
+	gint									textureHeight;
+	gint									textureStride;
+	gint									alphaOffset;
+	gfloat									scale;
+	gint									i;
+	gint									trapError;
+#if COGL_VERSION_CHECK(1, 18, 0)
+	CoglContext								*context;
+	CoglError								*error;
+#endif
+
+	g_return_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self));
+
+	priv=self->priv;
+	image=NULL;
+	texture=NULL;
+	textureData=NULL;
+
+	if(priv->xWindowID==None) return;
+
+	/* Get display as it used more than once ;) */
+	display=_xfdashboard_window_content_x11_get_display();
+
+	/* Capture window */
+	clutter_x11_trap_x_errors();
+	while(1)
+	{
+		/* Only viewable windows with 32 bits per pixel can be captured */
+		if(!XGetWindowAttributes(display, priv->xWindowID, &windowAttrs)) break;
+		if(windowAttrs.map_state!=IsViewable) break;
+		if(windowAttrs.depth!=24 && windowAttrs.depth!=32) break;
+		if(windowAttrs.width<=0 || windowAttrs.height<=0) break;
+
+		image=XShmCreateImage(display,
+								windowAttrs.visual,
+								windowAttrs.depth,
+								ZPixmap,
+								NULL,
+								&_xfdashboard_window_content_x11_capture_segment,
+								windowAttrs.width,
+								windowAttrs.height);
+		if(!image || image->bits_per_pixel!=32) break;
+
+		if(!_xfdashboard_window_content_x11_capture_ensure_segment(display, image->bytes_per_line*image->height)) break;
+		image->data=_xfdashboard_window_content_x11_capture_segment.shmaddr;
+
+		if(!XShmGetImage(display, priv->xWindowID, image, 0, 0, AllPlanes)) break;
+		XSync(display, False);
+
+		/* Downscale captured image to thumbnail size */
+		scale=MIN(1.0f, ((gfloat)CAPTURE_MAX_SIZE)/MAX(image->width, image->height));
+		textureWidth=CLAMP((gint)roundf(image->width*scale), 1, image->width);
+		textureHeight=CLAMP((gint)roundf(image->height*scale), 1, image->height);
+		textureStride=textureWidth*4;
+
+		textureData=g_try_malloc(textureStride*textureHeight);
+		if(!textureData) break;
+
+		if(!xfdashboard_image_downscale((const guint8*)image->data,
+											image->width,
+											image->height,
+											image->bytes_per_line,
+											textureData,
+											textureWidth,
+											textureHeight,
+											textureStride))
+		{
+			break;
+		}
+
+		/* Determine pixel format. Windows without alpha channel have undefined
+		 * values in alpha channel so make them opaque.
+		 */
+		if(image->byte_order==LSBFirst)
+		{
+			textureFormat=(windowAttrs.depth==32 ? COGL_PIXEL_FORMAT_BGRA_8888_PRE : COGL_PIXEL_FORMAT_BGRA_8888);
+			alphaOffset=3;
+		}
+			else
+			{
+				textureFormat=(windowAttrs.depth==32 ? COGL_PIXEL_FORMAT_ARGB_8888_PRE : COGL_PIXEL_FORMAT_ARGB_8888);
+				alphaOffset=0;
+			}
+
+		if(windowAttrs.depth!=32)
+		{
+			for(i=0; i<textureWidth*textureHeight; i++) textureData[(i*4)+alphaOffset]=0xff;
+		}
+
+		/* Create texture from downscaled image */
+#if COGL_VERSION_CHECK(1, 18, 0)
+		error=NULL;
+
+		context=clutter_backend_get_cogl_context(clutter_get_default_backend());
+		texture=cogl_texture_2d_new_from_data(context,
+												textureWidth,
+												textureHeight,
+												textureFormat,
+												textureStride,
+												textureData,
+												&error);
+		if(!texture || error)
+		{
+			XFDASHBOARD_DEBUG(self, WINDOWS,
+								"Could not create texture from captured image of window '%s': %s",
+								xfdashboard_window_tracker_window_get_name(XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window)),
+								(error && error->message) ? error->message : _("Unknown error"));
+
+			if(texture)
+			{
+				cogl_object_unref(texture);
+				texture=NULL;
+			}
+
+			if(error)
+			{
+				cogl_error_free(error);
+				error=NULL;
+			}
+		}
+#else
+		texture=cogl_texture_new_from_data(textureWidth,
+											textureHeight,
+											COGL_TEXTURE_NONE,
+											textureFormat,
+											COGL_PIXEL_FORMAT_ANY,
+											textureStride,
+											textureData);
+#endif
+
+		/* End reached so break to get out of while loop */
+		break;
+	}
+
+	/* Release allocated resources. The image data is the shared memory
+	 * segment so it must not be freed with image.
+	 */
+	if(image)
+	{
+		image->data=NULL;
+		XDestroyImage(image);
+	}
+
+	if(textureData) g_free(textureData);
+
+	/* Check if everything went well */
+	trapError=clutter_x11_untrap_x_errors();
+	if(trapError!=0)
+	{
+		XFDASHBOARD_DEBUG(self, WINDOWS,
+							"X error %d occured while capturing window '%s'",
+							trapError,
+							xfdashboard_window_tracker_window_get_name(XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window)));
+
+		if(texture) cogl_object_unref(texture);
+		return;
+	}
+
+	if(!texture) return;
+
+	/* Set captured image as texture. It is a downscaled still image of window
+	 * like a snapshot.
+	 */
+	if(priv->texture) cogl_object_unref(priv->texture);
+	priv->texture=texture;
+	priv->isFallback=FALSE;
+	priv->isSnapshot=TRUE;
+	priv->isMapped=TRUE;
+
+	/* Window is not suspended anymore */
+	if(priv->isSuspended!=FALSE)
+	{
+		priv->isSuspended=FALSE;
+
+		/* Notify about property change */
+		g_object_notify_by_pspec(G_OBJECT(self), XfdashboardWindowContentX11Properties[PROP_SUSPENDED]);
+	}
+
+	/* Invalidate content to get it redrawn as soon as possible */
+	clutter_content_invalidate(CLUTTER_CONTENT(self));
+}
+
+/* Determine interval until next window should be captured. Capturing should
+ * not use more than a small share of CPU time and backs off further if the
+ * system is under load.
+ */
+static guint _xfdashboard_window_content_x11_capture_get_interval(void)
+{
+	gdouble		interval;
+	guint		queueLength;
+
+	/* Spend at most a fixed percentage of CPU time for capturing windows */
+	interval=(_xfdashboard_window_content_x11_capture_cost/1000.0)*(100.0/CAPTURE_CPU_USAGE_PERCENT);
+
+	/* Do not capture each window more often than once per cycle */
+	queueLength=g_queue_get_length(&_xfdashboard_window_content_x11_capture_queue);
+	if(queueLength>0) interval=MAX(interval, ((gdouble)CAPTURE_MIN_CYCLE_MSEC)/queueLength);
+
+#ifdef HAVE_GETLOADAVG
+	/* Slow down if there are more runnable processes than processors */
+	{
+		double	loadAverage;
+		guint	processors;
+
+		processors=g_get_num_processors();
+		if(getloadavg(&loadAverage, 1)==1 &&
+			processors>0 &&
+			loadAverage>processors)
+		{
+			interval*=loadAverage/processors;
+		}
+	}
+#endif
+
+	return(CLAMP((guint)interval, CAPTURE_MIN_INTERVAL_MSEC, CAPTURE_MAX_INTERVAL_MSEC));
+}
+
+static void _xfdashboard_window_content_x11_capture_schedule(guint inInterval);
+
+/* Capture next window content in queue */
+static gboolean _xfdashboard_window_content_x11_capture_on_timeout(gpointer inUserData)
+{
+	XfdashboardWindowContentX11		*self;
+	GList							*link;
+	gint64							startTime;
+	gint64							cost;
+
+	_xfdashboard_window_content_x11_capture_id=0;
+
+	/* Move next window content to end of queue to capture all windows in turn */
+	link=g_queue_pop_head_link(&_xfdashboard_window_content_x11_capture_queue);
+	if(!link) return(G_SOURCE_REMOVE);
+
+	g_queue_push_tail_link(&_xfdashboard_window_content_x11_capture_queue, link);
+	self=XFDASHBOARD_WINDOW_CONTENT_X11(link->data);
+
+	/* Capture window and keep track of average costs */
+	startTime=g_get_monotonic_time();
+	_xfdashboard_window_content_x11_capture_window(self);
+	cost=g_get_monotonic_time()-startTime;
+
+	if(_xfdashboard_window_content_x11_capture_cost>0)
+	{
+		_xfdashboard_window_content_x11_capture_cost=((_xfdashboard_window_content_x11_capture_cost*7)+cost)/8;
+	}
+		else _xfdashboard_window_content_x11_capture_cost=cost;
+
+	/* Check if window content should be suspended again after it was captured
+	 * the first time, e.g. initial window content creation in suspended daemon
+	 * mode. Suspending removes it from queue so it is not captured anymore.
+	 */
+	if(self->priv->suspendAfterResumeOnIdle)
+	{
+		_xfdashboard_window_content_x11_suspend(self);
+		self->priv->suspendAfterResumeOnIdle=FALSE;
+	}
+
+	/* Schedule capturing next window */
+	if(!g_queue_is_empty(&_xfdashboard_window_content_x11_capture_queue))
+	{
+		_xfdashboard_window_content_x11_capture_schedule(_xfdashboard_window_content_x11_capture_get_interval());
+	}
+
+	return(G_SOURCE_REMOVE);
+}
+
+/* Schedule capturing next window content in queue */
+static void _xfdashboard_window_content_x11_capture_schedule(guint inInterval)
+{
+	if(_xfdashboard_window_content_x11_capture_id)
+	{
+		g_source_remove(_xfdashboard_window_content_x11_capture_id);
+		_xfdashboard_window_content_x11_capture_id=0;
+	}
+
+	_xfdashboard_window_content_x11_capture_id=clutter_threads_add_timeout_full(G_PRIORITY_LOW,
+																				inInterval,
+																				_xfdashboard_window_content_x11_capture_on_timeout,
+																				NULL,
+																				NULL);
+}
+
+/* Add window content to queue of windows to capture in software */
+static void _xfdashboard_window_content_x11_capture_add(XfdashboardWindowContentX11 *self)
+{
+	XfdashboardWindowContentX11Private		*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self));
+
+	priv=self->priv;
+
+	/* Check if window content is already queued */
+	if(priv->captureLink) return;
+
+	/* Queue window content as next one and capture it soon */
+	g_queue_push_head(&_xfdashboard_window_content_x11_capture_queue, self);
+	priv->captureLink=_xfdashboard_window_content_x11_capture_queue.head;
+
+	_xfdashboard_window_content_x11_capture_schedule(CAPTURE_MIN_INTERVAL_MSEC);
+
+	XFDASHBOARD_DEBUG(self, WINDOWS,
+						"Queued window '%s' for capturing in software - %u windows in queue",
+						xfdashboard_window_tracker_window_get_name(XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window)),
+						g_queue_get_length(&_xfdashboard_window_content_x11_capture_queue));
+}
+
+/* Remove window content from queue of windows to capture in software */
+static void _xfdashboard_window_content_x11_capture_remove(XfdashboardWindowContentX11 *self)
+{
+	XfdashboardWindowContentX11Private		*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self));
+
+	priv=self->priv;
+
+	/* Check if window content is queued */
+	if(!priv->captureLink) return;
+
+	/* Remove window content from queue and stop capturing if queue is empty now */
+	g_queue_delete_link(&_xfdashboard_window_content_x11_capture_queue, priv->captureLink);
+	priv->captureLink=NULL;
+
+	if(g_queue_is_empty(&_xfdashboard_window_content_x11_capture_queue) &&
+		_xfdashboard_window_content_x11_capture_id)
+	{
+		g_source_remove(_xfdashboard_window_content_x11_capture_id);
+		_xfdashboard_window_content_x11_capture_id=0;
+	}
+}
+#endif
+
+/* Suspension state of application changed */
+static void _xfdashboard_window_content_x11_on_application_suspended_changed(XfdashboardWindowContentX11 *self,
+																				GParamSpec *inSpec,
+																				gpointer inUserData)
+{
+	XfdashboardWindowContentX11Private		*priv;
+	XfdashboardApplication					*app;
+
+	g_return_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self));
+	g_return_if_fail(XFDASHBOARD_IS_APPLICATION(inUserData));
+
+	priv=self->priv;
+	app=XFDASHBOARD_APPLICATION(inUserData);
+
+	/* Get application suspend state */
+	priv->isAppSuspended=xfdashboard_application_is_suspended(app);
+
+	/* If application is suspended then suspend this window too ... */
+	if(priv->isAppSuspended)
+	{
+		_xfdashboard_window_content_x11_suspend(self);
+	}
+		/* ... otherwise resume window if it is mapped */
+		else
+		{
+			if(priv->isMapped) _xfdashboard_window_content_x11_resume(self);
+		}
+}
+
+/* Handle mapped, unmapped related X events for window of window content as pixmap,
+ * damage, texture etc. needs to get resumed (acquired) or suspended (released)
+ */
+static void _xfdashboard_window_content_x11_handle_window_event(XfdashboardWindowContentX11 *self,
+																XEvent *inXEvent)
+{
+	XfdashboardWindowContentX11Private		*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self));
+	g_return_if_fail(inXEvent);
+
+	priv=self->priv;
+
+	/* Window of window content may have changed while event was dispatched */
+	if(inXEvent->xany.window!=priv->xWindowID) return;
+
+	switch(inXEvent->type)
+	{
+		case MapNotify:
+		case ConfigureNotify:
+			priv->isMapped=TRUE;
+			if(!priv->isAppSuspended) _xfdashboard_window_content_x11_resume(self);
+			break;
+
+		case UnmapNotify:
+			priv->isMapped=FALSE;
+			_xfdashboard_window_content_x11_suspend(self);
+			break;
+
+		case DestroyNotify:
+			/* Do not keep a snapshot of a destroyed window */
+			priv->isMapped=FALSE;
+			_xfdashboard_window_content_x11_snapshot_cache_forget(priv->xWindowID);
+			_xfdashboard_window_content_x11_suspend_full(self, FALSE);
+			break;
+
+		default:
+			/* We do not handle this type of X event, drop through ... */
+			break;
+	}
+}
+
+/* Check if window content is shown prominently, i.e. any actor showing this
+ * window content or one of its parents up to the view is hovered or selected.
+ */
+#ifdef HAVE_XDAMAGE
+static gboolean _xfdashboard_window_content_x11_is_prominent(XfdashboardWindowContentX11 *self)
+{
+	XfdashboardWindowContentX11Private		*priv;
+	GSList									*iter;
+	ClutterActor							*actor;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self), FALSE);
+
+	priv=self->priv;
+
+	for(iter=priv->actors; iter; iter=g_slist_next(iter))
+	{
+		for(actor=CLUTTER_ACTOR(iter->data); actor && !XFDASHBOARD_IS_VIEW(actor); actor=clutter_actor_get_parent(actor))
+		{
+			if(XFDASHBOARD_IS_STYLABLE(actor) &&
+				(xfdashboard_stylable_has_pseudo_class(XFDASHBOARD_STYLABLE(actor), "hover") ||
+					xfdashboard_stylable_has_pseudo_class(XFDASHBOARD_STYLABLE(actor), "selected")))
+			{
+				return(TRUE);
+			}
+		}
+	}
+
+	return(FALSE);
+}
+
+/* Get time when accumulated damages of window content may be flushed next time.
+ * Returns zero if it can be flushed immediately.
+ */
+static gint64 _xfdashboard_window_content_x11_get_damage_flush_due_time(XfdashboardWindowContentX11 *self)
+{
+	XfdashboardWindowContentX11Private		*priv;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self), 0);
+
+	priv=self->priv;
+
+	/* Update rate is only limited if configured and only for windows
+	 * which are neither hovered nor selected.
+	 */
+	if(!_xfdashboard_window_content_x11_max_update_rate ||
+		!priv->lastDamageFlushTime ||
+		_xfdashboard_window_content_x11_is_prominent(self))
+	{
+		return(0);
+	}
+
+	return(priv->lastDamageFlushTime+(G_USEC_PER_SEC/_xfdashboard_window_content_x11_max_update_rate));
+}
+
+/* Queue redraw of actors showing window content but only for the areas
+ * damaged since the last flush.
+ */
+static void _xfdashboard_window_content_x11_flush_damage(XfdashboardWindowContentX11 *self, gint64 inNow)
+{
+	XfdashboardWindowContentX11Private		*priv;
+	cairo_region_t							*region;
+	cairo_rectangle_int_t					rect;
+	cairo_rectangle_int_t					clip;
+	gint									numberRects;
+	gint									i;
+	GSList									*iter;
+	ClutterActor							*actor;
+	ClutterActorBox							contentBox;
+	gfloat									textureWidth;
+	gfloat									textureHeight;
+	gfloat									scaleX;
+	gfloat									scaleY;
+
+	g_return_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self));
+
+	priv=self->priv;
+
+	/* Take accumulated damage region */
+	region=priv->damageRegion;
+	priv->damageRegion=NULL;
+	priv->lastDamageFlushTime=inNow;
+	if(!region) return;
+
+	/* Only a live window texture needs an update */
+	if(!priv->texture || priv->isFallback)
+	{
+		cairo_region_destroy(region);
+		return;
+	}
+
+	textureWidth=cogl_texture_get_width(priv->texture);
+	textureHeight=cogl_texture_get_height(priv->texture);
+	if(textureWidth<=0.0f || textureHeight<=0.0f)
+	{
+		cairo_region_destroy(region);
+		return;
+	}
+
+	/* Redraw the bounding box of damage region only if it consists of
+	 * too many rectangles to clip each one.
+	 */
+	numberRects=cairo_region_num_rectangles(region);
+	if(numberRects>DAMAGE_MAX_CLIP_RECTANGLES) numberRects=1;
+
+	/* Queue clipped redraw for each damaged rectangle at each actor showing this
+	 * window content scaled from window size to content box of actor.
+	 */
+	for(iter=priv->actors; iter; iter=g_slist_next(iter))
+	{
+		actor=CLUTTER_ACTOR(iter->data);
+
+		clutter_actor_get_content_box(actor, &contentBox);
+		scaleX=(contentBox.x2-contentBox.x1)/textureWidth;
+		scaleY=(contentBox.y2-contentBox.y1)/textureHeight;
+
+		for(i=0; i<numberRects; i++)
+		{
+			if(numberRects==1) cairo_region_get_extents(region, &rect);
+				else cairo_region_get_rectangle(region, i, &rect);
+
+			/* Grow clip by one pixel at each side for filtering of scaled texture */
+			clip.x=floorf(contentBox.x1+(rect.x*scaleX))-1;
+			clip.y=floorf(contentBox.y1+(rect.y*scaleY))-1;
+			clip.width=ceilf(contentBox.x1+((rect.x+rect.width)*scaleX))+1-clip.x;
+			clip.height=ceilf(contentBox.y1+((rect.y+rect.height)*scaleY))+1-clip.y;
+
+			clutter_actor_queue_redraw_with_clip(actor, &clip);
+		}
+	}
+
+	/* Release allocated resources */
+	cairo_region_destroy(region);
+}
+
+/* Forward declaration */
+static void _xfdashboard_window_content_x11_damage_queue_schedule(gint64 inDueTime);
+
+/* Flush accumulated damages of all queued window contents whose update rate
+ * limit allows it, right before the stage is redrawn.
+ */
+static gboolean _xfdashboard_window_content_x11_damage_queue_flush(gpointer inUserData)
+{
+	GSList									*queue;
+	GSList									*iter;
+	XfdashboardWindowContentX11				*content;
+	gint64									now;
+	gint64									dueTime;
+	gint64									nextDueTime;
+
+	_xfdashboard_window_content_x11_damage_flush_id=0;
+
+	/* Take queue and re-queue all window contents which are rate-limited */
+	queue=_xfdashboard_window_content_x11_damage_queue;
+	_xfdashboard_window_content_x11_damage_queue=NULL;
+
+	now=g_get_monotonic_time();
+	nextDueTime=0;
+	for(iter=queue; iter; iter=g_slist_next(iter))
+	{
+		content=XFDASHBOARD_WINDOW_CONTENT_X11(iter->data);
+
+		dueTime=_xfdashboard_window_content_x11_get_damage_flush_due_time(content);
+		if(dueTime>now)
+		{
+			_xfdashboard_window_content_x11_damage_queue=g_slist_prepend(_xfdashboard_window_content_x11_damage_queue, content);
+			if(!nextDueTime || dueTime<nextDueTime) nextDueTime=dueTime;
+		}
+			else _xfdashboard_window_content_x11_flush_damage(content, now);
+	}
+	g_slist_free(queue);
+
+	/* Schedule next flush if window contents are still queued */
+	if(_xfdashboard_window_content_x11_damage_queue)
+	{
+		_xfdashboard_window_content_x11_damage_queue_schedule(nextDueTime);
+	}
+
+	return(G_SOURCE_REMOVE);
+}
+
+/* Schedule flush of damage queue at requested time. A flush scheduled earlier
+ * than requested is kept.
+ */
+static void _xfdashboard_window_content_x11_damage_queue_schedule(gint64 inDueTime)
+{
+	gint64									now;
+
+	now=g_get_monotonic_time();
+	if(inDueTime<now) inDueTime=now;
+
+	/* Check if a flush is already scheduled early enough */
+	if(_xfdashboard_window_content_x11_damage_flush_id &&
+		_xfdashboard_window_content_x11_damage_flush_due_time<=inDueTime)
+	{
+		return;
+	}
+
+	if(_xfdashboard_window_content_x11_damage_flush_id)
+	{
+		g_source_remove(_xfdashboard_window_content_x11_damage_flush_id);
+		_xfdashboard_window_content_x11_damage_flush_id=0;
+	}
+
+	/* Flush in idle source which is dispatched before the stage is redrawn
+	 * or after the remaining time of update rate limit has elapsed.
+	 */
+	if(inDueTime<=now)
+	{
+		_xfdashboard_window_content_x11_damage_flush_id=clutter_threads_add_idle_full(DAMAGE_FLUSH_PRIORITY,
+																						_xfdashboard_window_content_x11_damage_queue_flush,
+																						NULL,
+																						NULL);
+	}
+		else
+		{
+			_xfdashboard_window_content_x11_damage_flush_id=clutter_threads_add_timeout_full(DAMAGE_FLUSH_PRIORITY,
+																								(inDueTime-now+999)/1000,
+																								_xfdashboard_window_content_x11_damage_queue_flush,
+																								NULL,
+																								NULL);
+		}
+	_xfdashboard_window_content_x11_damage_flush_due_time=inDueTime;
+}
+
+/* Discard accumulated damages of window content and remove it from damage queue */
+static void _xfdashboard_window_content_x11_damage_queue_remove(XfdashboardWindowContentX11 *self)
+{
+	XfdashboardWindowContentX11Private		*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self));
+
+	priv=self->priv;
+
+	if(priv->damageRegion)
+	{
+		_xfdashboard_window_content_x11_damage_queue=g_slist_remove(_xfdashboard_window_content_x11_damage_queue, self);
+
+		cairo_region_destroy(priv->damageRegion);
+		priv->damageRegion=NULL;
+	}
+}
+
+/* Handle damage X event for window content by accumulating the damaged area
+ * until the damage queue is flushed.
+ */
+static void _xfdashboard_window_content_x11_handle_damage_event(XfdashboardWindowContentX11 *self,
+																XDamageNotifyEvent *inXEvent)
+{
+	XfdashboardWindowContentX11Private		*priv;
+	Display									*display;
+	XRectangle								*parts;
+	const XRectangle						*rects;
+	gint									numberParts;
+	gint									i;
+	cairo_rectangle_int_t					rect;
+	gboolean								isLive;
+
+	g_return_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self));
+	g_return_if_fail(inXEvent);
+
+	priv=self->priv;
+	parts=NULL;
+	numberParts=0;
+
+	/* Determine if a live window texture needs an update. Do not update
+	 * texture for live window content while workaround is active.
+	 */
+	isLive=(priv->workaroundMode==XFDASHBOARD_WINDOW_CONTENT_X11_WORKAROUND_MODE_NONE &&
+				priv->texture &&
+				!priv->isFallback &&
+				!priv->isSnapshot);
+
+	/* Subtract damage reported so the next event only covers the area damaged
+	 * after this event. The subtracted damage is moved into a region to get
+	 * the rectangles which were really damaged and not only their bounding box.
+	 */
+	display=_xfdashboard_window_content_x11_get_display();
+
+	clutter_x11_trap_x_errors();
+	if(isLive &&
+		_xfdashboard_window_content_x11_have_fixes_regions &&
+		_xfdashboard_window_content_x11_damage_parts==None)
+	{
+		_xfdashboard_window_content_x11_damage_parts=XFixesCreateRegion(display, NULL, 0);
+	}
+
+	if(isLive && _xfdashboard_window_content_x11_damage_parts!=None)
+	{
+		XDamageSubtract(display, inXEvent->damage, None, _xfdashboard_window_content_x11_damage_parts);
+		parts=XFixesFetchRegion(display, _xfdashboard_window_content_x11_damage_parts, &numberParts);
+	}
+		else XDamageSubtract(display, inXEvent->damage, None, None);
+	clutter_x11_untrap_x_errors();
+
+	if(!isLive) return;
+
+	/* Fall back to bounding box of event if damaged rectangles are unknown */
+	if(parts) rects=parts;
+		else
+		{
+			rects=&inXEvent->area;
+			numberParts=1;
+		}
+
+	/* Update each damaged area of texture from pixmap and accumulate it.
+	 * Queue window content if not done already.
+	 */
+	for(i=0; i<numberParts; i++)
+	{
+		rect.x=rects[i].x;
+		rect.y=rects[i].y;
+		rect.width=rects[i].width;
+		rect.height=rects[i].height;
+		if(rect.width<=0 || rect.height<=0) continue;
+
+		cogl_texture_pixmap_x11_update_area(COGL_TEXTURE_PIXMAP_X11(priv->texture),
+											rect.x,
+											rect.y,
+											rect.width,
+											rect.height);
+
+		if(!priv->damageRegion)
+		{
+			priv->damageRegion=cairo_region_create_rectangle(&rect);
+			_xfdashboard_window_content_x11_damage_queue=g_slist_prepend(_xfdashboard_window_content_x11_damage_queue, self);
+		}
+			else cairo_region_union_rectangle(priv->damageRegion, &rect);
+	}
+
+	/* Release allocated resources */
+	if(parts) XFree(parts);
+
+	/* Nothing to flush if no area was damaged */
+	if(!priv->damageRegion) return;
+
+	/* Schedule flush of damage queue */
+	_xfdashboard_window_content_x11_damage_queue_schedule(_xfdashboard_window_content_x11_get_damage_flush_due_time(self));
+}
+#endif
+
+/* Dispatch X event to the window contents it is related to by looking up
+ * the X window or damage handle of event in the mappings of dispatcher.
+ */
+static void _xfdashboard_window_content_x11_dispatch_x_event(XEvent *inXEvent)
+{
+	GSList									*contents;
+	GSList									*iter;
+
+	g_return_if_fail(inXEvent);
+
+	/* Check for damage event */
+#ifdef HAVE_XDAMAGE
+	if(_xfdashboard_window_content_x11_have_damage_extension &&
+		_xfdashboard_window_content_x11_damage_event_base &&
+		inXEvent->type==(_xfdashboard_window_content_x11_damage_event_base + XDamageNotify))
+	{
+		XfdashboardWindowContentX11			*content;
+
+		if(!_xfdashboard_window_content_x11_damage_map) return;
+
+		content=g_hash_table_lookup(_xfdashboard_window_content_x11_damage_map,
+									GUINT_TO_POINTER(((XDamageNotifyEvent*)inXEvent)->damage));
+		if(content) _xfdashboard_window_content_x11_handle_damage_event(content, (XDamageNotifyEvent*)inXEvent);
+		return;
+	}
+#endif
+
+	/* Only mapped, unmapped related X events are of interest */
+	switch(inXEvent->type)
+	{
+		case MapNotify:
+		case ConfigureNotify:
+		case UnmapNotify:
+		case DestroyNotify:
+			break;
+
+		default:
+			return;
+	}
+
+	/* Lookup window contents for X window of event */
+	if(!_xfdashboard_window_content_x11_window_map) return;
+
+	contents=g_hash_table_lookup(_xfdashboard_window_content_x11_window_map,
+									GUINT_TO_POINTER(inXEvent->xany.window));
+	if(!contents) return;
+
+	/* Handle event at a copy of the list of window contents as resuming or
+	 * suspending a window content might modify the mapping.
+	 */
+	contents=g_slist_copy(contents);
+	g_slist_foreach(contents, (GFunc)g_object_ref, NULL);
+
+	for(iter=contents; iter; iter=g_slist_next(iter))
+	{
+		_xfdashboard_window_content_x11_handle_window_event(XFDASHBOARD_WINDOW_CONTENT_X11(iter->data), inXEvent);
+	}
+
+	g_slist_free_full(contents, g_object_unref);
+}
+
+static ClutterX11FilterReturn _xfdashboard_window_content_x11_on_x_event(XEvent *inXEvent, ClutterEvent *inEvent, gpointer inUserData)
+{
+	/* Dispatch X event to window contents */
+	_xfdashboard_window_content_x11_dispatch_x_event(inXEvent);
+
+	/* Always return FILTER_CONTINUE value to let other components handle this
+	 * event also.
+	 */
+	return(CLUTTER_X11_FILTER_CONTINUE);
+}
+
+#ifdef CLUTTER_WINDOWING_GDK
+static GdkFilterReturn _xfdashboard_window_content_x11_on_gdkx_event(GdkXEvent *inXEvent, GdkEvent *inEvent, gpointer inUserData)
+{
+	/* Dispatch X event to window contents */
+	_xfdashboard_window_content_x11_dispatch_x_event((XEvent*)inXEvent);
+
+	/* Always return FILTER_CONTINUE value to let other components handle this
+	 * event also.
+	 */
+	return(GDK_FILTER_CONTINUE);
+}
+#endif
+
+/* Take a reference on X event dispatcher and install the X event filter shared
+ * by all window contents if it is the first reference taken.
+ */
+static void _xfdashboard_window_content_x11_dispatcher_ref(void)
+{
+	/* Increase reference counter and return if dispatcher was set up already */
+	_xfdashboard_window_content_x11_dispatcher_ref_count++;
+	if(_xfdashboard_window_content_x11_dispatcher_ref_count>1) return;
+
+	/* Create mappings */
+	_xfdashboard_window_content_x11_window_map=g_hash_table_new_full(g_direct_hash,
+																		g_direct_equal,
+																		NULL,
+																		(GDestroyNotify)g_slist_free);
+#ifdef HAVE_XDAMAGE
+	_xfdashboard_window_content_x11_damage_map=g_hash_table_new(g_direct_hash, g_direct_equal);
+#endif
+
+	/* Add event filter */
+#ifdef CLUTTER_WINDOWING_X11
+	if(clutter_check_windowing_backend(CLUTTER_WINDOWING_X11))
+	{
+		clutter_x11_add_filter(_xfdashboard_window_content_x11_on_x_event, NULL);
+	}
+#endif
+
+#ifdef CLUTTER_WINDOWING_GDK
+	if(clutter_check_windowing_backend(CLUTTER_WINDOWING_GDK))
+	{
+		gdk_window_add_filter(NULL, _xfdashboard_window_content_x11_on_gdkx_event, NULL);
+	}
+#endif
+
+	XFDASHBOARD_DEBUG(NULL, WINDOWS, "Installed X event dispatcher for window contents");
+}
+
+/* Release a reference on X event dispatcher and remove the X event filter
+ * shared by all window contents if it was the last reference.
+ */
+static void _xfdashboard_window_content_x11_dispatcher_unref(void)
+{
+	g_return_if_fail(_xfdashboard_window_content_x11_dispatcher_ref_count>0);
+
+	/* Decrease reference counter and return if dispatcher is still in use */
+	_xfdashboard_window_content_x11_dispatcher_ref_count--;
+	if(_xfdashboard_window_content_x11_dispatcher_ref_count>0) return;
+
+	/* Remove event filter */
+#ifdef CLUTTER_WINDOWING_X11
+	if(clutter_check_windowing_backend(CLUTTER_WINDOWING_X11))
+	{
+		clutter_x11_remove_filter(_xfdashboard_window_content_x11_on_x_event, NULL);
+	}
+#endif
+
+#ifdef CLUTTER_WINDOWING_GDK
+	if(clutter_check_windowing_backend(CLUTTER_WINDOWING_GDK))
+	{
+		gdk_window_remove_filter(NULL, _xfdashboard_window_content_x11_on_gdkx_event, NULL);
+	}
 #endif
 
-	/* Get base of damage event in X */
-	_xfdashboard_window_content_x11_have_damage_extension=FALSE;
-	_xfdashboard_window_content_x11_damage_event_base=0;
+	/* Destroy mappings */
+	if(_xfdashboard_window_content_x11_window_map)
+	{
+		g_hash_table_destroy(_xfdashboard_window_content_x11_window_map);
+		_xfdashboard_window_content_x11_window_map=NULL;
+	}
 
 #ifdef HAVE_XDAMAGE
-	if(G_LIKELY(display!=None) &&
-		XDamageQueryExtension(display, &_xfdashboard_window_content_x11_damage_event_base, &damageError))
+	if(_xfdashboard_window_content_x11_damage_map)
 	{
-		_xfdashboard_window_content_x11_have_damage_extension=TRUE;
+		g_hash_table_destroy(_xfdashboard_window_content_x11_damage_map);
+		_xfdashboard_window_content_x11_damage_map=NULL;
 	}
-		else
-		{
-			g_warning(_("Query for X damage extension resulted in error code %d - using only still images of windows"),
-						damageError);
-		}
+
+	if(_xfdashboard_window_content_x11_damage_flush_id)
+	{
+		g_source_remove(_xfdashboard_window_content_x11_damage_flush_id);
+		_xfdashboard_window_content_x11_damage_flush_id=0;
+	}
+
+	if(_xfdashboard_window_content_x11_damage_queue)
+	{
+		g_slist_free(_xfdashboard_window_content_x11_damage_queue);
+		_xfdashboard_window_content_x11_damage_queue=NULL;
+	}
+
+	if(_xfdashboard_window_content_x11_damage_parts!=None)
+	{
+		clutter_x11_trap_x_errors();
+		XFixesDestroyRegion(_xfdashboard_window_content_x11_get_display(), _xfdashboard_window_content_x11_damage_parts);
+		clutter_x11_untrap_x_errors();
+		_xfdashboard_window_content_x11_damage_parts=None;
+	}
+#endif
+
+#ifdef HAVE_XSHM
+	/* Release shared memory segment as no window content is left to capture */
+	_xfdashboard_window_content_x11_capture_destroy_segment();
 #endif
+
+	XFDASHBOARD_DEBUG(NULL, WINDOWS, "Removed X event dispatcher for window contents");
 }
 
-/* Suspension state of application changed */
-static void _xfdashboard_window_content_x11_on_application_suspended_changed(XfdashboardWindowContentX11 *self,
-																				GParamSpec *inSpec,
-																				gpointer inUserData)
+/* Add X window of window content to mapping of X event dispatcher */
+static void _xfdashboard_window_content_x11_dispatcher_add_window(XfdashboardWindowContentX11 *self)
 {
 	XfdashboardWindowContentX11Private		*priv;
-	XfdashboardApplication					*app;
+	GSList									*contents;
 
 	g_return_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self));
-	g_return_if_fail(XFDASHBOARD_IS_APPLICATION(inUserData));
 
 	priv=self->priv;
-	app=XFDASHBOARD_APPLICATION(inUserData);
 
-	/* Get application suspend state */
-	priv->isAppSuspended=xfdashboard_application_is_suspended(app);
+	if(!_xfdashboard_window_content_x11_window_map || priv->xWindowID==None) return;
 
-	/* If application is suspended then suspend this window too ... */
-	if(priv->isAppSuspended)
-	{
-		_xfdashboard_window_content_x11_suspend(self);
-	}
-		/* ... otherwise resume window if it is mapped */
-		else
-		{
-			if(priv->isMapped) _xfdashboard_window_content_x11_resume(self);
-		}
+	/* More than one window content may exist for the same X window */
+	contents=g_hash_table_lookup(_xfdashboard_window_content_x11_window_map, GUINT_TO_POINTER(priv->xWindowID));
+	if(g_slist_find(contents, self)) return;
+
+	g_hash_table_steal(_xfdashboard_window_content_x11_window_map, GUINT_TO_POINTER(priv->xWindowID));
+	contents=g_slist_prepend(contents, self);
+	g_hash_table_insert(_xfdashboard_window_content_x11_window_map, GUINT_TO_POINTER(priv->xWindowID), contents);
 }
 
-/* Filter X events for damages */
-static void _xfdashboard_window_content_x11_handle_x_event(XfdashboardWindowContentX11 *self,
-															XEvent *inXEvent)
+/* Remove X window of window content from mapping of X event dispatcher */
+static void _xfdashboard_window_content_x11_dispatcher_remove_window(XfdashboardWindowContentX11 *self)
 {
 	XfdashboardWindowContentX11Private		*priv;
+	GSList									*contents;
 
 	g_return_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self));
-	g_return_if_fail(inXEvent);
 
 	priv=self->priv;
 
-	/* Check for mapped, unmapped related X events as pixmap, damage, texture etc.
-	 * needs to get resumed (acquired) or suspended (released)
-	 */
-	if(inXEvent->xany.window==priv->xWindowID)
-	{
-		switch(inXEvent->type)
-		{
-			case MapNotify:
-			case ConfigureNotify:
-				priv->isMapped=TRUE;
-				if(!priv->isAppSuspended) _xfdashboard_window_content_x11_resume(self);
-				break;
-
-			case UnmapNotify:
-			case DestroyNotify:
-				priv->isMapped=FALSE;
-				_xfdashboard_window_content_x11_suspend(self);
-				break;
+	if(!_xfdashboard_window_content_x11_window_map || priv->xWindowID==None) return;
 
-			default:
-				/* We do not handle this type of X event, drop through ... */
-				break;
-		}
-	}
+	contents=g_hash_table_lookup(_xfdashboard_window_content_x11_window_map, GUINT_TO_POINTER(priv->xWindowID));
+	if(!g_slist_find(contents, self)) return;
 
-	/* Check for damage event */
-#ifdef HAVE_XDAMAGE
-	if(_xfdashboard_window_content_x11_have_damage_extension &&
-		_xfdashboard_window_content_x11_damage_event_base &&
-		inXEvent->type==(_xfdashboard_window_content_x11_damage_event_base + XDamageNotify) &&
-		((XDamageNotifyEvent*)inXEvent)->damage==priv->damage &&
-		priv->workaroundMode==XFDASHBOARD_WINDOW_CONTENT_X11_WORKAROUND_MODE_NONE)
-	{
-		/* Update texture for live window content */
-		clutter_content_invalidate(CLUTTER_CONTENT(self));
-	}
-#endif
+	g_hash_table_steal(_xfdashboard_window_content_x11_window_map, GUINT_TO_POINTER(priv->xWindowID));
+	contents=g_slist_remove(contents, self);
+	if(contents) g_hash_table_insert(_xfdashboard_window_content_x11_window_map, GUINT_TO_POINTER(priv->xWindowID), contents);
 }
 
-static ClutterX11FilterReturn _xfdashboard_window_content_x11_on_x_event(XEvent *inXEvent, ClutterEvent *inEvent, gpointer inUserData)
+/* Add damage handle of window content to mapping of X event dispatcher */
+#ifdef HAVE_XDAMAGE
+static void _xfdashboard_window_content_x11_dispatcher_add_damage(XfdashboardWindowContentX11 *self)
 {
-	XfdashboardWindowContentX11				*self;
+	XfdashboardWindowContentX11Private		*priv;
 
-	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(inUserData), CLUTTER_X11_FILTER_CONTINUE);
+	g_return_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self));
 
-	self=XFDASHBOARD_WINDOW_CONTENT_X11(inUserData);
+	priv=self->priv;
 
-	/* Call X event handler */
-	_xfdashboard_window_content_x11_handle_x_event(self, inXEvent);
+	if(!_xfdashboard_window_content_x11_damage_map || priv->damage==None) return;
 
-	/* Always return FILTER_CONTINUE value to let other components handle this
-	 * event also.
-	 */
-	return(CLUTTER_X11_FILTER_CONTINUE);
+	g_hash_table_insert(_xfdashboard_window_content_x11_damage_map, GUINT_TO_POINTER(priv->damage), self);
 }
 
-#ifdef CLUTTER_WINDOWING_GDK
-static GdkFilterReturn _xfdashboard_window_content_x11_on_gdkx_event(GdkXEvent *inXEvent, GdkEvent *inEvent, gpointer inUserData)
+/* Remove damage handle of window content from mapping of X event dispatcher */
+static void _xfdashboard_window_content_x11_dispatcher_remove_damage(XfdashboardWindowContentX11 *self)
 {
-	XfdashboardWindowContentX11				*self;
+	XfdashboardWindowContentX11Private		*priv;
 
-	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(inUserData), GDK_FILTER_CONTINUE);
+	g_return_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self));
 
-	self=XFDASHBOARD_WINDOW_CONTENT_X11(inUserData);
+	priv=self->priv;
 
-	/* Call X event handler */
-	_xfdashboard_window_content_x11_handle_x_event(self, inXEvent);
+	/* Discard accumulated damages */
+	_xfdashboard_window_content_x11_damage_queue_remove(self);
 
-	/* Always return FILTER_CONTINUE value to let other components handle this
-	 * event also.
-	 */
-	return(GDK_FILTER_CONTINUE);
+	if(!_xfdashboard_window_content_x11_damage_map || priv->damage==None) return;
+
+	if(g_hash_table_lookup(_xfdashboard_window_content_x11_damage_map, GUINT_TO_POINTER(priv->damage))==self)
+	{
+		g_hash_table_remove(_xfdashboard_window_content_x11_damage_map, GUINT_TO_POINTER(priv->damage));
+	}
 }
 #endif
 
@@ -837,6 +2542,9 @@ static void _xfdashboard_window_content_x11_release_resources(XfdashboardWindowC
 
 	/* This live update will be suspended so remove it from queue */
 	_xfdashboard_window_content_x11_resume_on_idle_remove(self);
+#ifdef HAVE_XSHM
+	_xfdashboard_window_content_x11_capture_remove(self);
+#endif
 
 	/* Get display as it used more than once ;) */
 	display=_xfdashboard_window_content_x11_get_display();
@@ -851,10 +2559,12 @@ static void _xfdashboard_window_content_x11_release_resources(XfdashboardWindowC
 			cogl_object_unref(priv->texture);
 			priv->texture=NULL;
 		}
+		priv->isSnapshot=FALSE;
 
 #ifdef HAVE_XDAMAGE
 		if(priv->damage!=None)
 		{
+			_xfdashboard_window_content_x11_dispatcher_remove_damage(self);
 			XDamageDestroy(display, priv->damage);
 			XSync(display, False);
 			priv->damage=None;
@@ -868,6 +2578,8 @@ static void _xfdashboard_window_content_x11_release_resources(XfdashboardWindowC
 
 		if(priv->xWindowID!=None)
 		{
+			_xfdashboard_window_content_x11_dispatcher_remove_window(self);
+
 #ifdef HAVE_XCOMPOSITE
 			if(_xfdashboard_window_content_x11_have_composite_extension)
 			{
@@ -904,19 +2616,26 @@ static void _xfdashboard_window_content_x11_release_resources(XfdashboardWindowC
 						xfdashboard_window_tracker_window_get_name(XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window)));
 }
 
-/* Suspend from handling live updates */
-static void _xfdashboard_window_content_x11_suspend(XfdashboardWindowContentX11 *self)
+/* Suspend from handling live updates and keep last frame of window in
+ * snapshot cache if requested, i.e. window was not destroyed.
+ */
+static void _xfdashboard_window_content_x11_suspend_full(XfdashboardWindowContentX11 *self, gboolean inStoreSnapshot)
 {
 	XfdashboardWindowContentX11Private		*priv;
 	Display									*display;
 	gint									trapError;
+	CoglTexture								*snapshotTexture;
 
 	g_return_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self));
 
 	priv=self->priv;
+	snapshotTexture=NULL;
 
 	/* This live update will be suspended so remove it from queue */
 	_xfdashboard_window_content_x11_resume_on_idle_remove(self);
+#ifdef HAVE_XSHM
+	_xfdashboard_window_content_x11_capture_remove(self);
+#endif
 
 	/* Get display as it used more than once ;) */
 	display=_xfdashboard_window_content_x11_get_display();
@@ -924,18 +2643,14 @@ static void _xfdashboard_window_content_x11_suspend(XfdashboardWindowContentX11
 	/* Release resources */
 	clutter_x11_trap_x_errors();
 	{
-		/* Suspend live updates from texture */
-		if(priv->texture && !priv->isFallback)
-		{
-#ifdef HAVE_XDAMAGE
-			cogl_texture_pixmap_x11_set_damage_object(COGL_TEXTURE_PIXMAP_X11(priv->texture), 0, 0);
-#endif
-		}
+		/* Keep last frame of window in snapshot cache before pixmap is released */
+		if(inStoreSnapshot) snapshotTexture=_xfdashboard_window_content_x11_snapshot_cache_store(self);
 
 		/* Release damage */
 #ifdef HAVE_XDAMAGE
 		if(priv->damage!=None)
 		{
+			_xfdashboard_window_content_x11_dispatcher_remove_damage(self);
 			XDamageDestroy(display, priv->damage);
 			XSync(display, False);
 			priv->damage=None;
@@ -949,6 +2664,14 @@ static void _xfdashboard_window_content_x11_suspend(XfdashboardWindowContentX11
 			priv->pixmap=None;
 		}
 
+		/* Show snapshot instead of texture of released pixmap */
+		if(snapshotTexture)
+		{
+			if(priv->texture) cogl_object_unref(priv->texture);
+			priv->texture=cogl_object_ref(snapshotTexture);
+			priv->isSnapshot=TRUE;
+		}
+
 		/* Window is suspended now */
 		if(priv->isSuspended!=TRUE)
 		{
@@ -975,74 +2698,39 @@ static void _xfdashboard_window_content_x11_suspend(XfdashboardWindowContentX11
 						xfdashboard_window_tracker_window_get_name(XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window)));
 }
 
-/* Resume to handle live window updates */
-static gboolean _xfdashboard_window_content_x11_resume_on_idle(gpointer inUserData)
+/* Suspend from handling live updates */
+static void _xfdashboard_window_content_x11_suspend(XfdashboardWindowContentX11 *self)
+{
+	_xfdashboard_window_content_x11_suspend_full(self, TRUE);
+}
+
+/* Resume queued window content to handle live window updates */
+static void _xfdashboard_window_content_x11_resume_queued(XfdashboardWindowContentX11 *self)
 {
-	XfdashboardWindowContentX11				*self;
 	XfdashboardWindowContentX11Private		*priv;
-	GList									*queueEntry;
 	Display									*display;
 	CoglContext								*context;
 	GError									*error;
 	gint									trapError;
 	CoglTexture								*windowTexture;
-	gboolean								doContinueSource;
-
-	error=NULL;
-	windowTexture=NULL;
-
-	/* Get window content object from first entry in queue and remove it from queue */
-	queueEntry=g_list_first(_xfdashboard_window_content_x11_resume_idle_queue);
-	if(!queueEntry)
-	{
-		g_warning(_("Resume handler called for empty queue."));
 
-		/* Queue must be empty but ensure it will */
-		if(_xfdashboard_window_content_x11_resume_idle_queue)
-		{
-			XFDASHBOARD_DEBUG(NULL, WINDOWS, "Ensuring that window content resume queue is empty");
-			g_list_free(_xfdashboard_window_content_x11_resume_idle_queue);
-			_xfdashboard_window_content_x11_resume_idle_queue=NULL;
-		}
-
-		/* Queue must be empty so remove idle source */
-		_xfdashboard_window_content_x11_resume_idle_id=0;
-		return(G_SOURCE_REMOVE);
-	}
+	g_return_if_fail(XFDASHBOARD_IS_WINDOW_CONTENT_X11(self));
 
-	self=XFDASHBOARD_WINDOW_CONTENT_X11(queueEntry->data);
 	priv=self->priv;
-	XFDASHBOARD_DEBUG(self, WINDOWS,
-						"Entering idle source with ID %u for window resume of '%s'",
-						_xfdashboard_window_content_x11_resume_idle_id,
-						xfdashboard_window_tracker_window_get_name(XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window)));
+	error=NULL;
+	windowTexture=NULL;
 
 	XFDASHBOARD_DEBUG(self, WINDOWS,
-						"Removing queued entry %p for window resume of '%s'",
-						queueEntry,
-						xfdashboard_window_tracker_window_get_name(XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window)));
-	_xfdashboard_window_content_x11_resume_idle_queue=g_list_delete_link(_xfdashboard_window_content_x11_resume_idle_queue, queueEntry);
-	if(_xfdashboard_window_content_x11_resume_idle_queue)
-	{
-		doContinueSource=G_SOURCE_CONTINUE;
-	}
-		else
-		{
-			XFDASHBOARD_DEBUG(self, WINDOWS,
-								"Resume idle source with ID %u will be remove because queue is empty",
-								_xfdashboard_window_content_x11_resume_idle_id);
-
-			doContinueSource=G_SOURCE_REMOVE;
-			_xfdashboard_window_content_x11_resume_idle_id=0;
-		}
-
+						"Resuming queued window '%s' with priority %d",
+						xfdashboard_window_tracker_window_get_name(XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window)),
+						priv->resumePriority);
 
 	/* We need at least the X composite extension to display images of windows
 	 * if still images or live updated ones
 	 */
 	if(!_xfdashboard_window_content_x11_have_composite_extension)
 	{
-		return(doContinueSource);
+		return;
 	}
 
 	/* Get display as it used more than once ;) */
@@ -1101,7 +2789,12 @@ static gboolean _xfdashboard_window_content_x11_resume_on_idle(gpointer inUserDa
 			break;
 		}
 
-		/* Set up damage to get notified about changed in pixmap */
+		/* Set up damage to get notified about changed in pixmap. The damage is
+		 * not handed over to cogl but handled by this window content itself
+		 * to update and redraw only the damaged areas. Events only report the
+		 * bounding box to keep their number low, the damaged rectangles are
+		 * fetched when the damage is subtracted.
+		 */
 #ifdef HAVE_XDAMAGE
 		if(_xfdashboard_window_content_x11_have_damage_extension)
 		{
@@ -1111,6 +2804,7 @@ static gboolean _xfdashboard_window_content_x11_resume_on_idle(gpointer inUserDa
 			{
 				g_warning(_("Could not create damage for window '%s' - using still image of window"), xfdashboard_window_tracker_window_get_name(XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window)));
 			}
+				else _xfdashboard_window_content_x11_dispatcher_add_damage(self);
 		}
 #endif
 
@@ -1121,17 +2815,11 @@ static gboolean _xfdashboard_window_content_x11_resume_on_idle(gpointer inUserDa
 			priv->texture=windowTexture;
 		}
 
-		/* Set damage to new window texture */
-#ifdef HAVE_XDAMAGE
-		if(_xfdashboard_window_content_x11_have_damage_extension &&
-			priv->damage!=None)
-		{
-			cogl_texture_pixmap_x11_set_damage_object(COGL_TEXTURE_PIXMAP_X11(priv->texture), priv->damage, COGL_TEXTURE_PIXMAP_X11_DAMAGE_BOUNDING_BOX);
-		}
-#endif
-
-		/* Now we use the window as texture and not the fallback texture anymore */
+		/* Now we use the window as texture and not the fallback texture
+		 * or the snapshot of window anymore.
+		 */
 		priv->isFallback=FALSE;
+		priv->isSnapshot=FALSE;
 
 		/* Window is not suspended anymore */
 		if(priv->isSuspended!=FALSE)
@@ -1169,13 +2857,103 @@ static gboolean _xfdashboard_window_content_x11_resume_on_idle(gpointer inUserDa
 							"X error %d occured while resuming window '%s",
 							trapError,
 							xfdashboard_window_tracker_window_get_name(XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window)));
-		return(doContinueSource);
+		return;
 	}
 
 	XFDASHBOARD_DEBUG(self, WINDOWS,
 						"Resuming live texture updates for window '%s'",
 						xfdashboard_window_tracker_window_get_name(XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window)));
-	return(doContinueSource);
+	return;
+}
+
+/* Resume queued window contents in idle source in order of their priority
+ * until time budget of this idle tick is used up.
+ */
+static gboolean _xfdashboard_window_content_x11_resume_on_idle(gpointer inUserData)
+{
+	XfdashboardWindowContentX11				*self;
+	guint									sourceID;
+	gint									priority;
+	gint64									tickStartTime;
+	gint64									now;
+	guint									tickCount;
+	guint									queueSize;
+
+	/* Check that queue is not empty */
+	if(_xfdashboard_window_content_x11_get_resume_queue_length()==0)
+	{
+		g_warning(_("Resume handler called for empty queue."));
+
+		/* Queue must be empty so remove idle source */
+		_xfdashboard_window_content_x11_resume_idle_id=0;
+		return(G_SOURCE_REMOVE);
+	}
+
+	sourceID=_xfdashboard_window_content_x11_resume_idle_id;
+	tickStartTime=now=g_get_monotonic_time();
+	tickCount=0;
+	_xfdashboard_window_content_x11_resume_drain_ticks++;
+
+	XFDASHBOARD_DEBUG(NULL, WINDOWS,
+						"Entering idle source with ID %u for window resume at queue depth %u",
+						sourceID,
+						_xfdashboard_window_content_x11_get_resume_queue_length());
+
+	while(1)
+	{
+		/* Get window content with highest priority from queue */
+		self=NULL;
+		for(priority=0; !self && priority<XFDASHBOARD_WINDOW_CONTENT_X11_RESUME_PRIORITY_LAST; priority++)
+		{
+			self=g_queue_pop_head(&_xfdashboard_window_content_x11_resume_idle_queue[priority]);
+		}
+		if(!self) break;
+
+		/* If queue is empty now this idle source will be removed. Reset its ID
+		 * before resuming window content as suspending it would remove the source.
+		 */
+		if(_xfdashboard_window_content_x11_get_resume_queue_length()==0)
+		{
+			XFDASHBOARD_DEBUG(self, WINDOWS,
+								"Resume idle source with ID %u will be remove because queue is empty",
+								sourceID);
+			_xfdashboard_window_content_x11_resume_idle_id=0;
+		}
+
+		/* Resume window content */
+		_xfdashboard_window_content_x11_resume_queued(self);
+		tickCount++;
+
+		/* Stop if this idle source will be removed or time budget is used up */
+		now=g_get_monotonic_time();
+		if(_xfdashboard_window_content_x11_resume_idle_id!=sourceID) break;
+		if((now-tickStartTime)>=(RESUME_ON_IDLE_TIME_BUDGET_MSEC*1000)) break;
+	}
+
+	/* Instrument draining the queue */
+	_xfdashboard_window_content_x11_resume_drain_count+=tickCount;
+	queueSize=_xfdashboard_window_content_x11_get_resume_queue_length();
+
+	XFDASHBOARD_DEBUG(NULL, WINDOWS,
+						"Resumed %u windows in %.2fms at idle tick %u - %u windows remaining in queue",
+						tickCount,
+						(now-tickStartTime)/1000.0,
+						_xfdashboard_window_content_x11_resume_drain_ticks,
+						queueSize);
+
+	if(queueSize==0)
+	{
+		XFDASHBOARD_DEBUG(NULL, WINDOWS,
+							"Drained resume queue of %u windows with maximum queue depth of %u in %.2fms over %u idle ticks",
+							_xfdashboard_window_content_x11_resume_drain_count,
+							_xfdashboard_window_content_x11_resume_max_queue_size,
+							(now-_xfdashboard_window_content_x11_resume_drain_start_time)/1000.0,
+							_xfdashboard_window_content_x11_resume_drain_ticks);
+	}
+
+	/* Keep this idle source only if it was not replaced or removed meanwhile */
+	if(_xfdashboard_window_content_x11_resume_idle_id!=sourceID) return(G_SOURCE_REMOVE);
+	return(G_SOURCE_CONTINUE);
 }
 
 static void _xfdashboard_window_content_x11_resume(XfdashboardWindowContentX11 *self)
@@ -1194,6 +2972,17 @@ static void _xfdashboard_window_content_x11_resume(XfdashboardWindowContentX11 *
 	error=NULL;
 	windowTexture=NULL;
 
+#ifdef HAVE_XSHM
+	/* Capture window in software if composite extension is not available
+	 * or if it was requested.
+	 */
+	if(_xfdashboard_window_content_x11_use_software_capture())
+	{
+		_xfdashboard_window_content_x11_capture_add(self);
+		return;
+	}
+#endif
+
 	/* Check if to use new experimental code to resume window content
 	 * in an idle source.
 	 */
@@ -1261,7 +3050,12 @@ static void _xfdashboard_window_content_x11_resume(XfdashboardWindowContentX11 *
 			break;
 		}
 
-		/* Set up damage to get notified about changed in pixmap */
+		/* Set up damage to get notified about changed in pixmap. The damage is
+		 * not handed over to cogl but handled by this window content itself
+		 * to update and redraw only the damaged areas. Events only report the
+		 * bounding box to keep their number low, the damaged rectangles are
+		 * fetched when the damage is subtracted.
+		 */
 #ifdef HAVE_XDAMAGE
 		if(_xfdashboard_window_content_x11_have_damage_extension)
 		{
@@ -1271,6 +3065,7 @@ static void _xfdashboard_window_content_x11_resume(XfdashboardWindowContentX11 *
 			{
 				g_warning(_("Could not create damage for window '%s' - using still image of window"), xfdashboard_window_tracker_window_get_name(XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window)));
 			}
+				else _xfdashboard_window_content_x11_dispatcher_add_damage(self);
 		}
 #endif
 
@@ -1281,17 +3076,11 @@ static void _xfdashboard_window_content_x11_resume(XfdashboardWindowContentX11 *
 			priv->texture=windowTexture;
 		}
 
-		/* Set damage to new window texture */
-#ifdef HAVE_XDAMAGE
-		if(_xfdashboard_window_content_x11_have_damage_extension &&
-			priv->damage!=None)
-		{
-			cogl_texture_pixmap_x11_set_damage_object(COGL_TEXTURE_PIXMAP_X11(priv->texture), priv->damage, COGL_TEXTURE_PIXMAP_X11_DAMAGE_BOUNDING_BOX);
-		}
-#endif
-
-		/* Now we use the window as texture and not the fallback texture anymore */
+		/* Now we use the window as texture and not the fallback texture
+		 * or the snapshot of window anymore.
+		 */
 		priv->isFallback=FALSE;
+		priv->isSnapshot=FALSE;
 
 		/* Window is not suspended anymore */
 		if(priv->isSuspended!=FALSE)
@@ -1412,6 +3201,8 @@ static void _xfdashboard_window_content_x11_set_window(XfdashboardWindowContentX
 	Display									*display;
 	GdkPixbuf								*windowIcon;
 	XWindowAttributes						windowAttrs;
+	gboolean								isViewable G_GNUC_UNUSED;
+	gboolean								suspendDeferred;
 #if COGL_VERSION_CHECK(1, 18, 0)
 	ClutterBackend							*backend;
 	CoglContext								*context;
@@ -1484,6 +3275,7 @@ static void _xfdashboard_window_content_x11_set_window(XfdashboardWindowContentX
 	priv->isFallback=TRUE;
 
 	/* Get X window and its attributes */
+	isViewable=FALSE;
 	if(priv->includeWindowFrame)
 	{
 		priv->xWindowID=_xfdashboard_window_content_x11_get_window_frame_xid(display, priv->window);
@@ -1499,6 +3291,26 @@ static void _xfdashboard_window_content_x11_set_window(XfdashboardWindowContentX
 		g_warning(_("Could not get attributes of window '%s'"), xfdashboard_window_tracker_window_get_name(XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window)));
 		XSync(display, False);
 	}
+		else if(windowAttrs.map_state==IsViewable)
+		{
+			CoglTexture						*snapshotTexture;
+
+			isViewable=TRUE;
+
+			/* Show last frame of window from snapshot cache instead of fallback
+			 * texture until live texture is available.
+			 */
+			snapshotTexture=_xfdashboard_window_content_x11_snapshot_cache_lookup(priv->xWindowID,
+																					windowAttrs.width+(2*windowAttrs.border_width),
+																					windowAttrs.height+(2*windowAttrs.border_width));
+			if(snapshotTexture)
+			{
+				if(priv->texture) cogl_object_unref(priv->texture);
+				priv->texture=cogl_object_ref(snapshotTexture);
+				priv->isFallback=FALSE;
+				priv->isSnapshot=TRUE;
+			}
+		}
 
 	/* We need at least the X composite extension to display images of windows
 	 * if still images or live updated ones by redirecting window
@@ -1513,11 +3325,18 @@ static void _xfdashboard_window_content_x11_set_window(XfdashboardWindowContentX
 #endif
 
 	/* We are interested in receiving mapping events of windows */
+	_xfdashboard_window_content_x11_dispatcher_add_window(self);
 	XSelectInput(display, priv->xWindowID, windowAttrs.your_event_mask | StructureNotifyMask);
 
 	/* Acquire new window and handle live updates */
 	_xfdashboard_window_content_x11_resume(self);
 	priv->isMapped=!priv->isSuspended;
+#ifdef HAVE_XSHM
+	/* Window captured in software gets resumed after it was captured the
+	 * first time, so rely on its attributes to determine if it is mapped.
+	 */
+	if(_xfdashboard_window_content_x11_use_software_capture()) priv->isMapped=isViewable;
+#endif
 
 	/* But suspend window immediately again if application is suspended
 	 * (xfdashboard runs in daemon mode and is not active currently)
@@ -1525,7 +3344,15 @@ static void _xfdashboard_window_content_x11_set_window(XfdashboardWindowContentX
 	application=xfdashboard_application_get_default();
 	if(xfdashboard_application_is_suspended(application))
 	{
-		if(_xfdashboard_window_content_x11_window_creation_priority>0)
+		/* Window resumed in idle source or captured in software is suspended
+		 * after it was resumed or captured the first time.
+		 */
+		suspendDeferred=(_xfdashboard_window_content_x11_window_creation_priority>0);
+#ifdef HAVE_XSHM
+		if(_xfdashboard_window_content_x11_use_software_capture()) suspendDeferred=TRUE;
+#endif
+
+		if(suspendDeferred)
 		{
 			priv->suspendAfterResumeOnIdle=TRUE;
 		}
@@ -1811,9 +3638,9 @@ static gboolean _xdashboard_window_content_clutter_content_iface_get_preferred_s
 	/* If window is suspended or if we use the fallback image
 	 * get real window size ...
 	 */
-	if(priv->isFallback || priv->isSuspended)
+	if(priv->isFallback || priv->isSnapshot || priv->isSuspended)
 	{
-		/* Is a fallback texture so get real window size */
+		/* Is a fallback texture or a downscaled snapshot so get real window size */
 		gint							windowW, windowH;
 
 		xfdashboard_window_tracker_window_get_geometry(XFDASHBOARD_WINDOW_TRACKER_WINDOW(priv->window), NULL, NULL, &windowW, &windowH);
@@ -1835,8 +3662,31 @@ static gboolean _xdashboard_window_content_clutter_content_iface_get_preferred_s
 }
 
 /* Initialize interface of type ClutterContent */
+/* Window content was attached to an actor */
+static void _xdashboard_window_content_clutter_content_iface_attached(ClutterContent *inContent,
+																		ClutterActor *inActor)
+{
+	XfdashboardWindowContentX11				*self=XFDASHBOARD_WINDOW_CONTENT_X11(inContent);
+	XfdashboardWindowContentX11Private		*priv=self->priv;
+
+	/* Remember actor to queue clipped redraws at it for damaged areas */
+	priv->actors=g_slist_prepend(priv->actors, inActor);
+}
+
+/* Window content was detached from an actor */
+static void _xdashboard_window_content_clutter_content_iface_detached(ClutterContent *inContent,
+																		ClutterActor *inActor)
+{
+	XfdashboardWindowContentX11				*self=XFDASHBOARD_WINDOW_CONTENT_X11(inContent);
+	XfdashboardWindowContentX11Private		*priv=self->priv;
+
+	priv->actors=g_slist_remove(priv->actors, inActor);
+}
+
 static void _xfdashboard_window_content_clutter_content_iface_init(ClutterContentIface *iface)
 {
+	iface->attached=_xdashboard_window_content_clutter_content_iface_attached;
+	iface->detached=_xdashboard_window_content_clutter_content_iface_detached;
 	iface->get_preferred_size=_xdashboard_window_content_clutter_content_iface_get_preferred_size;
 	iface->paint_content=_xdashboard_window_content_clutter_content_iface_paint_content;
 }
@@ -1905,21 +3755,13 @@ static void _xfdashboard_window_content_x11_dispose(GObject *inObject)
 	XfdashboardWindowContentX11Private		*priv=self->priv;
 
 	/* Dispose allocated resources */
-#ifdef CLUTTER_WINDOWING_X11
-	if(clutter_check_windowing_backend(CLUTTER_WINDOWING_X11))
-	{
-		clutter_x11_remove_filter(_xfdashboard_window_content_x11_on_x_event, self);
-	}
-#endif
+	_xfdashboard_window_content_x11_release_resources(self);
 
-#ifdef CLUTTER_WINDOWING_GDK
-	if(clutter_check_windowing_backend(CLUTTER_WINDOWING_GDK))
+	if(priv->isDispatcherRegistered)
 	{
-		gdk_window_remove_filter(NULL, _xfdashboard_window_content_x11_on_gdkx_event, self);
+		_xfdashboard_window_content_x11_dispatcher_unref();
+		priv->isDispatcherRegistered=FALSE;
 	}
-#endif
-
-	_xfdashboard_window_content_x11_release_resources(self);
 
 	if(priv->workaroundStateSignalID)
 	{
@@ -1961,6 +3803,12 @@ static void _xfdashboard_window_content_x11_dispose(GObject *inObject)
 		priv->outlineColor=NULL;
 	}
 
+	if(priv->actors)
+	{
+		g_slist_free(priv->actors);
+		priv->actors=NULL;
+	}
+
 	if(priv->styleClasses)
 	{
 		g_free(priv->styleClasses);
@@ -2259,8 +4107,12 @@ void xfdashboard_window_content_x11_init(XfdashboardWindowContentX11 *self)
 	priv->pixmap=None;
 #ifdef HAVE_XDAMAGE
 	priv->damage=None;
+	priv->damageRegion=NULL;
+	priv->lastDamageFlushTime=0;
 #endif
+	priv->actors=NULL;
 	priv->isFallback=FALSE;
+	priv->isSnapshot=FALSE;
 	priv->outlineColor=clutter_color_copy(CLUTTER_COLOR_Black);
 	priv->outlineWidth=1.0f;
 	priv->isSuspended=TRUE;
@@ -2280,24 +4132,18 @@ void xfdashboard_window_content_x11_init(XfdashboardWindowContentX11 *self)
 	priv->unmappedWindowIconYScale=1.0f;
 	priv->unmappedWindowIconAnchorPoint=XFDASHBOARD_ANCHOR_POINT_NONE;
 	priv->suspendAfterResumeOnIdle=FALSE;
+	priv->resumePriority=XFDASHBOARD_WINDOW_CONTENT_X11_RESUME_PRIORITY_VISIBLE_ON_MONITOR;
+	priv->isDispatcherRegistered=FALSE;
+#ifdef HAVE_XSHM
+	priv->captureLink=NULL;
+#endif
 
 	/* Check extensions (will only be done once) */
 	_xfdashboard_window_content_x11_check_extension();
 
-	/* Add event filter for this instance */
-#ifdef CLUTTER_WINDOWING_X11
-	if(clutter_check_windowing_backend(CLUTTER_WINDOWING_X11))
-	{
-		clutter_x11_add_filter(_xfdashboard_window_content_x11_on_x_event, self);
-	}
-#endif
-
-#ifdef CLUTTER_WINDOWING_GDK
-	if(clutter_check_windowing_backend(CLUTTER_WINDOWING_GDK))
-	{
-		gdk_window_add_filter(NULL, _xfdashboard_window_content_x11_on_gdkx_event, self);
-	}
-#endif
+	/* Register this instance at X event dispatcher shared by all window contents */
+	_xfdashboard_window_content_x11_dispatcher_ref();
+	priv->isDispatcherRegistered=TRUE;
 
 	/* Style content */
 	xfdashboard_stylable_invalidate(XFDASHBOARD_STYLABLE(self));
@@ -2330,6 +4176,59 @@ void xfdashboard_window_content_x11_init(XfdashboardWindowContentX11 *self)
 							"Connected to property changed signal with handler ID %u for xfconf value change notifications",
 							_xfdashboard_window_content_x11_xfconf_priority_notify_id);
 
+		/* Get maximum update rate of window contents and connect to its property
+		 * changed signal in xfconf.
+		 */
+		_xfdashboard_window_content_x11_max_update_rate=xfconf_channel_get_uint(xfconfChannel,
+																				WINDOW_CONTENT_MAX_UPDATE_RATE_XFCONF_PROP,
+																				DEFAULT_WINDOW_CONTENT_MAX_UPDATE_RATE);
+
+		detailedSignal=g_strconcat("property-changed::", WINDOW_CONTENT_MAX_UPDATE_RATE_XFCONF_PROP, NULL);
+		_xfdashboard_window_content_x11_xfconf_max_update_rate_notify_id=g_signal_connect(xfconfChannel,
+																						detailedSignal,
+																						G_CALLBACK(_xfdashboard_window_content_x11_on_max_update_rate_value_changed),
+																						NULL);
+		if(detailedSignal) g_free(detailedSignal);
+
+		/* Get memory limit of snapshot cache and connect to its property
+		 * changed signal in xfconf.
+		 */
+		_xfdashboard_window_content_x11_snapshot_cache_limit=xfconf_channel_get_uint(xfconfChannel,
+																					WINDOW_CONTENT_SNAPSHOT_CACHE_LIMIT_XFCONF_PROP,
+																					DEFAULT_WINDOW_CONTENT_SNAPSHOT_CACHE_LIMIT);
+
+		detailedSignal=g_strconcat("property-changed::", WINDOW_CONTENT_SNAPSHOT_CACHE_LIMIT_XFCONF_PROP, NULL);
+		_xfdashboard_window_content_x11_xfconf_snapshot_cache_limit_notify_id=g_signal_connect(xfconfChannel,
+																							detailedSignal,
+																							G_CALLBACK(_xfdashboard_window_content_x11_on_snapshot_cache_limit_value_changed),
+																							NULL);
+		if(detailedSignal) g_free(detailedSignal);
+
+		/* Get capture mode of window contents and connect to its property
+		 * changed signal in xfconf.
+		 */
+		{
+			GValue						captureModeValue=G_VALUE_INIT;
+
+			g_value_init(&captureModeValue, G_TYPE_STRING);
+			g_value_take_string(&captureModeValue,
+								xfconf_channel_get_string(xfconfChannel,
+															WINDOW_CONTENT_CAPTURE_MODE_XFCONF_PROP,
+															DEFAULT_WINDOW_CONTENT_CAPTURE_MODE));
+			_xfdashboard_window_content_x11_on_capture_mode_value_changed(xfconfChannel,
+																			WINDOW_CONTENT_CAPTURE_MODE_XFCONF_PROP,
+																			&captureModeValue,
+																			NULL);
+			g_value_unset(&captureModeValue);
+		}
+
+		detailedSignal=g_strconcat("property-changed::", WINDOW_CONTENT_CAPTURE_MODE_XFCONF_PROP, NULL);
+		_xfdashboard_window_content_x11_xfconf_capture_mode_notify_id=g_signal_connect(xfconfChannel,
+																					detailedSignal,
+																					G_CALLBACK(_xfdashboard_window_content_x11_on_capture_mode_value_changed),
+																					NULL);
+		if(detailedSignal) g_free(detailedSignal);
+
 		/* Connect to application shutdown signal for xfconf value change notification */
 		_xfdashboard_window_content_x11_window_creation_shutdown_signal_id=g_signal_connect(app,
 																				"shutdown-final",
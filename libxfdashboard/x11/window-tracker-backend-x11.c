@@ -393,7 +393,6 @@ static XfdashboardWindowTrackerWindow* _xfdashboard_window_tracker_backend_x11_w
 	XfdashboardWindowTrackerBackendX11			*self;
 	XfdashboardWindowTrackerBackendX11Private	*priv;
 	Window										stageXWindow;
-	WnckWindow									*wnckWindow;
 	XfdashboardWindowTrackerWindow				*window;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_BACKEND_X11(inBackend), NULL);
@@ -402,17 +401,16 @@ static XfdashboardWindowTrackerWindow* _xfdashboard_window_tracker_backend_x11_w
 	self=XFDASHBOARD_WINDOW_TRACKER_BACKEND_X11(inBackend);
 	priv=self->priv;
 
-	/* Get stage X window and translate to needed window type */
+	/* Get stage X window */
 	stageXWindow=clutter_x11_get_stage_window(inStage);
-	wnckWindow=wnck_window_get(stageXWindow);
 
-	/* Get or create window object for wnck background window */
-	window=xfdashboard_window_tracker_x11_get_window_for_wnck(priv->windowTracker, wnckWindow);
+	/* Look up window object for stage X window */
+	window=xfdashboard_window_tracker_x11_get_window_for_xid(priv->windowTracker, stageXWindow);
 	XFDASHBOARD_DEBUG(self, WINDOWS,
-						"Resolved stage wnck window %s@%p of stage %s@%p to window object %s@%p",
-						G_OBJECT_TYPE_NAME(wnckWindow), wnckWindow,
+						"Resolved stage X window %lu of stage %s@%p to window object %s@%p",
+						(gulong)stageXWindow,
 						G_OBJECT_TYPE_NAME(inStage), inStage,
-						G_OBJECT_TYPE_NAME(window), window);
+						window ? G_OBJECT_TYPE_NAME(window) : "<nil>", window);
 
 	return(window);
 }
@@ -82,6 +82,14 @@ struct _XfdashboardWindowTrackerX11Private
 	GList									*workspaces;
 	GList									*monitors;
 
+	GHashTable								*windowEntries;
+	GHashTable								*windowsByWnck;
+	GHashTable								*windowsByXID;
+	GHashTable								*workspaceEntries;
+	GHashTable								*workspacesByWnck;
+
+	guint									windowsUpdateID;
+
 	XfdashboardApplication					*application;
 	gboolean								isAppSuspended;
 	guint									suspendSignalID;
@@ -114,13 +122,28 @@ static GParamSpec* XfdashboardWindowTrackerX11Properties[PROP_LAST]={ 0, };
 
 
 /* IMPLEMENTATION: Private variables and methods */
+struct _XfdashboardWindowTrackerX11WindowEntry
+{
+	WnckWindow			*wnckWindow;
+	gulong				xid;
+	GList				*link;
+	GList				*stackedLink;
+};
+typedef struct _XfdashboardWindowTrackerX11WindowEntry			XfdashboardWindowTrackerX11WindowEntry;
+
+struct _XfdashboardWindowTrackerX11WorkspaceEntry
+{
+	WnckWorkspace		*wnckWorkspace;
+	GList				*link;
+};
+typedef struct _XfdashboardWindowTrackerX11WorkspaceEntry		XfdashboardWindowTrackerX11WorkspaceEntry;
 
 /* Free workspace object */
 static void _xfdashboard_window_tracker_x11_free_workspace(XfdashboardWindowTrackerX11 *self,
 															XfdashboardWindowTrackerWorkspaceX11 *inWorkspace)
 {
-	XfdashboardWindowTrackerX11Private		*priv;
-	GList									*iter;
+	XfdashboardWindowTrackerX11Private			*priv;
+	XfdashboardWindowTrackerX11WorkspaceEntry	*entry;
 
 	g_return_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_X11(self));
 	g_return_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_WORKSPACE_X11(inWorkspace));
@@ -137,11 +160,18 @@ static void _xfdashboard_window_tracker_x11_free_workspace(XfdashboardWindowTrac
 	g_assert(G_OBJECT(inWorkspace)->ref_count==1);
 #endif
 
-	/* Find entry in workspace list and remove it if found */
-	iter=g_list_find(priv->workspaces, inWorkspace);
-	if(iter)
+	/* Find entry of workspace and remove it from workspace list and mappings if found */
+	entry=g_hash_table_lookup(priv->workspaceEntries, inWorkspace);
+	if(entry)
 	{
-		priv->workspaces=g_list_delete_link(priv->workspaces, iter);
+		priv->workspaces=g_list_delete_link(priv->workspaces, entry->link);
+
+		if(g_hash_table_lookup(priv->workspacesByWnck, entry->wnckWorkspace)==inWorkspace)
+		{
+			g_hash_table_remove(priv->workspacesByWnck, entry->wnckWorkspace);
+		}
+
+		g_hash_table_remove(priv->workspaceEntries, inWorkspace);
 	}
 
 	/* Free workspace object */
@@ -153,52 +183,33 @@ static XfdashboardWindowTrackerWorkspaceX11* _xfdashboard_window_tracker_x11_get
 																									WnckWorkspace *inWorkspace)
 {
 	XfdashboardWindowTrackerX11Private		*priv;
-	GList									*iter;
-	XfdashboardWindowTrackerWorkspaceX11	*workspace;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_X11(self), NULL);
 	g_return_val_if_fail(WNCK_IS_WORKSPACE(inWorkspace), NULL);
 
 	priv=self->priv;
 
-	/* Iterate through list of workspace object and check if an object for the
-	 * request wnck workspace exist. If one is found then return this existing
-	 * workspace object.
-	 */
-	for(iter=priv->workspaces; iter; iter=g_list_next(iter))
-	{
-		/* Get currently iterated workspace object */
-		workspace=XFDASHBOARD_WINDOW_TRACKER_WORKSPACE_X11(iter->data);
-		if(!workspace) continue;
-
-		/* Check if this workspace object wraps the requested wnck workspace */
-		if(xfdashboard_window_tracker_workspace_x11_get_workspace(workspace)==inWorkspace)
-		{
-			/* Return existing workspace object */
-			return(workspace);
-		}
-	}
-
-	/* If we get here, return NULL as we have not found a matching workspace
-	 * object for the requested wnck workspace.
+	/* Look up workspace object wrapping the requested wnck workspace. It will
+	 * return NULL if no workspace object exists for this wnck workspace.
 	 */
-	return(NULL);
+	return((XfdashboardWindowTrackerWorkspaceX11*)g_hash_table_lookup(priv->workspacesByWnck, inWorkspace));
 }
 
 /* Create workspace object which must not exist yet */
 static XfdashboardWindowTrackerWorkspaceX11* _xfdashboard_window_tracker_x11_create_workspace_for_wnck(XfdashboardWindowTrackerX11 *self,
 																										WnckWorkspace *inWorkspace)
 {
-	XfdashboardWindowTrackerX11Private		*priv;
-	XfdashboardWindowTrackerWorkspaceX11	*workspace;
+	XfdashboardWindowTrackerX11Private			*priv;
+	XfdashboardWindowTrackerWorkspaceX11		*workspace;
+	XfdashboardWindowTrackerX11WorkspaceEntry	*entry;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_X11(self), NULL);
 	g_return_val_if_fail(WNCK_IS_WORKSPACE(inWorkspace), NULL);
 
 	priv=self->priv;
 
-	/* Iterate through list of workspace object and check if an object for the
-	 * request wnck workspace exist. If one is found then the existing workspace object.
+	/* Check if an object for the request wnck workspace exist. If one is found
+	 * then the existing workspace object.
 	 */
 	workspace=_xfdashboard_window_tracker_x11_get_workspace_for_wnck(self, inWorkspace);
 	if(workspace)
@@ -224,9 +235,15 @@ static XfdashboardWindowTrackerWorkspaceX11* _xfdashboard_window_tracker_x11_cre
 		return(NULL);
 	}
 
-	/* Add new workspace object to list of workspace objects */
+	/* Add new workspace object to list of workspace objects and to mappings */
 	priv->workspaces=g_list_prepend(priv->workspaces, workspace);
 
+	entry=g_new0(XfdashboardWindowTrackerX11WorkspaceEntry, 1);
+	entry->wnckWorkspace=inWorkspace;
+	entry->link=priv->workspaces;
+	g_hash_table_insert(priv->workspaceEntries, workspace, entry);
+	g_hash_table_insert(priv->workspacesByWnck, inWorkspace, workspace);
+
 	/* Return new workspace object */
 	XFDASHBOARD_DEBUG(self, WINDOWS,
 						"Created workspace object %s@%p for wnck workspace %s@%p named '%s'",
@@ -240,7 +257,7 @@ static void _xfdashboard_window_tracker_x11_free_window(XfdashboardWindowTracker
 														XfdashboardWindowTrackerWindowX11 *inWindow)
 {
 	XfdashboardWindowTrackerX11Private		*priv;
-	GList									*iter;
+	XfdashboardWindowTrackerX11WindowEntry	*entry;
 
 	g_return_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_X11(self));
 	g_return_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_WINDOW_X11(inWindow));
@@ -257,17 +274,29 @@ static void _xfdashboard_window_tracker_x11_free_window(XfdashboardWindowTracker
 	g_assert(G_OBJECT(inWindow)->ref_count==1);
 #endif
 
-	/* Find entry in window lists and remove it if found */
-	iter=g_list_find(priv->windows, inWindow);
-	if(iter)
+	/* Find entry of window and remove it from window lists and mappings if found */
+	entry=g_hash_table_lookup(priv->windowEntries, inWindow);
+	if(entry)
 	{
-		priv->windows=g_list_delete_link(priv->windows, iter);
-	}
+		priv->windows=g_list_delete_link(priv->windows, entry->link);
 
-	iter=g_list_find(priv->windowsStacked, inWindow);
-	if(iter)
-	{
-		priv->windowsStacked=g_list_delete_link(priv->windowsStacked, iter);
+		if(entry->stackedLink)
+		{
+			priv->windowsStacked=g_list_delete_link(priv->windowsStacked, entry->stackedLink);
+		}
+
+		if(g_hash_table_lookup(priv->windowsByWnck, entry->wnckWindow)==inWindow)
+		{
+			g_hash_table_remove(priv->windowsByWnck, entry->wnckWindow);
+		}
+
+		if(entry->xid!=None &&
+			g_hash_table_lookup(priv->windowsByXID, GUINT_TO_POINTER(entry->xid))==inWindow)
+		{
+			g_hash_table_remove(priv->windowsByXID, GUINT_TO_POINTER(entry->xid));
+		}
+
+		g_hash_table_remove(priv->windowEntries, inWindow);
 	}
 
 	/* Free window object */
@@ -279,38 +308,16 @@ static XfdashboardWindowTrackerWindowX11* _xfdashboard_window_tracker_x11_get_wi
 																								WnckWindow *inWindow)
 {
 	XfdashboardWindowTrackerX11Private		*priv;
-	GList									*iter;
-	XfdashboardWindowTrackerWindowX11		*window;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_X11(self), NULL);
 	g_return_val_if_fail(WNCK_IS_WINDOW(inWindow), NULL);
 
 	priv=self->priv;
 
-	/* Iterate through list of window object and check if an object for the
-	 * request wnck window exist. If one is found then return this existing
-	 * window object.
+	/* Look up window object wrapping the requested wnck window. It will
+	 * return NULL if no window object exists for this wnck window.
 	 */
-	for(iter=priv->windows; iter; iter=g_list_next(iter))
-	{
-		/* Get currently iterated window object */
-		if(!XFDASHBOARD_IS_WINDOW_TRACKER_WINDOW_X11(iter->data)) continue;
-
-		window=XFDASHBOARD_WINDOW_TRACKER_WINDOW_X11(iter->data);
-		if(!window) continue;
-
-		/* Check if this window object wraps the requested wnck window */
-		if(xfdashboard_window_tracker_window_x11_get_window(window)==inWindow)
-		{
-			/* Return existing window object */
-			return(window);
-		}
-	}
-
-	/* If we get here, return NULL as we have not found a matching window
-	 * object for the requested wnck window.
-	 */
-	return(NULL);
+	return((XfdashboardWindowTrackerWindowX11*)g_hash_table_lookup(priv->windowsByWnck, inWindow));
 }
 
 /* Build correctly ordered list of windows in stacked order. The list will not
@@ -325,11 +332,19 @@ static void _xfdashboard_window_tracker_x11_build_stacked_windows_list(Xfdashboa
 	GList									*iter;
 	WnckWindow								*wnckWindow;
 	XfdashboardWindowTrackerWindowX11		*window;
+	XfdashboardWindowTrackerX11WindowEntry	*entry;
 
 	g_return_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER(self));
 
 	priv=self->priv;
 
+	/* Forget links of windows into old stacked windows list */
+	for(iter=priv->windowsStacked; iter; iter=g_list_next(iter))
+	{
+		entry=g_hash_table_lookup(priv->windowEntries, iter->data);
+		if(entry) entry->stackedLink=NULL;
+	}
+
 	/* Get list of stacked windows from wnck */
 	wnckWindowsStacked=wnck_screen_get_windows_stacked(priv->screen);
 
@@ -341,11 +356,17 @@ static void _xfdashboard_window_tracker_x11_build_stacked_windows_list(Xfdashboa
 		wnckWindow=WNCK_WINDOW(iter->data);
 		if(!wnckWindow) continue;
 
-		/* Lookup window object from wnck window iterated */
+		/* Lookup window object from wnck window iterated and remember its
+		 * link into new list for fast removal. Reversing the list below
+		 * keeps the links valid.
+		 */
 		window=_xfdashboard_window_tracker_x11_get_window_for_wnck(self, wnckWindow);
 		if(window)
 		{
 			newWindowsStacked=g_list_prepend(newWindowsStacked, window);
+
+			entry=g_hash_table_lookup(priv->windowEntries, window);
+			if(entry) entry->stackedLink=newWindowsStacked;
 		}
 	}
 	newWindowsStacked=g_list_reverse(newWindowsStacked);
@@ -361,14 +382,15 @@ static XfdashboardWindowTrackerWindowX11* _xfdashboard_window_tracker_x11_create
 {
 	XfdashboardWindowTrackerX11Private		*priv;
 	XfdashboardWindowTrackerWindowX11		*window;
+	XfdashboardWindowTrackerX11WindowEntry	*entry;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_X11(self), NULL);
 	g_return_val_if_fail(WNCK_IS_WINDOW(inWindow), NULL);
 
 	priv=self->priv;
 
-	/* Iterate through list of window object and check if an object for the
-	 * request wnck window exist. If one is found then the existing window object.
+	/* Check if an object for the request wnck window exist. If one is found
+	 * then the existing window object.
 	 */
 	window=_xfdashboard_window_tracker_x11_get_window_for_wnck(self, inWindow);
 	if(window)
@@ -394,9 +416,18 @@ static XfdashboardWindowTrackerWindowX11* _xfdashboard_window_tracker_x11_create
 		return(NULL);
 	}
 
-	/* Add new window object to list of window objects */
+	/* Add new window object to list of window objects and to mappings */
 	priv->windows=g_list_prepend(priv->windows, window);
 
+	entry=g_new0(XfdashboardWindowTrackerX11WindowEntry, 1);
+	entry->wnckWindow=inWindow;
+	entry->xid=wnck_window_get_xid(inWindow);
+	entry->link=priv->windows;
+	entry->stackedLink=NULL;
+	g_hash_table_insert(priv->windowEntries, window, entry);
+	g_hash_table_insert(priv->windowsByWnck, inWindow, window);
+	if(entry->xid!=None) g_hash_table_insert(priv->windowsByXID, GUINT_TO_POINTER(entry->xid), window);
+
 	/* Assume window stacking changed to get correctly ordered list of windows */
 	_xfdashboard_window_tracker_x11_build_stacked_windows_list(self);
 
@@ -662,6 +693,52 @@ static void _xfdashboard_window_tracker_x11_on_window_closed(XfdashboardWindowTr
 	_xfdashboard_window_tracker_x11_free_window(self, window);
 }
 
+/* The batch of windows opened in this main loop iteration is complete */
+static gboolean _xfdashboard_window_tracker_x11_on_windows_update_end(gpointer inUserData)
+{
+	XfdashboardWindowTrackerX11				*self;
+	XfdashboardWindowTrackerX11Private		*priv;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_X11(inUserData), G_SOURCE_REMOVE);
+
+	self=XFDASHBOARD_WINDOW_TRACKER_X11(inUserData);
+	priv=self->priv;
+
+	/* Emit signal */
+	priv->windowsUpdateID=0;
+	XFDASHBOARD_DEBUG(self, WINDOWS, "Batch update of opened windows finished");
+	g_signal_emit_by_name(self, "windows-update-end");
+
+	return(G_SOURCE_REMOVE);
+}
+
+/* Start a batch of opened windows if not done already. Libwnck emits one
+ * signal for each window it finds, e.g. many at once on session restore, so
+ * all windows opened until main loop gets idle again are batched. The idle
+ * source has a higher priority than clutter's redraw and relayout so listeners
+ * can finish their work before the next frame is layouted.
+ */
+static void _xfdashboard_window_tracker_x11_begin_windows_update(XfdashboardWindowTrackerX11 *self)
+{
+	XfdashboardWindowTrackerX11Private		*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_X11(self));
+
+	priv=self->priv;
+
+	/* Do nothing if a batch is already in progress */
+	if(priv->windowsUpdateID) return;
+
+	/* Emit signal and schedule end of batch */
+	XFDASHBOARD_DEBUG(self, WINDOWS, "Batch update of opened windows started");
+	g_signal_emit_by_name(self, "windows-update-begin");
+
+	priv->windowsUpdateID=g_idle_add_full(G_PRIORITY_HIGH_IDLE,
+											_xfdashboard_window_tracker_x11_on_windows_update_end,
+											self,
+											NULL);
+}
+
 /* A new window was opened */
 static void _xfdashboard_window_tracker_x11_on_window_opened(XfdashboardWindowTrackerX11 *self,
 																WnckWindow *inWindow,
@@ -695,7 +772,9 @@ static void _xfdashboard_window_tracker_x11_on_window_opened(XfdashboardWindowTr
 		g_signal_handlers_block_by_func(window, _xfdashboard_window_tracker_x11_on_window_geometry_changed, self);
 	}
 
-	/* Emit signal */
+	/* Emit signal within a batch of opened windows */
+	_xfdashboard_window_tracker_x11_begin_windows_update(self);
+
 	XFDASHBOARD_DEBUG(self, WINDOWS,
 						"Window '%s' created",
 						wnck_window_get_name(inWindow));
@@ -1685,6 +1764,12 @@ static void _xfdashboard_window_tracker_x11_dispose(GObject *inObject)
 		priv->suspendSignalID=0;
 	}
 
+	if(priv->windowsUpdateID)
+	{
+		g_source_remove(priv->windowsUpdateID);
+		priv->windowsUpdateID=0;
+	}
+
 	if(priv->activeWindow)
 	{
 		priv->activeWindow=NULL;
@@ -1703,6 +1788,24 @@ static void _xfdashboard_window_tracker_x11_dispose(GObject *inObject)
 		priv->windowsStacked=NULL;
 	}
 
+	if(priv->windowsByXID)
+	{
+		g_hash_table_destroy(priv->windowsByXID);
+		priv->windowsByXID=NULL;
+	}
+
+	if(priv->windowsByWnck)
+	{
+		g_hash_table_destroy(priv->windowsByWnck);
+		priv->windowsByWnck=NULL;
+	}
+
+	if(priv->windowEntries)
+	{
+		g_hash_table_destroy(priv->windowEntries);
+		priv->windowEntries=NULL;
+	}
+
 	if(priv->activeWorkspace)
 	{
 		priv->activeWorkspace=NULL;
@@ -1715,6 +1818,18 @@ static void _xfdashboard_window_tracker_x11_dispose(GObject *inObject)
 		priv->workspaces=NULL;
 	}
 
+	if(priv->workspacesByWnck)
+	{
+		g_hash_table_destroy(priv->workspacesByWnck);
+		priv->workspacesByWnck=NULL;
+	}
+
+	if(priv->workspaceEntries)
+	{
+		g_hash_table_destroy(priv->workspaceEntries);
+		priv->workspaceEntries=NULL;
+	}
+
 	if(priv->primaryMonitor)
 	{
 		priv->primaryMonitor=NULL;
@@ -1848,6 +1963,12 @@ void xfdashboard_window_tracker_x11_init(XfdashboardWindowTrackerX11 *self)
 	priv->windowsStacked=NULL;
 	priv->workspaces=NULL;
 	priv->monitors=NULL;
+	priv->windowEntries=g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+	priv->windowsByWnck=g_hash_table_new(g_direct_hash, g_direct_equal);
+	priv->windowsByXID=g_hash_table_new(g_direct_hash, g_direct_equal);
+	priv->workspaceEntries=g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, g_free);
+	priv->workspacesByWnck=g_hash_table_new(g_direct_hash, g_direct_equal);
+	priv->windowsUpdateID=0;
 	priv->screen=wnck_screen_get_default();
 #if GTK_CHECK_VERSION(3, 22, 0)
 	priv->gdkDisplay=gdk_display_get_default();
@@ -2145,3 +2266,16 @@ XfdashboardWindowTrackerWorkspace* xfdashboard_window_tracker_x11_get_workspace_
 	workspace=_xfdashboard_window_tracker_x11_get_workspace_for_wnck(self, inWorkspace);
 	return(XFDASHBOARD_WINDOW_TRACKER_WORKSPACE(workspace));
 }
+
+/* Find and return XfdashboardWindowTrackerWindow object for X window ID */
+XfdashboardWindowTrackerWindow* xfdashboard_window_tracker_x11_get_window_for_xid(XfdashboardWindowTrackerX11 *self,
+																					gulong inXWindowID)
+{
+	XfdashboardWindowTrackerWindowX11		*window;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_WINDOW_TRACKER_X11(self), NULL);
+
+	/* Lookup window object for requested X window ID and return it */
+	window=g_hash_table_lookup(self->priv->windowsByXID, GUINT_TO_POINTER(inXWindowID));
+	return(XFDASHBOARD_WINDOW_TRACKER_WINDOW(window));
+}
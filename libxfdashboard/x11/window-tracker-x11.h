@@ -84,6 +84,8 @@ XfdashboardWindowTrackerWindow* xfdashboard_window_tracker_x11_get_window_for_wn
 																					WnckWindow *inWindow);
 XfdashboardWindowTrackerWorkspace* xfdashboard_window_tracker_x11_get_workspace_for_wnck(XfdashboardWindowTrackerX11 *self,
 																							WnckWorkspace *inWorkspace);
+XfdashboardWindowTrackerWindow* xfdashboard_window_tracker_x11_get_window_for_xid(XfdashboardWindowTrackerX11 *self,
+																					gulong inXWindowID);
 
 G_END_DECLS
 
@@ -58,10 +58,102 @@ struct _XfdashboardGnomeShellSearchProviderPrivate
 
 	gchar			*providerName;
 	gchar			*providerIcon;
+
+	GDBusProxy		*proxy;
 };
 
 /* IMPLEMENTATION: Private variables and methods */
 #define XFDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_KEYFILE_GROUP		"Shell Search Provider"
+#define XFDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_DBUS_INTERFACE		"org.gnome.Shell.SearchProvider2"
+#define XFDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_SEARCH_TIMEOUT	500		/* Timeout budget for each search call in milliseconds */
+#define XFDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_PROXY_FLAGS		(G_DBUS_PROXY_FLAGS_DO_NOT_LOAD_PROPERTIES | \
+																	G_DBUS_PROXY_FLAGS_DO_NOT_CONNECT_SIGNALS | \
+																	G_DBUS_PROXY_FLAGS_DO_NOT_AUTO_START_AT_CONSTRUCTION)
+
+typedef struct _XfdashboardGnomeShellSearchProviderSearchData		XfdashboardGnomeShellSearchProviderSearchData;
+struct _XfdashboardGnomeShellSearchProviderSearchData
+{
+	GSimpleAsyncResult						*result;
+	const gchar								*methodName;
+	GVariant								*parameters;
+	GCancellable							*cancellable;
+};
+
+
+/* Forget cached D-Bus proxy */
+static void _xfdashboard_gnome_shell_search_provider_reset_proxy(XfdashboardGnomeShellSearchProvider *self)
+{
+	XfdashboardGnomeShellSearchProviderPrivate		*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(self));
+
+	priv=self->priv;
+
+	/* Release cached proxy */
+	if(priv->proxy)
+	{
+		g_object_unref(priv->proxy);
+		priv->proxy=NULL;
+	}
+}
+
+/* Remember D-Bus proxy for Gnome-Shell search provider to reuse it for all calls */
+static void _xfdashboard_gnome_shell_search_provider_set_proxy(XfdashboardGnomeShellSearchProvider *self,
+																GDBusProxy *inProxy)
+{
+	XfdashboardGnomeShellSearchProviderPrivate		*priv;
+
+	g_return_if_fail(XFDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(self));
+	g_return_if_fail(G_IS_DBUS_PROXY(inProxy));
+
+	priv=self->priv;
+
+	/* Release any cached proxy */
+	_xfdashboard_gnome_shell_search_provider_reset_proxy(self);
+
+	/* Cache proxy. It is created for the well-known bus name so it follows
+	 * the owner of bus name if the search provider exits and is started
+	 * again by the next call.
+	 */
+	priv->proxy=g_object_ref(inProxy);
+
+	g_debug("Cached D-Bus proxy for bus name '%s' and object path '%s' of Gnome-Shell search provider '%s'",
+				priv->dbusBusName,
+				priv->dbusObjectPath,
+				priv->gnomeShellID);
+}
+
+/* Get D-Bus proxy for Gnome-Shell search provider. The cached proxy is returned
+ * if available, otherwise it is created and cached now.
+ * The returned proxy must be freed with g_object_unref().
+ */
+static GDBusProxy* _xfdashboard_gnome_shell_search_provider_get_proxy(XfdashboardGnomeShellSearchProvider *self,
+																		GError **outError)
+{
+	XfdashboardGnomeShellSearchProviderPrivate		*priv;
+	GDBusProxy										*proxy;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(self), NULL);
+	g_return_val_if_fail(outError==NULL || *outError==NULL, NULL);
+
+	priv=self->priv;
+
+	/* Return cached proxy if available */
+	if(priv->proxy) return(g_object_ref(priv->proxy));
+
+	/* Create proxy now and cache it */
+	proxy=g_dbus_proxy_new_for_bus_sync(G_BUS_TYPE_SESSION,
+										XFDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_PROXY_FLAGS,
+										NULL,
+										priv->dbusBusName,
+										priv->dbusObjectPath,
+										XFDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_DBUS_INTERFACE,
+										NULL,
+										outError);
+	if(proxy) _xfdashboard_gnome_shell_search_provider_set_proxy(self, proxy);
+
+	return(proxy);
+}
 
 
 /* IMPLEMENTATION: XfdashboardSearchProvider */
@@ -215,6 +307,13 @@ static gboolean _xfdashboard_gnome_shell_search_provider_update_from_file(Xfdash
 						priv->gnomeShellID);
 		}
 
+	/* If bus name or object path changed the cached proxy cannot be used anymore */
+	if(g_strcmp0(priv->dbusBusName, dbusBusName)!=0 ||
+		g_strcmp0(priv->dbusObjectPath, dbusObjectPath)!=0)
+	{
+		_xfdashboard_gnome_shell_search_provider_reset_proxy(self);
+	}
+
 	/* We got all data from search provider's data file so update now.
 	 * Set default values where appropiate (display name and icon).
 	 */
@@ -438,6 +537,113 @@ static const gchar* _xfdashboard_gnome_shell_search_provider_get_icon(Xfdashboar
 	return(priv->providerIcon);
 }
 
+/* Build parameters to call search method at Gnome-Shell search provider depending
+ * on if an initial result set is requested or an update for a previous result set.
+ */
+static GVariant* _xfdashboard_gnome_shell_search_provider_build_search_call(XfdashboardGnomeShellSearchProvider *self,
+																			const gchar **inSearchTerms,
+																			XfdashboardSearchResultSet *inPreviousResultSet,
+																			const gchar **outMethodName)
+{
+	XfdashboardGnomeShellSearchProviderPrivate		*priv;
+	GVariantBuilder									builder;
+	GList											*allPrevResults;
+	GList											*allPrevIter;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(self), NULL);
+	g_return_val_if_fail(inSearchTerms, NULL);
+	g_return_val_if_fail(outMethodName, NULL);
+
+	priv=self->priv;
+
+	/* Call search method at search provider to get initial result set */
+	if(!inPreviousResultSet)
+	{
+		*outMethodName="GetInitialResultSet";
+		return(g_variant_new("(^as)", inSearchTerms));
+	}
+
+	/* Initialize GVariant builder to get a GVariant with an array
+	 * of strings for previous result set.
+	 */
+	g_variant_builder_init(&builder, G_VARIANT_TYPE_STRING_ARRAY);
+
+	/* For each result item in previous result set add a string
+	 * to GVariant builder.
+	 */
+	allPrevResults=xfdashboard_search_result_set_get_all(inPreviousResultSet);
+	for(allPrevIter=allPrevResults; allPrevIter; allPrevIter=g_list_next(allPrevIter))
+	{
+		g_variant_builder_add(&builder, "s", g_variant_get_string((GVariant*)allPrevIter->data, NULL));
+	}
+	g_debug("Built previous result set with %d entries for Gnome Shell search provider '%s' of type %s",
+				g_list_length(allPrevResults),
+				priv->gnomeShellID,
+				G_OBJECT_TYPE_NAME(self));
+	g_list_free_full(allPrevResults, (GDestroyNotify)g_variant_unref);
+
+	/* Call search method at search provider to get an update
+	 * for previous result set.
+	 */
+	*outMethodName="GetSubsearchResultSet";
+	return(g_variant_new("(as^as)", &builder, inSearchTerms));
+}
+
+/* Create result set from result returned by search method of Gnome-Shell search provider */
+static XfdashboardSearchResultSet* _xfdashboard_gnome_shell_search_provider_create_result_set(XfdashboardGnomeShellSearchProvider *self,
+																								GVariant *inProxyResult)
+{
+	XfdashboardGnomeShellSearchProviderPrivate		*priv;
+	XfdashboardSearchResultSet						*resultSet;
+	GVariant										*resultItem;
+	gchar											**proxyResultSet;
+	gchar											**iter;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(self), NULL);
+	g_return_val_if_fail(inProxyResult, NULL);
+
+	priv=self->priv;
+	resultSet=NULL;
+
+	/* Retrieve result set for this application from returned result set of
+	 * search provider.
+	 */
+	proxyResultSet=NULL;
+	g_variant_get(inProxyResult, "(^as)", &proxyResultSet);
+
+	if(proxyResultSet)
+	{
+		/* Initialize result set */
+		resultSet=xfdashboard_search_result_set_new();
+
+		/* For each string in returned result set of search provider create a GVariant
+		 * which gets added with full score to result set for this application.
+		 */
+		for(iter=proxyResultSet; *iter; iter++)
+		{
+			resultItem=g_variant_new_string(*iter);
+			if(resultItem)
+			{
+				xfdashboard_search_result_set_add_item(resultSet, g_variant_ref(resultItem));
+				xfdashboard_search_result_set_set_item_score(resultSet, resultItem, 1.0f);
+
+				/* Release result item added */
+				g_variant_unref(resultItem);
+			}
+		}
+		g_debug("Got result set with %u entries for Gnome Shell search provider '%s' of type %s",
+					xfdashboard_search_result_set_get_size(resultSet),
+					priv->gnomeShellID,
+					G_OBJECT_TYPE_NAME(self));
+	}
+
+	/* Release allocated resources */
+	if(proxyResultSet) g_strfreev(proxyResultSet);
+
+	/* Return result set */
+	return(resultSet);
+}
+
 /* Get result set for requested search terms */
 static XfdashboardSearchResultSet* _xfdashboard_gnome_shell_search_provider_get_result_set(XfdashboardSearchProvider *inProvider,
 																							const gchar **inSearchTerms,
@@ -447,11 +653,10 @@ static XfdashboardSearchResultSet* _xfdashboard_gnome_shell_search_provider_get_
 	XfdashboardGnomeShellSearchProviderPrivate		*priv;
 	GError											*error;
 	XfdashboardSearchResultSet						*resultSet;
-	GVariant										*resultItem;
 	GDBusProxy										*proxy;
 	GVariant										*proxyResult;
-	gchar											**proxyResultSet;
-	gchar											**iter;
+	const gchar										*methodName;
+	GVariant										*parameters;
 
 	g_return_val_if_fail(XFDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(inProvider), NULL);
 
@@ -461,14 +666,7 @@ static XfdashboardSearchResultSet* _xfdashboard_gnome_shell_search_provider_get_
 	resultSet=NULL;
 
 	/* Connect to search provider via DBUS */
-	proxy=g_dbus_proxy_new_for_bus_sync(G_BUS_TYPE_SESSION,
-										G_DBUS_PROXY_FLAGS_NONE,
-										NULL,
-										priv->dbusBusName,
-										priv->dbusObjectPath,
-										"org.gnome.Shell.SearchProvider2",
-										NULL,
-										&error);
+	proxy=_xfdashboard_gnome_shell_search_provider_get_proxy(self, &error);
 	if(!proxy)
 	{
 		/* Show error message */
@@ -486,61 +684,19 @@ static XfdashboardSearchResultSet* _xfdashboard_gnome_shell_search_provider_get_
 	/* Call search method at search provider depending on if a initial
 	 * result set is requested or an update for a previous result set.
 	 */
-	if(!inPreviousResultSet)
-	{
-		/* Call search method at search provider to get initial result set */
-		proxyResult=g_dbus_proxy_call_sync(proxy,
-											"GetInitialResultSet",
-											g_variant_new("(^as)", inSearchTerms),
-											G_DBUS_CALL_FLAGS_NONE,
-											-1,
-											NULL,
-											&error);
-		g_debug("Fetched initial result set at %p for Gnome Shell search provider '%s' of type %s",
-					proxyResult,
-					priv->gnomeShellID,
-					G_OBJECT_TYPE_NAME(self));
-	}
-		else
-		{
-			GVariantBuilder						builder;
-			GList								*allPrevResults;
-			GList								*allPrevIter;
-
-			/* Initialize GVariant builder to get a GVariant with an array
-			 * of strings for previous result set.
-			 */
-			g_variant_builder_init(&builder, G_VARIANT_TYPE_STRING_ARRAY);
-
-			/* For each result item in previous result set add a string
-			 * to GVariant builder.
-			 */
-			allPrevResults=xfdashboard_search_result_set_get_all(inPreviousResultSet);
-			for(allPrevIter=allPrevResults; allPrevIter; allPrevIter=g_list_next(allPrevIter))
-			{
-				g_variant_builder_add(&builder, "s", g_variant_get_string((GVariant*)allPrevIter->data, NULL));
-			}
-			g_debug("Built previous result set with %d entries for Gnome Shell search provider '%s' of type %s",
-						g_list_length(allPrevResults),
-						priv->gnomeShellID,
-						G_OBJECT_TYPE_NAME(self));
-			g_list_free_full(allPrevResults, (GDestroyNotify)g_variant_unref);
-
-			/* Call search method at search provider to get an update
-			 * for previous result set.
-			 */
-			proxyResult=g_dbus_proxy_call_sync(proxy,
-												"GetSubsearchResultSet",
-												g_variant_new("(as^as)", &builder, inSearchTerms),
-												G_DBUS_CALL_FLAGS_NONE,
-												-1,
-												NULL,
-												&error);
-			g_debug("Fetched subset result set at %p for Gnome Shell search provider '%s' of type %s",
-						proxyResult,
-						priv->gnomeShellID,
-						G_OBJECT_TYPE_NAME(self));
-		}
+	parameters=_xfdashboard_gnome_shell_search_provider_build_search_call(self, inSearchTerms, inPreviousResultSet, &methodName);
+	proxyResult=g_dbus_proxy_call_sync(proxy,
+										methodName,
+										parameters,
+										G_DBUS_CALL_FLAGS_NONE,
+										XFDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_SEARCH_TIMEOUT,
+										NULL,
+										&error);
+	g_debug("Fetched result set at %p by %s for Gnome Shell search provider '%s' of type %s",
+				proxyResult,
+				methodName,
+				priv->gnomeShellID,
+				G_OBJECT_TYPE_NAME(self));
 
 	if(!proxyResult)
 	{
@@ -557,44 +713,217 @@ static XfdashboardSearchResultSet* _xfdashboard_gnome_shell_search_provider_get_
 		return(NULL);
 	}
 
-	/* Retrieve result set for this application from returned result set of
-	 * search provider.
-	 */
-	proxyResultSet=NULL;
-	g_variant_get(proxyResult, "(^as)", &proxyResultSet);
+	/* Create result set from returned result of search provider */
+	resultSet=_xfdashboard_gnome_shell_search_provider_create_result_set(self, proxyResult);
 
-	if(proxyResultSet)
+	/* Release allocated resources */
+	if(proxyResult) g_variant_unref(proxyResult);
+	if(proxy) g_object_unref(proxy);
+
+	/* Return result set */
+	return(resultSet);
+}
+
+/* Free data of an asynchronous search */
+static void _xfdashboard_gnome_shell_search_provider_search_data_free(XfdashboardGnomeShellSearchProviderSearchData *inData)
+{
+	g_return_if_fail(inData);
+
+	/* Release allocated resources */
+	if(inData->result) g_object_unref(inData->result);
+	if(inData->parameters) g_variant_unref(inData->parameters);
+	if(inData->cancellable) g_object_unref(inData->cancellable);
+	g_free(inData);
+}
+
+/* Search method of Gnome-Shell search provider returned for an asynchronous search */
+static void _xfdashboard_gnome_shell_search_provider_on_search_call_done(GObject *inSource,
+																			GAsyncResult *inResult,
+																			gpointer inUserData)
+{
+	XfdashboardGnomeShellSearchProviderSearchData	*data;
+	XfdashboardGnomeShellSearchProvider				*self;
+	XfdashboardSearchResultSet						*resultSet;
+	GVariant										*proxyResult;
+	GError											*error;
+
+	data=(XfdashboardGnomeShellSearchProviderSearchData*)inUserData;
+	error=NULL;
+
+G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+	self=XFDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER(g_async_result_get_source_object(G_ASYNC_RESULT(data->result)));
+
+	/* Create result set from returned result of search provider */
+	proxyResult=g_dbus_proxy_call_finish(G_DBUS_PROXY(inSource), inResult, &error);
+	if(proxyResult)
 	{
-		/* Initialize result set */
-		resultSet=xfdashboard_search_result_set_new();
+		g_debug("Fetched result set at %p by %s for Gnome Shell search provider '%s' of type %s",
+					proxyResult,
+					data->methodName,
+					self->priv->gnomeShellID,
+					G_OBJECT_TYPE_NAME(self));
 
-		/* For each string in returned result set of search provider create a GVariant
-		 * which gets added with full score to result set for this application.
-		 */
-		for(iter=proxyResultSet; *iter; iter++)
-		{
-			resultItem=g_variant_new_string(*iter);
-			if(resultItem)
-			{
-				xfdashboard_search_result_set_add_item(resultSet, g_variant_ref(resultItem));
-				xfdashboard_search_result_set_set_item_score(resultSet, resultItem, 1.0f);
+		resultSet=_xfdashboard_gnome_shell_search_provider_create_result_set(self, proxyResult);
+		if(resultSet) g_simple_async_result_set_op_res_gpointer(data->result, resultSet, g_object_unref);
 
-				/* Release result item added */
-				g_variant_unref(resultItem);
-			}
+		g_variant_unref(proxyResult);
+	}
+		else if(g_error_matches(error, G_IO_ERROR, G_IO_ERROR_TIMED_OUT))
+		{
+			/* The search provider did not reply within its timeout budget.
+			 * Its reply will be dropped when it arrives late and the search
+			 * is finished without a result set (NULL) but also without an
+			 * error so it does not block the results of other search providers.
+			 */
+			g_debug("Dropping search by %s for Gnome Shell search provider '%s' of type %s: %s",
+						data->methodName,
+						self->priv->gnomeShellID,
+						G_OBJECT_TYPE_NAME(self),
+						error->message);
+			g_error_free(error);
 		}
-		g_debug("Got result set with %u entries for Gnome Shell search provider '%s' of type %s",
-					xfdashboard_search_result_set_get_size(resultSet),
-					priv->gnomeShellID,
-					G_OBJECT_TYPE_NAME(self));
+		else g_simple_async_result_take_error(data->result, error);
+
+	/* Asynchronous search is done */
+	g_simple_async_result_complete(data->result);
+G_GNUC_END_IGNORE_DEPRECATIONS
+
+	/* Release allocated resources */
+	g_object_unref(self);
+	_xfdashboard_gnome_shell_search_provider_search_data_free(data);
+}
+
+/* D-Bus proxy for Gnome-Shell search provider was created for an asynchronous search */
+static void _xfdashboard_gnome_shell_search_provider_on_search_proxy_created(GObject *inSource,
+																				GAsyncResult *inResult,
+																				gpointer inUserData)
+{
+	XfdashboardGnomeShellSearchProviderSearchData	*data;
+	XfdashboardGnomeShellSearchProvider				*self;
+	GDBusProxy										*proxy;
+	GError											*error;
+
+	data=(XfdashboardGnomeShellSearchProviderSearchData*)inUserData;
+	error=NULL;
+
+	/* If proxy could not be created the asynchronous search failed */
+	proxy=g_dbus_proxy_new_for_bus_finish(inResult, &error);
+	if(!proxy)
+	{
+G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+		g_simple_async_result_take_error(data->result, error);
+		g_simple_async_result_complete(data->result);
+G_GNUC_END_IGNORE_DEPRECATIONS
+
+		/* Release allocated resources */
+		_xfdashboard_gnome_shell_search_provider_search_data_free(data);
+
+		return;
 	}
 
+	/* Cache proxy if no other one was cached in the meantime. The search
+	 * provider is kept alive by the asynchronous result.
+	 */
+G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+	self=XFDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER(g_async_result_get_source_object(G_ASYNC_RESULT(data->result)));
+G_GNUC_END_IGNORE_DEPRECATIONS
+	if(!self->priv->proxy) _xfdashboard_gnome_shell_search_provider_set_proxy(self, proxy);
+	g_object_unref(self);
+
+	/* Call search method at search provider. The call keeps the proxy alive
+	 * until it returns.
+	 */
+	g_dbus_proxy_call(proxy,
+						data->methodName,
+						data->parameters,
+						G_DBUS_CALL_FLAGS_NONE,
+						XFDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_SEARCH_TIMEOUT,
+						data->cancellable,
+						_xfdashboard_gnome_shell_search_provider_on_search_call_done,
+						data);
+
 	/* Release allocated resources */
-	if(proxyResultSet) g_strfreev(proxyResultSet);
-	if(proxyResult) g_variant_unref(proxyResult);
-	if(proxy) g_object_unref(proxy);
+	g_object_unref(proxy);
+}
+
+/* Get result set for requested search terms asynchronously */
+static void _xfdashboard_gnome_shell_search_provider_get_result_set_async(XfdashboardSearchProvider *inProvider,
+																			const gchar **inSearchTerms,
+																			XfdashboardSearchResultSet *inPreviousResultSet,
+																			GCancellable *inCancellable,
+																			GAsyncReadyCallback inCallback,
+																			gpointer inUserData)
+{
+	XfdashboardGnomeShellSearchProvider				*self;
+	XfdashboardGnomeShellSearchProviderPrivate		*priv;
+	XfdashboardGnomeShellSearchProviderSearchData	*data;
+
+	g_return_if_fail(XFDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(inProvider));
+
+	self=XFDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER(inProvider);
+	priv=self->priv;
+
+	/* Set up data for asynchronous search */
+	data=g_new0(XfdashboardGnomeShellSearchProviderSearchData, 1);
+	data->parameters=g_variant_ref_sink(_xfdashboard_gnome_shell_search_provider_build_search_call(self, inSearchTerms, inPreviousResultSet, &data->methodName));
+	if(inCancellable) data->cancellable=g_object_ref(inCancellable);
+
+G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+	data->result=g_simple_async_result_new(G_OBJECT(self),
+											inCallback,
+											inUserData,
+											_xfdashboard_gnome_shell_search_provider_get_result_set_async);
+	g_simple_async_result_set_check_cancellable(data->result, inCancellable);
+G_GNUC_END_IGNORE_DEPRECATIONS
+
+	/* Call search method at cached proxy of search provider if available.
+	 * The call is limited to the timeout budget of searches and a late reply
+	 * is dropped if the search was cancelled in the meantime.
+	 */
+	if(priv->proxy)
+	{
+		g_dbus_proxy_call(priv->proxy,
+							data->methodName,
+							data->parameters,
+							G_DBUS_CALL_FLAGS_NONE,
+							XFDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_SEARCH_TIMEOUT,
+							data->cancellable,
+							_xfdashboard_gnome_shell_search_provider_on_search_call_done,
+							data);
+		return;
+	}
+
+	/* Connect to search provider via DBUS without blocking */
+	g_dbus_proxy_new_for_bus(G_BUS_TYPE_SESSION,
+								XFDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_PROXY_FLAGS,
+								NULL,
+								priv->dbusBusName,
+								priv->dbusObjectPath,
+								XFDASHBOARD_GNOME_SHELL_SEARCH_PROVIDER_DBUS_INTERFACE,
+								inCancellable,
+								_xfdashboard_gnome_shell_search_provider_on_search_proxy_created,
+								data);
+}
+
+/* Finish asynchronous search and return result set */
+static XfdashboardSearchResultSet* _xfdashboard_gnome_shell_search_provider_get_result_set_finish(XfdashboardSearchProvider *inProvider,
+																									GAsyncResult *inResult,
+																									GError **outError)
+{
+	XfdashboardSearchResultSet						*resultSet;
+
+	g_return_val_if_fail(XFDASHBOARD_IS_GNOME_SHELL_SEARCH_PROVIDER(inProvider), NULL);
+
+G_GNUC_BEGIN_IGNORE_DEPRECATIONS
+	g_return_val_if_fail(g_simple_async_result_is_valid(inResult, G_OBJECT(inProvider), _xfdashboard_gnome_shell_search_provider_get_result_set_async), NULL);
+
+	if(g_simple_async_result_propagate_error(G_SIMPLE_ASYNC_RESULT(inResult), outError)) return(NULL);
+
+	resultSet=g_simple_async_result_get_op_res_gpointer(G_SIMPLE_ASYNC_RESULT(inResult));
+G_GNUC_END_IGNORE_DEPRECATIONS
 
 	/* Return result set */
+	if(resultSet) g_object_ref(resultSet);
 	return(resultSet);
 }
 
@@ -628,14 +957,7 @@ static ClutterActor* _xfdashboard_gnome_shell_search_provider_create_result_acto
 	error=NULL;
 
 	/* Get meta data of result item */
-	proxy=g_dbus_proxy_new_for_bus_sync(G_BUS_TYPE_SESSION,
-										G_DBUS_PROXY_FLAGS_NONE,
-										NULL,
-										priv->dbusBusName,
-										priv->dbusObjectPath,
-										"org.gnome.Shell.SearchProvider2",
-										NULL,
-										&error);
+	proxy=_xfdashboard_gnome_shell_search_provider_get_proxy(self, &error);
 	if(!proxy)
 	{
 		/* Show error message */
@@ -861,14 +1183,7 @@ static gboolean _xfdashboard_gnome_shell_search_provider_activate_result(Xfdashb
 	identifier=g_variant_get_string(inResultItem, NULL);
 
 	/* Call 'ActivateResult' over DBUS at Gnome-Shell search provider */
-	proxy=g_dbus_proxy_new_for_bus_sync(G_BUS_TYPE_SESSION,
-										G_DBUS_PROXY_FLAGS_NONE,
-										NULL,
-										priv->dbusBusName,
-										priv->dbusObjectPath,
-										"org.gnome.Shell.SearchProvider2",
-										NULL,
-										&error);
+	proxy=_xfdashboard_gnome_shell_search_provider_get_proxy(self, &error);
 	if(!proxy)
 	{
 		/* Show error message */
@@ -935,14 +1250,7 @@ static gboolean _xfdashboard_gnome_shell_search_provider_launch_search(Xfdashboa
 	error=NULL;
 
 	/* Call 'LaunchSearch' over DBUS at Gnome-Shell search provider */
-	proxy=g_dbus_proxy_new_for_bus_sync(G_BUS_TYPE_SESSION,
-										G_DBUS_PROXY_FLAGS_NONE,
-										NULL,
-										priv->dbusBusName,
-										priv->dbusObjectPath,
-										"org.gnome.Shell.SearchProvider2",
-										NULL,
-										&error);
+	proxy=_xfdashboard_gnome_shell_search_provider_get_proxy(self, &error);
 	if(!proxy)
 	{
 		/* Show error message */
@@ -998,6 +1306,8 @@ static void _xfdashboard_gnome_shell_search_provider_dispose(GObject *inObject)
 	XfdashboardGnomeShellSearchProviderPrivate	*priv=self->priv;
 
 	/* Release allocated resources */
+	_xfdashboard_gnome_shell_search_provider_reset_proxy(self);
+
 	if(priv->gnomeShellID)
 	{
 		g_free(priv->gnomeShellID);
@@ -1066,6 +1376,8 @@ void xfdashboard_gnome_shell_search_provider_class_init(XfdashboardGnomeShellSea
 	providerClass->get_icon=_xfdashboard_gnome_shell_search_provider_get_icon;
 	providerClass->get_name=_xfdashboard_gnome_shell_search_provider_get_name;
 	providerClass->get_result_set=_xfdashboard_gnome_shell_search_provider_get_result_set;
+	providerClass->get_result_set_async=_xfdashboard_gnome_shell_search_provider_get_result_set_async;
+	providerClass->get_result_set_finish=_xfdashboard_gnome_shell_search_provider_get_result_set_finish;
 	providerClass->create_result_actor=_xfdashboard_gnome_shell_search_provider_create_result_actor;
 	providerClass->activate_result=_xfdashboard_gnome_shell_search_provider_activate_result;
 	providerClass->launch_search=_xfdashboard_gnome_shell_search_provider_launch_search;
@@ -1097,4 +1409,5 @@ void xfdashboard_gnome_shell_search_provider_init(XfdashboardGnomeShellSearchPro
 	priv->dbusObjectPath=NULL;
 	priv->providerName=NULL;
 	priv->providerIcon=NULL;
+	priv->proxy=NULL;
 }